@@ -88,4 +88,9 @@
 // Safe to enable this flag since standalone is associated with host and not a device.
 #define CONFIG_BUILD_FOR_HOST_UNIT_TEST 1
 
+// Share encoded attribute reports between read handlers, so that the unit tests exercise the report cache.
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_SIZE
+#define CHIP_IM_SERVER_REPORT_CACHE_SIZE 8
+#endif
+
 #endif /* CHIPPROJECTCONFIG_H */
@@ -942,6 +942,12 @@ void ApplicationInit()
     // supported clusters so that ZAP will generated the requisite code.
     emberAfEndpointEnableDisable(emberAfEndpointFromIndex(static_cast<uint16_t>(emberAfFixedEndpointCount() - 1)), false);
 
+    // Report the endpoints added below, and the PartsList changes they cause, once they are all set up.
+    {
+        DeviceLayer::StackLock lock;
+        emberAfBeginDynamicEndpointBatch();
+    }
+
     // Add light 1 -> will be mapped to ZCL endpoints 3
     AddDeviceEndpoint(&Light1, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes),
                       Span<DataVersion>(gLight1DataVersions), 1);
@@ -972,6 +978,11 @@ void ApplicationInit()
     AddDeviceEndpoint(&ActionLight4, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes),
                       Span<DataVersion>(gActionLight4DataVersions), 1);
 
+    {
+        DeviceLayer::StackLock lock;
+        emberAfCommitDynamicEndpointBatch();
+    }
+
     // Because the power source is on the same endpoint as the composed device, it needs to be explicitly added
     gDevices[CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT] = &ComposedPowerSource;
     // This provides power for the composed endpoint
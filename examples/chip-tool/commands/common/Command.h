@@ -71,6 +71,7 @@ enum ArgumentType
     VectorBool,
     Vector16,
     Vector32,
+    Vector64,
     VectorCustom,
     VectorString, // comma separated string items
 };
@@ -191,6 +192,7 @@ public:
 
     size_t AddArgument(const char * name, int64_t min, uint64_t max, std::vector<uint16_t> * value, const char * desc = "");
     size_t AddArgument(const char * name, int64_t min, uint64_t max, std::vector<uint32_t> * value, const char * desc = "");
+    size_t AddArgument(const char * name, int64_t min, uint64_t max, std::vector<uint64_t> * value, const char * desc = "");
     size_t AddArgument(const char * name, std::vector<CustomArgument *> * value, const char * desc = "");
     size_t AddArgument(const char * name, int64_t min, uint64_t max, chip::Optional<std::vector<bool>> * value,
                        const char * desc = "");
@@ -36,11 +36,13 @@ constexpr char kNOCKey[]            = "NOC";
 constexpr char kICACKey[]           = "ICAC";
 constexpr char kRCACKey[]           = "RCAC";
 constexpr char kIPKKey[]            = "IPK";
+constexpr char kNodeCountKey[]      = "nodeCount";
+constexpr char kFailureCountKey[]   = "failureCount";
 
 namespace {
 RemoteDataModelLoggerDelegate * gDelegate;
 
-CHIP_ERROR LogError(Json::Value & value, const chip::app::StatusIB & status)
+void StatusToJSON(Json::Value & value, const chip::app::StatusIB & status)
 {
     if (status.mClusterStatus.HasValue())
     {
@@ -55,19 +57,18 @@ CHIP_ERROR LogError(Json::Value & value, const chip::app::StatusIB & status)
     auto statusName    = status.mStatus;
     value[kErrorIdKey] = chip::to_underlying(statusName);
 #endif // CHIP_CONFIG_IM_STATUS_CODE_VERBOSE_FORMAT
+}
+
+CHIP_ERROR LogError(Json::Value & value, const chip::app::StatusIB & status)
+{
+    StatusToJSON(value, status);
 
     auto valueStr = chip::JsonToString(value);
     return gDelegate->LogJSON(valueStr.c_str());
 }
 
-} // namespace
-
-namespace RemoteDataModelLogger {
-CHIP_ERROR LogAttributeAsJSON(const chip::app::ConcreteDataAttributePath & path, chip::TLV::TLVReader * data)
+CHIP_ERROR AttributeToJSON(Json::Value & value, const chip::app::ConcreteDataAttributePath & path, chip::TLV::TLVReader * data)
 {
-    VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
-
-    Json::Value value;
     value[kClusterIdKey]   = path.mClusterId;
     value[kEndpointIdKey]  = path.mEndpointId;
     value[kAttributeIdKey] = path.mAttributeId;
@@ -78,12 +79,40 @@ CHIP_ERROR LogAttributeAsJSON(const chip::app::ConcreteDataAttributePath & path,
 
     chip::TLV::TLVReader reader;
     reader.Init(*data);
-    ReturnErrorOnFailure(chip::TlvToJson(reader, value));
+    return chip::TlvToJson(reader, value);
+}
+
+CHIP_ERROR StreamJSON(Json::Value & value)
+{
+    auto valueStr = chip::JsonToString(value);
+    return gDelegate->StreamJSON(valueStr.c_str());
+}
+
+} // namespace
+
+namespace RemoteDataModelLogger {
+CHIP_ERROR LogAttributeAsJSON(const chip::app::ConcreteDataAttributePath & path, chip::TLV::TLVReader * data)
+{
+    VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
+
+    Json::Value value;
+    ReturnErrorOnFailure(AttributeToJSON(value, path, data));
 
     auto valueStr = chip::JsonToString(value);
     return gDelegate->LogJSON(valueStr.c_str());
 }
 
+CHIP_ERROR LogAttributeAsJSON(chip::NodeId nodeId, const chip::app::ConcreteDataAttributePath & path, chip::TLV::TLVReader * data)
+{
+    VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
+
+    Json::Value value;
+    value[kNodeIdKey] = nodeId;
+    ReturnErrorOnFailure(AttributeToJSON(value, path, data));
+
+    return StreamJSON(value);
+}
+
 CHIP_ERROR LogErrorAsJSON(const chip::app::ConcreteDataAttributePath & path, const chip::app::StatusIB & status)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
@@ -96,6 +125,21 @@ CHIP_ERROR LogErrorAsJSON(const chip::app::ConcreteDataAttributePath & path, con
     return LogError(value, status);
 }
 
+CHIP_ERROR LogErrorAsJSON(chip::NodeId nodeId, const chip::app::ConcreteDataAttributePath & path,
+                          const chip::app::StatusIB & status)
+{
+    VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
+
+    Json::Value value;
+    value[kNodeIdKey]      = nodeId;
+    value[kClusterIdKey]   = path.mClusterId;
+    value[kEndpointIdKey]  = path.mEndpointId;
+    value[kAttributeIdKey] = path.mAttributeId;
+    StatusToJSON(value, status);
+
+    return StreamJSON(value);
+}
+
 CHIP_ERROR LogCommandAsJSON(const chip::app::ConcreteCommandPath & path, chip::TLV::TLVReader * data)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
@@ -165,6 +209,30 @@ CHIP_ERROR LogErrorAsJSON(const CHIP_ERROR & error)
     return LogError(value, status);
 }
 
+CHIP_ERROR LogErrorAsJSON(chip::NodeId nodeId, const CHIP_ERROR & error)
+{
+    VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
+
+    Json::Value value;
+    value[kNodeIdKey] = nodeId;
+    chip::app::StatusIB status;
+    status.InitFromChipError(error);
+    StatusToJSON(value, status);
+
+    return StreamJSON(value);
+}
+
+CHIP_ERROR LogNodesSummaryAsJSON(size_t nodeCount, size_t failureCount)
+{
+    VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
+
+    Json::Value value;
+    value[kNodeCountKey]    = static_cast<uint64_t>(nodeCount);
+    value[kFailureCountKey] = static_cast<uint64_t>(failureCount);
+
+    return StreamJSON(value);
+}
+
 CHIP_ERROR LogGetCommissionerNodeId(chip::NodeId value)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
@@ -29,6 +29,9 @@ class RemoteDataModelLoggerDelegate
 {
 public:
     CHIP_ERROR virtual LogJSON(const char *) = 0;
+    // Results that should reach the remote side as soon as they are available, instead of along with
+    // the response of the command that produced them.
+    CHIP_ERROR virtual StreamJSON(const char * json) { return LogJSON(json); }
     virtual ~RemoteDataModelLoggerDelegate(){};
 };
 
@@ -40,6 +43,12 @@ CHIP_ERROR LogErrorAsJSON(const chip::app::ConcreteCommandPath & path, const chi
 CHIP_ERROR LogEventAsJSON(const chip::app::EventHeader & header, chip::TLV::TLVReader * data);
 CHIP_ERROR LogErrorAsJSON(const chip::app::EventHeader & header, const chip::app::StatusIB & status);
 CHIP_ERROR LogErrorAsJSON(const CHIP_ERROR & error);
+// Results of commands targeting several nodes at once, tagged with the node they come from and streamed.
+CHIP_ERROR LogAttributeAsJSON(chip::NodeId nodeId, const chip::app::ConcreteDataAttributePath & path, chip::TLV::TLVReader * data);
+CHIP_ERROR LogErrorAsJSON(chip::NodeId nodeId, const chip::app::ConcreteDataAttributePath & path,
+                          const chip::app::StatusIB & status);
+CHIP_ERROR LogErrorAsJSON(chip::NodeId nodeId, const CHIP_ERROR & error);
+CHIP_ERROR LogNodesSummaryAsJSON(size_t nodeCount, size_t failureCount);
 CHIP_ERROR LogGetCommissionerNodeId(chip::NodeId value);
 CHIP_ERROR LogGetCommissionerRootCertificate(const char * value);
 CHIP_ERROR LogIssueNOCChain(const char * noc, const char * icac, const char * rcac, const char * ipk);
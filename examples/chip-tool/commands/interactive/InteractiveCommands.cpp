@@ -353,6 +353,16 @@ CHIP_ERROR InteractiveServerCommand::LogJSON(const char * json)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR InteractiveServerCommand::StreamJSON(const char * json)
+{
+    // Streamed results are sent on their own, marked as partial, rather than with the response of the
+    // command, which may even have been sent already.
+    std::stringstream content;
+    content << "{ \"partial\": true, \"results\": [" << json << "], \"logs\": [] }";
+    mWebSocketServer.Send(content.str().c_str());
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR InteractiveStartCommand::RunCommand()
 {
     read_history(GetHistoryFilePath().c_str());
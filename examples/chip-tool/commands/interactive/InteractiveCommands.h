@@ -83,6 +83,7 @@ public:
 
     /////////// RemoteDataModelLoggerDelegate interface /////////
     CHIP_ERROR LogJSON(const char * json) override;
+    CHIP_ERROR StreamJSON(const char * json) override;
 
 private:
     WebSocketServer mWebSocketServer;
@@ -0,0 +1,243 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "PipelinedReadCommand.h"
+
+#include "../clusters/DataModelLogger.h"
+#include "../common/RemoteDataModelLogger.h"
+
+#include <app/InteractionModelEngine.h>
+
+#include <algorithm>
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace {
+constexpr uint16_t kDefaultMaxInFlight        = 16;
+constexpr uint16_t kDefaultTimeoutPerRoundSecs = 20;
+} // namespace
+
+CHIP_ERROR PipelinedReadCommand::RunCommand()
+{
+    // With stream-results, the reads of the previous command may still be going on.
+    VerifyOrReturnError(!IsRunning(), CHIP_ERROR_BUSY);
+    VerifyOrReturnError(!mDestinationIds.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!mStreamResults.ValueOr(false) || IsInteractive(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(
+        InteractionModelConfig::GetAttributePaths(mEndpointIds, mClusterIds, mAttributeIds, NullOptional, mPathsConfig));
+
+    mReads.clear();
+    mPendingNodes.assign(mDestinationIds.begin(), mDestinationIds.end());
+    mIsFabricFiltered = mFabricFiltered.ValueOr(true);
+    mStreaming        = mStreamResults.ValueOr(false);
+    mMaxInFlightCount = mMaxInFlight.ValueOr(kDefaultMaxInFlight);
+    mInFlightCount    = 0;
+    mNodeCount        = mPendingNodes.size();
+    mFailureCount     = 0;
+    mFirstError       = CHIP_NO_ERROR;
+
+    ChipLogProgress(chipTool, "Reading from %u nodes, %u at a time", static_cast<unsigned>(mNodeCount),
+                    static_cast<unsigned>(mMaxInFlightCount));
+    // The reads may all complete within StartReads(), which then leaves the exit status to this method.
+    bool streaming = mStreaming;
+    StartReads();
+
+    if (streaming)
+    {
+        SetCommandExitStatus(CHIP_NO_ERROR);
+    }
+    return CHIP_NO_ERROR;
+}
+
+chip::System::Clock::Timeout PipelinedReadCommand::GetWaitDuration() const
+{
+    if (mTimeout.HasValue())
+    {
+        return chip::System::Clock::Seconds16(mTimeout.Value());
+    }
+
+    size_t maxInFlight = mMaxInFlight.ValueOr(kDefaultMaxInFlight);
+    size_t rounds      = std::max<size_t>(1, (mDestinationIds.size() + maxInFlight - 1) / maxInFlight);
+    size_t timeout     = std::min<size_t>(UINT16_MAX, rounds * kDefaultTimeoutPerRoundSecs);
+    return chip::System::Clock::Seconds16(static_cast<uint16_t>(timeout));
+}
+
+void PipelinedReadCommand::Cleanup()
+{
+    // Destroying the reads cancels their pending session establishment callbacks and interactions.
+    mPendingNodes.clear();
+    mReads.clear();
+    mInFlightCount = 0;
+    mStreaming     = false;
+}
+
+void PipelinedReadCommand::StartReads()
+{
+    // Reads that finish right away call back into this method; let the outermost call start the next ones.
+    VerifyOrReturn(!mStartingReads);
+    mStartingReads = true;
+
+    while (mInFlightCount < mMaxInFlightCount && !mPendingNodes.empty())
+    {
+        auto nodeId = mPendingNodes.front();
+        mPendingNodes.pop_front();
+
+        mReads.push_back(std::make_unique<NodeRead>(*this, nodeId));
+        mInFlightCount++;
+        LogErrorOnFailure(mReads.back()->Start());
+    }
+
+    mStartingReads = false;
+    VerifyOrReturn(!IsRunning());
+
+    ChipLogProgress(chipTool, "Read from %u nodes, %u failed", static_cast<unsigned>(mNodeCount),
+                    static_cast<unsigned>(mFailureCount));
+    LogErrorOnFailure(RemoteDataModelLogger::LogNodesSummaryAsJSON(mNodeCount, mFailureCount));
+
+    // With stream-results, the command has completed already.
+    if (!mStreaming)
+    {
+        SetCommandExitStatus(mFirstError);
+    }
+    mStreaming = false;
+}
+
+void PipelinedReadCommand::OnNodeReadDone(NodeId nodeId, CHIP_ERROR error)
+{
+    mInFlightCount--;
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipTool, "Read from node 0x" ChipLogFormatX64 " failed: %" CHIP_ERROR_FORMAT, ChipLogValueX64(nodeId),
+                     error.Format());
+        LogErrorOnFailure(RemoteDataModelLogger::LogErrorAsJSON(nodeId, error));
+
+        mFailureCount++;
+        if (mFirstError == CHIP_NO_ERROR)
+        {
+            mFirstError = error;
+        }
+    }
+
+    StartReads();
+}
+
+PipelinedReadCommand::NodeRead::NodeRead(PipelinedReadCommand & command, NodeId nodeId) :
+    mCommand(command), mNodeId(nodeId), mOnDeviceConnectedCallback(OnDeviceConnectedFn, this),
+    mOnDeviceConnectionFailureCallback(OnDeviceConnectionFailureFn, this), mBufferedReadAdapter(*this)
+{}
+
+CHIP_ERROR PipelinedReadCommand::NodeRead::Start()
+{
+    CHIP_ERROR err = mCommand.CurrentCommissioner().GetConnectedDevice(mNodeId, &mOnDeviceConnectedCallback,
+                                                                      &mOnDeviceConnectionFailureCallback);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Neither callback will be called.
+        Finish(err);
+    }
+    return err;
+}
+
+CHIP_ERROR PipelinedReadCommand::NodeRead::SendReadRequest(Messaging::ExchangeManager & exchangeMgr,
+                                                           const SessionHandle & sessionHandle)
+{
+    ReadPrepareParams params(sessionHandle);
+    params.mpAttributePathParamsList    = mCommand.mPathsConfig.attributePathParams.get();
+    params.mAttributePathParamsListSize = mCommand.mPathsConfig.count;
+    params.mIsFabricFiltered            = mCommand.mIsFabricFiltered;
+
+    mReadClient = std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &exchangeMgr, mBufferedReadAdapter,
+                                               ReadClient::InteractionType::Read);
+    CHIP_ERROR err = mReadClient->SendRequest(params);
+    if (err != CHIP_NO_ERROR)
+    {
+        mReadClient.reset();
+    }
+    return err;
+}
+
+void PipelinedReadCommand::NodeRead::Finish(CHIP_ERROR error)
+{
+    VerifyOrReturn(!mFinished);
+    mFinished = true;
+    mCommand.OnNodeReadDone(mNodeId, error);
+}
+
+void PipelinedReadCommand::NodeRead::OnAttributeData(const ConcreteDataAttributePath & path, TLV::TLVReader * data,
+                                                     const StatusIB & status)
+{
+    CHIP_ERROR error = status.ToChipError();
+    if (CHIP_NO_ERROR != error)
+    {
+        LogErrorOnFailure(RemoteDataModelLogger::LogErrorAsJSON(mNodeId, path, status));
+
+        ChipLogError(chipTool, "Node 0x" ChipLogFormatX64 ": Response Failure: %s", ChipLogValueX64(mNodeId),
+                     chip::ErrorStr(error));
+        mError = error;
+        return;
+    }
+
+    if (data == nullptr)
+    {
+        ChipLogError(chipTool, "Node 0x" ChipLogFormatX64 ": Response Failure: No Data", ChipLogValueX64(mNodeId));
+        mError = CHIP_ERROR_INTERNAL;
+        return;
+    }
+
+    LogErrorOnFailure(RemoteDataModelLogger::LogAttributeAsJSON(mNodeId, path, data));
+
+    ChipLogProgress(chipTool, "Node 0x" ChipLogFormatX64 ":", ChipLogValueX64(mNodeId));
+    error = DataModelLogger::LogAttribute(path, data);
+    if (CHIP_NO_ERROR != error)
+    {
+        ChipLogError(chipTool, "Node 0x" ChipLogFormatX64 ": Response Failure: Can not decode Data", ChipLogValueX64(mNodeId));
+        mError = error;
+        return;
+    }
+}
+
+void PipelinedReadCommand::NodeRead::OnError(CHIP_ERROR error)
+{
+    mError = error;
+}
+
+void PipelinedReadCommand::NodeRead::OnDone(ReadClient * apReadClient)
+{
+    mReadClient.reset();
+    Finish(mError);
+}
+
+void PipelinedReadCommand::NodeRead::OnDeviceConnectedFn(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                         const SessionHandle & sessionHandle)
+{
+    auto * read = reinterpret_cast<NodeRead *>(context);
+    VerifyOrReturn(read != nullptr, ChipLogError(chipTool, "OnDeviceConnectedFn: context is null"));
+
+    CHIP_ERROR err = read->SendReadRequest(exchangeMgr, sessionHandle);
+    VerifyOrReturn(CHIP_NO_ERROR == err, read->Finish(err));
+}
+
+void PipelinedReadCommand::NodeRead::OnDeviceConnectionFailureFn(void * context, const ScopedNodeId & peerId, CHIP_ERROR err)
+{
+    auto * read = reinterpret_cast<NodeRead *>(context);
+    VerifyOrReturn(read != nullptr, ChipLogError(chipTool, "OnDeviceConnectionFailureFn: context is null"));
+
+    read->Finish(err);
+}
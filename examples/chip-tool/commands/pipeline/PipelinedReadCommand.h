@@ -0,0 +1,136 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../common/CHIPCommand.h"
+
+#include <app/BufferedReadCallback.h>
+#include <app/ReadClient.h>
+#include <app/tests/suites/commands/interaction_model/InteractionModel.h>
+#include <lib/core/CHIPCallback.h>
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+/**
+ * Reads the same attributes from many nodes, with a bounded number of nodes being connected to or
+ * read from at once.
+ *
+ * Sessions come from the commissioner's CASESessionManager, so nodes that already have a session do not
+ * establish a new one, and results are streamed (see RemoteDataModelLoggerDelegate::StreamJSON) as each
+ * node answers, tagged with its node id.
+ */
+class PipelinedReadCommand : public CHIPCommand
+{
+public:
+    PipelinedReadCommand(CredentialIssuerCommands * credsIssuerConfig) :
+        CHIPCommand("read-by-id", credsIssuerConfig, "Read attributes from many nodes, with several reads in flight at once.")
+    {
+        AddArgument("cluster-ids", 0, UINT32_MAX, &mClusterIds,
+                    "Comma-separated list of cluster ids to read from (e.g. \"6\" or \"8,0x201\").\n  Allowed to be 0xFFFFFFFF to "
+                    "indicate a wildcard cluster.");
+        AddArgument("attribute-ids", 0, UINT32_MAX, &mAttributeIds,
+                    "Comma-separated list of attribute ids to read (e.g. \"0\" or \"1,0xFFFC,0xFFFD\").\n  Allowed to be "
+                    "0xFFFFFFFF to indicate a wildcard attribute.");
+        AddArgument("destination-ids", 0, UINT64_MAX, &mDestinationIds,
+                    "Comma-separated list of node ids to read from (e.g. \"1,2,0x10\").");
+        AddArgument("endpoint-ids", 0, UINT16_MAX, &mEndpointIds,
+                    "Comma-separated list of endpoint ids (e.g. \"1\" or \"1,2,3\").\n  Allowed to be 0xFFFF to indicate a "
+                    "wildcard endpoint.");
+        AddArgument("max-in-flight", 1, UINT16_MAX, &mMaxInFlight,
+                    "Maximum number of nodes being connected to or read from at once. Defaults to 16.");
+        AddArgument("fabric-filtered", 0, 1, &mFabricFiltered,
+                    "Boolean indicating whether to do fabric-filtered reads. Defaults to true.");
+        AddArgument("stream-results", 0, 1, &mStreamResults,
+                    "Interactive mode only. If true, the command completes as soon as the reads are started and the "
+                    "results keep being streamed until every node has answered. Defaults to false.");
+        AddArgument("timeout", 0, UINT16_MAX, &mTimeout,
+                    "Time, in seconds, before this command is considered to have timed out. Defaults to 20 seconds for "
+                    "every max-in-flight nodes.");
+    }
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override;
+    void Cleanup() override;
+    bool DeferInteractiveCleanup() override { return mStreaming && IsRunning(); }
+
+private:
+    class NodeRead : public chip::app::ReadClient::Callback
+    {
+    public:
+        NodeRead(PipelinedReadCommand & command, chip::NodeId nodeId);
+
+        CHIP_ERROR Start();
+
+        /////////// ReadClient Callback Interface /////////
+        void OnAttributeData(const chip::app::ConcreteDataAttributePath & path, chip::TLV::TLVReader * data,
+                             const chip::app::StatusIB & status) override;
+        void OnError(CHIP_ERROR error) override;
+        void OnDone(chip::app::ReadClient * apReadClient) override;
+
+    private:
+        static void OnDeviceConnectedFn(void * context, chip::Messaging::ExchangeManager & exchangeMgr,
+                                        const chip::SessionHandle & sessionHandle);
+        static void OnDeviceConnectionFailureFn(void * context, const chip::ScopedNodeId & peerId, CHIP_ERROR error);
+
+        CHIP_ERROR SendReadRequest(chip::Messaging::ExchangeManager & exchangeMgr, const chip::SessionHandle & sessionHandle);
+        void Finish(CHIP_ERROR error);
+
+        PipelinedReadCommand & mCommand;
+        const chip::NodeId mNodeId;
+        CHIP_ERROR mError = CHIP_NO_ERROR;
+        bool mFinished    = false;
+
+        chip::Callback::Callback<chip::OnDeviceConnected> mOnDeviceConnectedCallback;
+        chip::Callback::Callback<chip::OnDeviceConnectionFailure> mOnDeviceConnectionFailureCallback;
+        chip::app::BufferedReadCallback mBufferedReadAdapter;
+        std::unique_ptr<chip::app::ReadClient> mReadClient;
+    };
+
+    bool IsRunning() const { return mInFlightCount > 0 || !mPendingNodes.empty(); }
+    void StartReads();
+    void OnNodeReadDone(chip::NodeId nodeId, CHIP_ERROR error);
+
+    // Arguments; these are reset once the command completes, which may happen before the reads do.
+    std::vector<chip::ClusterId> mClusterIds;
+    std::vector<chip::AttributeId> mAttributeIds;
+    std::vector<chip::NodeId> mDestinationIds;
+    std::vector<chip::EndpointId> mEndpointIds;
+    chip::Optional<uint16_t> mMaxInFlight;
+    chip::Optional<bool> mFabricFiltered;
+    chip::Optional<bool> mStreamResults;
+    chip::Optional<uint16_t> mTimeout;
+
+    // State of the reads in progress.
+    InteractionModelConfig::AttributePathsConfig mPathsConfig;
+    bool mIsFabricFiltered   = true;
+    bool mStreaming          = false;
+    bool mStartingReads      = false;
+    size_t mMaxInFlightCount = 0;
+    size_t mInFlightCount    = 0;
+    size_t mNodeCount        = 0;
+    size_t mFailureCount     = 0;
+    CHIP_ERROR mFirstError   = CHIP_NO_ERROR;
+    std::deque<chip::NodeId> mPendingNodes;
+    // Finished reads are only released when the next command starts or on cleanup, as they can finish
+    // from within their own callbacks.
+    std::vector<std::unique_ptr<NodeRead>> mReads;
+};
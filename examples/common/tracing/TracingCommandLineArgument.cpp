@@ -27,6 +27,7 @@
 #include <tracing/perfetto/simple_initialize.h> // nogncheck
 #endif
 
+#include <fstream>
 #include <memory>
 #include <string>
 
@@ -74,6 +75,15 @@ void TracingSetup::EnableTracingFor(const char * cliArg)
             }
             chip::Tracing::Register(mJsonBackend);
         }
+        else if (StartsWith(value, "metrics:"))
+        {
+            mMetricsPath = std::string(value.data() + 8, value.size() - 8);
+            if (!mMetricsBackend)
+            {
+                mMetricsBackend = std::make_unique<chip::Tracing::Metrics::MetricsBackend>();
+                chip::Tracing::Register(*mMetricsBackend);
+            }
+        }
 #if ENABLE_PERFETTO_TRACING
         else if (value.data_equal(CharSpan::fromCharString("perfetto")))
         {
@@ -113,6 +123,29 @@ void TracingSetup::StopTracing()
 #endif
 
     chip::Tracing::Unregister(mJsonBackend);
+
+    if (mMetricsBackend)
+    {
+        chip::Tracing::Unregister(*mMetricsBackend);
+        DumpMetrics();
+        mMetricsBackend.reset();
+    }
+}
+
+void TracingSetup::DumpMetrics()
+{
+    VerifyOrReturn(mMetricsBackend);
+
+    std::ofstream prometheus(mMetricsPath + ".prom", std::ios_base::out | std::ios_base::trunc);
+    mMetricsBackend->WritePrometheus(prometheus);
+
+    std::ofstream chromeTrace(mMetricsPath + ".json", std::ios_base::out | std::ios_base::trunc);
+    mMetricsBackend->WriteChromeTrace(chromeTrace);
+
+    if (!prometheus || !chromeTrace)
+    {
+        ChipLogError(AppServer, "Failed to write the trace metrics to %s", mMetricsPath.c_str());
+    }
 }
 
 } // namespace CommandLineApp
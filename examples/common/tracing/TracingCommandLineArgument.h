@@ -20,6 +20,10 @@
 #include "tracing/enabled_features.h"
 
 #include <tracing/json/json_tracing.h>
+#include <tracing/metrics/metrics_tracing.h>
+
+#include <memory>
+#include <string>
 
 #if ENABLE_PERFETTO_TRACING
 #include <tracing/perfetto/file_output.h>      // nogncheck
@@ -29,9 +33,9 @@
 /// A string with supported command line tracing targets
 /// to be pretty-printed in help strings if needed
 #if ENABLE_PERFETTO_TRACING
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, perfetto, perfetto:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, metrics:<path>, perfetto, perfetto:<path>"
 #else
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, metrics:<path>"
 #endif
 
 namespace chip {
@@ -56,9 +60,17 @@ public:
     /// to unregister tracing backends
     void StopTracing();
 
+    /// Write the aggregated metrics to <path>.prom and the recent events
+    /// to <path>.json, if "metrics:<path>" tracing is enabled.
+    void DumpMetrics();
+
 private:
     ::chip::Tracing::Json::JsonBackend mJsonBackend;
 
+    // Large, so only allocated when enabled.
+    std::unique_ptr<::chip::Tracing::Metrics::MetricsBackend> mMetricsBackend;
+    std::string mMetricsPath;
+
 #if ENABLE_PERFETTO_TRACING
     chip::Tracing::Perfetto::FileTraceOutput mPerfettoFileOutput;
     chip::Tracing::Perfetto::PerfettoBackend mPerfettoBackend;
@@ -32,6 +32,10 @@ namespace {
 lws * gWebSocketInstance = nullptr;
 std::deque<std::string> gMessageQueue;
 
+// The context of the running server, used to wake up its service loop when a
+// message is queued from another thread. Protected by gMutex.
+lws_context * gContext = nullptr;
+
 // This mutex protect the global gMessageQueue instance such that messages
 // can be added/removed from multiple threads.
 std::mutex gMutex;
@@ -187,6 +191,11 @@ CHIP_ERROR WebSocketServer::Run(chip::Optional<uint16_t> port, WebSocketServerDe
     mRunning  = true;
     mDelegate = delegate;
 
+    {
+        std::lock_guard<std::mutex> lock(gMutex);
+        gContext = context;
+    }
+
     while (mRunning)
     {
         lws_service(context, -1);
@@ -197,6 +206,11 @@ CHIP_ERROR WebSocketServer::Run(chip::Optional<uint16_t> port, WebSocketServerDe
             lws_callback_on_writable(gWebSocketInstance);
         }
     }
+
+    {
+        std::lock_guard<std::mutex> lock(gMutex);
+        gContext = nullptr;
+    }
     lws_context_destroy(context);
     return CHIP_NO_ERROR;
 }
@@ -215,4 +229,11 @@ void WebSocketServer::Send(const char * msg)
 {
     std::lock_guard<std::mutex> lock(gMutex);
     gMessageQueue.push_back(msg);
+
+    // Messages sent from outside of the service loop, e.g. results streamed from the Matter thread,
+    // would otherwise wait for the next incoming message.
+    if (gContext != nullptr)
+    {
+        lws_cancel_service(gContext);
+    }
 }
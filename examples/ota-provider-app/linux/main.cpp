@@ -23,6 +23,7 @@
 #include <app/util/util.h>
 #include <json/json.h>
 #include <ota-provider-common/BdxOtaSender.h>
+#include <ota-provider-common/BdxOtaSenderPool.h>
 #include <ota-provider-common/OTAProviderExample.h>
 
 #include "AppMain.h"
@@ -47,6 +48,7 @@ constexpr uint16_t kOptionUpdateAction              = 'a';
 constexpr uint16_t kOptionUserConsentNeeded         = 'c';
 constexpr uint16_t kOptionFilepath                  = 'f';
 constexpr uint16_t kOptionImageUri                  = 'i';
+constexpr uint16_t kOptionMaxConcurrentTransfers     = 'm';
 constexpr uint16_t kOptionOtaImageList              = 'o';
 constexpr uint16_t kOptionDelayedApplyActionTimeSec = 'p';
 constexpr uint16_t kOptionQueryImageStatus          = 'q';
@@ -57,6 +59,7 @@ constexpr uint16_t kOptionIgnoreApplyUpdate         = 'y';
 constexpr uint16_t kOptionPollInterval              = 'P';
 
 OTAProviderExample gOtaProvider;
+BdxOtaSenderPool gBdxOtaSenderPool;
 chip::ota::DefaultOTAProviderUserConsent gUserConsentProvider;
 
 // Global variables used for passing the CLI arguments to the OTAProviderExample object
@@ -72,6 +75,7 @@ static bool gUserConsentNeeded                       = false;
 static uint32_t gIgnoreQueryImageCount               = 0;
 static uint32_t gIgnoreApplyUpdateCount              = 0;
 static uint32_t gPollInterval                        = 0;
+static uint32_t gMaxConcurrentTransfers              = 0;
 
 // Parses the JSON filepath and extracts DeviceSoftwareVersionModel parameters
 static bool ParseJsonFileAndPopulateCandidates(const char * filepath,
@@ -245,6 +249,14 @@ bool HandleOptions(const char * aProgram, OptionSet * aOptions, int aIdentifier,
     case kOptionPollInterval:
         gPollInterval = static_cast<uint32_t>(strtoul(aValue, NULL, 0));
         break;
+    case kOptionMaxConcurrentTransfers:
+        gMaxConcurrentTransfers = static_cast<uint32_t>(strtoul(aValue, NULL, 0));
+        if (gMaxConcurrentTransfers == 0)
+        {
+            PrintArgError("%s: ERROR: maxConcurrentTransfers must be greater than 0\n", aProgram);
+            retval = false;
+        }
+        break;
 
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
@@ -260,6 +272,7 @@ OptionDef cmdLineOptionsDef[] = {
     { "userConsentNeeded", chip::ArgParser::kNoArgument, kOptionUserConsentNeeded },
     { "filepath", chip::ArgParser::kArgumentRequired, kOptionFilepath },
     { "imageUri", chip::ArgParser::kArgumentRequired, kOptionImageUri },
+    { "maxConcurrentTransfers", chip::ArgParser::kArgumentRequired, kOptionMaxConcurrentTransfers },
     { "otaImageList", chip::ArgParser::kArgumentRequired, kOptionOtaImageList },
     { "delayedApplyActionTimeSec", chip::ArgParser::kArgumentRequired, kOptionDelayedApplyActionTimeSec },
     { "queryImageStatus", chip::ArgParser::kArgumentRequired, kOptionQueryImageStatus },
@@ -285,6 +298,10 @@ OptionSet cmdLineOptions = { HandleOptions, cmdLineOptionsDef, "PROGRAM OPTIONS"
                              "  -i, --imageUri <uri>\n"
                              "        Value for the ImageURI field in the QueryImageResponse.\n"
                              "        If none is supplied, a valid URI is generated.\n"
+                             "  -m, --maxConcurrentTransfers <count>\n"
+                             "        Serve up to <count> requestors concurrently. When all transfers are in use,\n"
+                             "        requestors get a busy status with a DelayedActionTime based on the current load.\n"
+                             "        If not supplied, a single transfer is served at a time.\n"
                              "  -o, --otaImageList <file path>\n"
                              "        Path to a file containing a list of OTA images\n"
                              "  -p, --delayedApplyActionTimeSec <time in seconds>\n"
@@ -316,10 +333,22 @@ void ApplicationInit()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    BdxOtaSender * bdxOtaSender = gOtaProvider.GetBdxOtaSender();
-    VerifyOrReturn(bdxOtaSender != nullptr);
+    chip::Messaging::UnsolicitedMessageHandler * bdxHandler = gOtaProvider.GetBdxOtaSender();
+    if (gMaxConcurrentTransfers > 0)
+    {
+        err = gBdxOtaSenderPool.Init(gMaxConcurrentTransfers);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(SoftwareUpdate, "Failed to allocate BDX senders: %" CHIP_ERROR_FORMAT, err.Format());
+            return;
+        }
+        gOtaProvider.SetTransferScheduler(&gBdxOtaSenderPool);
+        bdxHandler = &gBdxOtaSenderPool;
+    }
+
+    VerifyOrReturn(bdxHandler != nullptr);
     err = chip::Server::GetInstance().GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(chip::Protocols::BDX::Id,
-                                                                                                        bdxOtaSender);
+                                                                                                        bdxHandler);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogDetail(SoftwareUpdate, "RegisterUnsolicitedMessageHandler failed: %s", chip::ErrorStr(err));
@@ -380,7 +409,14 @@ void ApplicationInit()
     chip::app::Clusters::OTAProvider::SetDelegate(kOtaProviderEndpoint, &gOtaProvider);
 }
 
-void ApplicationShutdown() {}
+void ApplicationShutdown()
+{
+    if (gMaxConcurrentTransfers > 0)
+    {
+        gBdxOtaSenderPool.LogStats();
+        gBdxOtaSenderPool.Shutdown();
+    }
+}
 
 int main(int argc, char * argv[])
 {
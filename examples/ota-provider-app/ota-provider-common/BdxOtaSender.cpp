@@ -24,8 +24,6 @@
 #include <messaging/Flags.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
-#include <fstream>
-
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
 using chip::bdx::TransferSession;
@@ -57,10 +55,25 @@ CHIP_ERROR BdxOtaSender::InitializeTransfer(chip::FabricIndex fabricIndex, chip:
     }
     mFabricIndex.SetValue(fabricIndex);
     mNodeId.SetValue(nodeId);
-    mInitialized = true;
+    mInitialized     = true;
+    mInitializedTime = chip::System::SystemClock().GetMonotonicTimestamp();
     return CHIP_NO_ERROR;
 }
 
+void BdxOtaSender::CancelPendingTransfer()
+{
+    VerifyOrReturn(mInitialized && !HasTransferStarted());
+    Reset();
+}
+
+uint64_t BdxOtaSender::GetBytesRemaining() const
+{
+    VerifyOrReturnValue(mImage, 0);
+
+    uint64_t length = (mTransfer.GetTransferLength() > 0) ? mTransfer.GetTransferLength() : mImage->GetSize();
+    return (length > mNumBytesSent) ? (length - mNumBytesSent) : 0;
+}
+
 void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -103,6 +116,28 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         break;
     }
     case TransferSession::OutputEventType::kInitReceived: {
+        // Store the file designator used during block query
+        uint16_t fdl       = 0;
+        const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
+        if (fdl >= chip::bdx::kMaxFileDesignatorLen)
+        {
+            ChipLogError(BDX, "Cannot store file designator with length = %d", fdl);
+            mTransfer.RejectTransfer(StatusCode::kFileDesignatorUnknown);
+            return;
+        }
+        memcpy(mFileDesignator, fd, fdl);
+        mFileDesignator[fdl] = 0;
+        mTransferStartTime   = chip::System::SystemClock().GetMonotonicTimestamp();
+
+        // Load the image (or share an already loaded copy) once for the whole transfer
+        err = OTAImageStore::Instance().GetImage(mFileDesignator, mImage);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(BDX, "OTA file open failed: %" CHIP_ERROR_FORMAT, err.Format());
+            mTransfer.RejectTransfer(StatusCode::kFileDesignatorUnknown);
+            return;
+        }
+
         // TransferSession will automatically reject a transfer if there are no
         // common supported control modes. It will also default to the smaller
         // block size.
@@ -111,16 +146,8 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
         acceptData.StartOffset  = mTransfer.GetStartOffset();
         acceptData.Length       = mTransfer.GetTransferLength();
-        VerifyOrReturn(mTransfer.AcceptTransfer(acceptData) == CHIP_NO_ERROR,
-                       ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
-
-        // Store the file designator used during block query
-        uint16_t fdl       = 0;
-        const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
-        VerifyOrReturn(fdl < chip::bdx::kMaxFileDesignatorLen,
-                       ChipLogError(BDX, "Cannot store file designator with length = %d", fdl));
-        memcpy(mFileDesignator, fd, fdl);
-        mFileDesignator[fdl] = 0;
+        err                     = mTransfer.AcceptTransfer(acceptData);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
 
         break;
     }
@@ -136,37 +163,29 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
             bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - mNumBytesSent);
         }
 
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
-        if (blockBuf.IsNull())
-        {
-            // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
-            return;
-        }
-
-        std::ifstream otaFile(mFileDesignator, std::ifstream::in);
-        if (!otaFile.good())
+        if (!mImage)
         {
-            ChipLogError(BDX, "OTA file open failed");
+            ChipLogError(BDX, "OTA file not loaded");
             mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
             return;
         }
 
-        otaFile.seekg(mNumBytesSent);
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        if (!(otaFile.good() || otaFile.eof()))
+        // PrepareBlock() copies the data into the outgoing message, so the block is handed over straight from the image cache.
+        chip::ByteSpan block;
+        err = mImage->ReadBlock(mNumBytesSent, bytesToRead, block);
+        if (err != CHIP_NO_ERROR)
         {
-            ChipLogError(BDX, "OTA file read failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+            ChipLogError(BDX, "OTA file read failed: %" CHIP_ERROR_FORMAT, err.Format());
+            mTransfer.AbortTransfer(StatusCode::kUnknown);
             return;
         }
 
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
+        blockData.Data   = block.data();
+        blockData.Length = block.size();
         blockData.IsEof  = (blockData.Length < blockSize) ||
-            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
+            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength()) ||
+            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mImage->GetSize());
         mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + blockData.Length);
-        otaFile.close();
 
         err = mTransfer.PrepareBlock(blockData);
         if (err != CHIP_NO_ERROR)
@@ -180,7 +199,8 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         break;
     case TransferSession::OutputEventType::kAckEOFReceived:
         ChipLogDetail(BDX, "Transfer completed, got AckEOF");
-        mStopPolling = true; // Stop polling the TransferSession only after receiving BlockAckEOF
+        mStopPolling       = true; // Stop polling the TransferSession only after receiving BlockAckEOF
+        mTransferCompleted = true;
         Reset();
         break;
     case TransferSession::OutputEventType::kStatusReceived:
@@ -210,6 +230,22 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
  */
 void BdxOtaSender::Reset()
 {
+    if (mTransferStartTime.count() != 0)
+    {
+        TransferMetrics metrics;
+        metrics.bytesSent = mNumBytesSent;
+        metrics.duration  = chip::System::SystemClock().GetMonotonicTimestamp() - mTransferStartTime;
+        metrics.completed = mTransferCompleted;
+
+        ChipLogProgress(BDX, "Transfer %s: %" PRIu64 " bytes in %" PRIu64 " ms", metrics.completed ? "completed" : "aborted",
+                        metrics.bytesSent, static_cast<uint64_t>(metrics.duration.count()));
+
+        if (mObserver != nullptr)
+        {
+            mObserver->OnTransferFinished(*this, metrics);
+        }
+    }
+
     mFabricIndex.ClearValue();
     mNodeId.ClearValue();
     Responder::ResetTransfer();
@@ -219,7 +255,11 @@ void BdxOtaSender::Reset()
         mExchangeCtx = nullptr;
     }
 
-    mInitialized  = false;
-    mNumBytesSent = 0;
+    mInitialized       = false;
+    mTransferCompleted = false;
+    mNumBytesSent      = 0;
+    mInitializedTime   = chip::System::Clock::kZero;
+    mTransferStartTime = chip::System::Clock::kZero;
+    mImage.reset();
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
 }
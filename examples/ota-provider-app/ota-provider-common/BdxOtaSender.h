@@ -15,19 +15,66 @@
  *    limitations under the License.
  */
 
+#include <ota-provider-common/OTAImageStore.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/bdx/TransferFacilitator.h>
+#include <system/SystemClock.h>
+
+#include <memory>
 
 #pragma once
 
 class BdxOtaSender : public chip::bdx::Responder
 {
 public:
+    // Statistics of a single transfer, reported when the transfer ends
+    struct TransferMetrics
+    {
+        uint64_t bytesSent = 0;
+        chip::System::Clock::Milliseconds64 duration{ 0 };
+        bool completed = false; // true if the requestor acknowledged the final block
+    };
+
+    class TransferObserver
+    {
+    public:
+        virtual ~TransferObserver() = default;
+
+        // Called when a transfer that has been initiated by the requestor ends, successfully or not.
+        virtual void OnTransferFinished(BdxOtaSender & sender, const TransferMetrics & metrics) = 0;
+    };
+
     BdxOtaSender();
 
     // Initializes BDX transfer-related metadata. Should always be called first.
     CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
 
+    // Releases a transfer that has been initialized but whose requestor never started it.
+    void CancelPendingTransfer();
+
+    void SetTransferObserver(TransferObserver * observer) { mObserver = observer; }
+
+    // Returns true if the sender has been initialized for a requestor, whether or not the BDX transfer has started.
+    bool IsInitialized() const { return mInitialized; }
+
+    // Returns true once the requestor has sent the first BDX message of the transfer.
+    bool HasTransferStarted() const { return mExchangeCtx != nullptr || mTransferStartTime.count() != 0; }
+
+    bool IsInitializedFor(chip::FabricIndex fabricIndex, chip::NodeId nodeId) const
+    {
+        return mInitialized && mFabricIndex.ValueOr(chip::kUndefinedFabricIndex) == fabricIndex &&
+            mNodeId.ValueOr(chip::kUndefinedNodeId) == nodeId;
+    }
+
+    uint32_t GetBytesSent() const { return mNumBytesSent; }
+
+    // Returns the number of bytes left to send, or 0 if the size of the transfer is not known yet.
+    uint64_t GetBytesRemaining() const;
+
+    // Monotonic time at which the sender was initialized, or at which the transfer started if it has.
+    chip::System::Clock::Timestamp GetInitializedTime() const { return mInitializedTime; }
+    chip::System::Clock::Timestamp GetTransferStartTime() const { return mTransferStartTime; }
+
 private:
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
@@ -37,10 +84,21 @@ private:
     // Null-terminated string representing file designator
     char mFileDesignator[chip::bdx::kMaxFileDesignatorLen];
 
+    // Image being served, shared with any other transfer of the same file
+    std::shared_ptr<OTAImage> mImage;
+
     uint32_t mNumBytesSent = 0;
 
     bool mInitialized = false;
 
+    bool mTransferCompleted = false;
+
+    chip::System::Clock::Timestamp mInitializedTime{ 0 };
+
+    chip::System::Clock::Timestamp mTransferStartTime{ 0 };
+
+    TransferObserver * mObserver = nullptr;
+
     chip::Optional<chip::FabricIndex> mFabricIndex;
 
     chip::Optional<chip::NodeId> mNodeId;
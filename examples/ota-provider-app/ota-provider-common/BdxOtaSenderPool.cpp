@@ -0,0 +1,312 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/BdxOtaSenderPool.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <algorithm>
+#include <new>
+
+using chip::BitFlags;
+using chip::FabricIndex;
+using chip::NodeId;
+using chip::bdx::TransferControlFlags;
+using chip::Messaging::ExchangeContext;
+using chip::Messaging::ExchangeDelegate;
+using chip::System::Clock::Milliseconds64;
+using chip::System::Clock::Timestamp;
+
+constexpr chip::System::Clock::Seconds16 BdxOtaSenderPool::kReservationTimeout;
+constexpr chip::System::Clock::Seconds16 BdxOtaSenderPool::kDefaultTransferDuration;
+
+CHIP_ERROR BdxOtaSenderPool::Init(size_t maxConcurrentTransfers)
+{
+    VerifyOrReturnError(mSenders.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(maxConcurrentTransfers > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mSenders.reserve(maxConcurrentTransfers);
+    for (size_t i = 0; i < maxConcurrentTransfers; i++)
+    {
+        std::unique_ptr<BdxOtaSender> sender(new (std::nothrow) BdxOtaSender());
+        VerifyOrReturnError(sender, CHIP_ERROR_NO_MEMORY);
+        sender->SetTransferObserver(this);
+        mSenders.push_back(std::move(sender));
+    }
+
+    ChipLogProgress(SoftwareUpdate, "Serving up to %u concurrent OTA transfers", static_cast<unsigned>(maxConcurrentTransfers));
+    return CHIP_NO_ERROR;
+}
+
+void BdxOtaSenderPool::Shutdown()
+{
+    chip::DeviceLayer::SystemLayer().CancelTimer(HandleReservationExpiry, this);
+}
+
+size_t BdxOtaSenderPool::GetActiveTransferCount() const
+{
+    return static_cast<size_t>(std::count_if(mSenders.begin(), mSenders.end(),
+                                             [](const std::unique_ptr<BdxOtaSender> & sender) { return sender->IsInitialized(); }));
+}
+
+void BdxOtaSenderPool::LogStats() const
+{
+    ChipLogProgress(SoftwareUpdate,
+                    "OTA transfers: active %u (peak %" PRIu32 "), completed %" PRIu32 ", failed %" PRIu32
+                    ", expired reservations %" PRIu32 ", busy responses %" PRIu32,
+                    static_cast<unsigned>(GetActiveTransferCount()), mStats.peakActiveTransfers, mStats.completedTransfers,
+                    mStats.failedTransfers, mStats.expiredReservations, mStats.busyResponses);
+
+    uint64_t averageMs  = AverageTransferDuration().count();
+    uint64_t throughput = (mStats.completedTransferTime.count() > 0)
+        ? (mStats.completedTransferBytes * 1000 / static_cast<uint64_t>(mStats.completedTransferTime.count()))
+        : 0;
+    ChipLogProgress(SoftwareUpdate,
+                    "OTA bytes sent by completed transfers %" PRIu64 ", by failed transfers %" PRIu64 ", average transfer %" PRIu64
+                    " ms, average throughput %" PRIu64 " B/s",
+                    mStats.completedTransferBytes, mStats.failedTransferBytes, averageMs, throughput);
+}
+
+CHIP_ERROR BdxOtaSenderPool::ReserveTransfer(FabricIndex fabricIndex, NodeId nodeId, const TransferParams & params,
+                                             uint32_t & delayedActionTimeSec)
+{
+    VerifyOrReturnError(!mSenders.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    ExpireStaleReservations();
+
+    // A requestor querying again restarts its transfer on the sender it already holds.
+    BdxOtaSender * sender = FindSender(fabricIndex, nodeId);
+    if (sender == nullptr)
+    {
+        sender = FindIdleSender();
+    }
+
+    if (sender == nullptr)
+    {
+        mStats.busyResponses++;
+        delayedActionTimeSec = ComputeDelayedActionTimeSec();
+        ChipLogProgress(SoftwareUpdate, "All %u OTA senders busy, asking requestor to retry in %" PRIu32 " s",
+                        static_cast<unsigned>(mSenders.size()), delayedActionTimeSec);
+        return CHIP_ERROR_BUSY;
+    }
+
+    ReturnErrorOnFailure(sender->InitializeTransfer(fabricIndex, nodeId));
+
+    BitFlags<TransferControlFlags> bdxFlags;
+    bdxFlags.Set(TransferControlFlags::kReceiverDrive);
+    CHIP_ERROR err = sender->PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
+                                                params.maxBlockSize, params.timeout, params.pollInterval);
+    if (err != CHIP_NO_ERROR)
+    {
+        sender->CancelPendingTransfer();
+        return err;
+    }
+
+    mStats.peakActiveTransfers = std::max(mStats.peakActiveTransfers, static_cast<uint32_t>(GetActiveTransferCount()));
+    ScheduleReservationExpiry();
+    return CHIP_NO_ERROR;
+}
+
+void BdxOtaSenderPool::OnTransferFinished(BdxOtaSender & sender, const BdxOtaSender::TransferMetrics & metrics)
+{
+    if (metrics.completed)
+    {
+        mStats.completedTransfers++;
+        mStats.completedTransferBytes += metrics.bytesSent;
+        mStats.completedTransferTime += metrics.duration;
+    }
+    else
+    {
+        mStats.failedTransfers++;
+        mStats.failedTransferBytes += metrics.bytesSent;
+    }
+
+    uint64_t throughput = (metrics.duration.count() > 0) ? (metrics.bytesSent * 1000 / metrics.duration.count()) : 0;
+    ChipLogProgress(SoftwareUpdate, "OTA transfer %s, throughput %" PRIu64 " B/s", metrics.completed ? "completed" : "failed",
+                    throughput);
+
+    mRetryScheduler.OnSenderFreed(chip::System::SystemClock().GetMonotonicTimestamp(), RetrySpacing());
+}
+
+CHIP_ERROR BdxOtaSenderPool::OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                                          ExchangeDelegate *& newDelegate)
+{
+    // The sender cannot be picked until the session of the exchange is known, see OnMessageReceived.
+    newDelegate = this;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BdxOtaSenderPool::OnMessageReceived(ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                               chip::System::PacketBufferHandle && payload)
+{
+    VerifyOrReturnError(ec != nullptr && ec->HasSessionHandle(), CHIP_ERROR_INCORRECT_STATE);
+
+    chip::Access::SubjectDescriptor subject = ec->GetSessionHandle()->GetSubjectDescriptor();
+    BdxOtaSender * sender                   = FindSender(subject.fabricIndex, subject.subject);
+    if (sender == nullptr || sender->HasTransferStarted())
+    {
+        ChipLogError(SoftwareUpdate, "No OTA transfer reserved for node " ChipLogFormatX64 " on fabric %u",
+                     ChipLogValueX64(subject.subject), subject.fabricIndex);
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    // Hand the exchange over to the sender for the rest of the transfer.
+    ec->SetDelegate(sender);
+    return static_cast<ExchangeDelegate *>(sender)->OnMessageReceived(ec, payloadHeader, std::move(payload));
+}
+
+BdxOtaSender * BdxOtaSenderPool::FindSender(FabricIndex fabricIndex, NodeId nodeId)
+{
+    for (auto & sender : mSenders)
+    {
+        if (sender->IsInitializedFor(fabricIndex, nodeId))
+        {
+            return sender.get();
+        }
+    }
+    return nullptr;
+}
+
+BdxOtaSender * BdxOtaSenderPool::FindIdleSender()
+{
+    for (auto & sender : mSenders)
+    {
+        if (!sender->IsInitialized())
+        {
+            return sender.get();
+        }
+    }
+    return nullptr;
+}
+
+void BdxOtaSenderPool::ExpireStaleReservations()
+{
+    Timestamp now = chip::System::SystemClock().GetMonotonicTimestamp();
+
+    for (auto & sender : mSenders)
+    {
+        if (sender->IsInitialized() && !sender->HasTransferStarted() && (now - sender->GetInitializedTime()) >= kReservationTimeout)
+        {
+            ChipLogProgress(SoftwareUpdate, "Releasing OTA sender reserved for a requestor that never started the transfer");
+            sender->CancelPendingTransfer();
+            mStats.expiredReservations++;
+            mRetryScheduler.OnSenderFreed(now, RetrySpacing());
+        }
+    }
+}
+
+void BdxOtaSenderPool::ScheduleReservationExpiry()
+{
+    // Reservations are released when they expire rather than on the next QueryImage, so that the freed senders are taken
+    // into account by the retry times handed out in the meantime.
+    Timestamp now = chip::System::SystemClock().GetMonotonicTimestamp();
+    bool pending  = false;
+    chip::System::Clock::Timeout nextExpiry(kReservationTimeout);
+
+    for (auto & sender : mSenders)
+    {
+        if (sender->IsInitialized() && !sender->HasTransferStarted())
+        {
+            Milliseconds64 elapsed = now - sender->GetInitializedTime();
+            if (elapsed >= kReservationTimeout)
+            {
+                nextExpiry = chip::System::Clock::kZero;
+            }
+            else
+            {
+                auto remaining = std::chrono::duration_cast<chip::System::Clock::Timeout>(kReservationTimeout - elapsed);
+                nextExpiry     = std::min(nextExpiry, remaining);
+            }
+            pending = true;
+        }
+    }
+
+    if (pending)
+    {
+        LogErrorOnFailure(chip::DeviceLayer::SystemLayer().StartTimer(nextExpiry, HandleReservationExpiry, this));
+    }
+    else
+    {
+        chip::DeviceLayer::SystemLayer().CancelTimer(HandleReservationExpiry, this);
+    }
+}
+
+void BdxOtaSenderPool::HandleReservationExpiry(chip::System::Layer * systemLayer, void * context)
+{
+    auto * pool = static_cast<BdxOtaSenderPool *>(context);
+    pool->ExpireStaleReservations();
+    pool->ScheduleReservationExpiry();
+}
+
+uint32_t BdxOtaSenderPool::ComputeDelayedActionTimeSec()
+{
+    return mRetryScheduler.ScheduleRetry(chip::System::SystemClock().GetMonotonicTimestamp(), EstimateTimeUntilSenderIsFree(),
+                                         RetrySpacing());
+}
+
+Milliseconds64 BdxOtaSenderPool::RetrySpacing() const
+{
+    return AverageTransferDuration() / mSenders.size();
+}
+
+Milliseconds64 BdxOtaSenderPool::EstimateTimeUntilSenderIsFree() const
+{
+    Timestamp now                = chip::System::SystemClock().GetMonotonicTimestamp();
+    Milliseconds64 averageLength = AverageTransferDuration();
+    Milliseconds64 earliest      = averageLength;
+
+    for (auto & sender : mSenders)
+    {
+        Milliseconds64 estimate = averageLength;
+
+        if (!sender->IsInitialized())
+        {
+            return Milliseconds64(0);
+        }
+
+        // A sender that is only reserved is expected to be busy for a whole transfer, which is the default estimate.
+        if (sender->HasTransferStarted())
+        {
+            Milliseconds64 elapsed = now - sender->GetTransferStartTime();
+            uint64_t remaining     = sender->GetBytesRemaining();
+            if (sender->GetBytesSent() > 0 && remaining > 0)
+            {
+                // Extrapolate from the throughput observed so far.
+                estimate = Milliseconds64(remaining * elapsed.count() / sender->GetBytesSent());
+            }
+            else
+            {
+                estimate = (averageLength > elapsed) ? (averageLength - elapsed) : Milliseconds64(0);
+            }
+        }
+
+        earliest = std::min(earliest, estimate);
+    }
+
+    return earliest;
+}
+
+Milliseconds64 BdxOtaSenderPool::AverageTransferDuration() const
+{
+    if (mStats.completedTransfers == 0)
+    {
+        return kDefaultTransferDuration;
+    }
+    return mStats.completedTransferTime / mStats.completedTransfers;
+}
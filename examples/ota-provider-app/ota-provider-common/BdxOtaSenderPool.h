@@ -0,0 +1,114 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeDelegate.h>
+#include <ota-provider-common/BdxOtaSender.h>
+#include <ota-provider-common/OTARetryScheduler.h>
+#include <ota-provider-common/OTATransferScheduler.h>
+#include <system/SystemClock.h>
+
+#include <memory>
+#include <vector>
+
+/**
+ * Serves OTA images to several requestors concurrently.
+ *
+ * The pool owns a fixed number of BdxOtaSender objects, one per concurrent transfer. A sender is reserved for a requestor when
+ * the QueryImage command is handled, and incoming BDX exchanges are dispatched to the sender reserved for their peer. When all
+ * senders are in use, requestors are told to come back later, with delays spread out so that they do not all query again at
+ * the same time.
+ *
+ * The pool must be registered as the unsolicited message handler for the BDX protocol.
+ */
+class BdxOtaSenderPool : public OTATransferScheduler,
+                         public chip::Messaging::UnsolicitedMessageHandler,
+                         public chip::Messaging::ExchangeDelegate,
+                         public BdxOtaSender::TransferObserver
+{
+public:
+    struct Stats
+    {
+        uint32_t peakActiveTransfers    = 0;
+        uint32_t completedTransfers     = 0;
+        uint32_t failedTransfers        = 0;
+        uint32_t expiredReservations    = 0;
+        uint32_t busyResponses          = 0;
+        uint64_t completedTransferBytes = 0;
+        // Bytes sent by failed or aborted transfers before they stopped. They are kept out of the throughput.
+        uint64_t failedTransferBytes = 0;
+        chip::System::Clock::Milliseconds64 completedTransferTime{ 0 }; // sum of the durations of completed transfers
+    };
+
+    // Requestors that do not start the BDX transfer within this time after QueryImage lose their reservation.
+    static constexpr chip::System::Clock::Seconds16 kReservationTimeout = chip::System::Clock::Seconds16(120);
+
+    // Assumed duration of a transfer until the first one has completed.
+    static constexpr chip::System::Clock::Seconds16 kDefaultTransferDuration = chip::System::Clock::Seconds16(300);
+
+    /**
+     * Allocates the senders. May be called only once.
+     *
+     * @param[in] maxConcurrentTransfers  The number of transfers that can be in progress at the same time.
+     */
+    CHIP_ERROR Init(size_t maxConcurrentTransfers);
+
+    // Stops the timer that releases expired reservations.
+    void Shutdown();
+
+    // Number of senders reserved for a requestor or serving one.
+    size_t GetActiveTransferCount() const;
+
+    const Stats & GetStats() const { return mStats; }
+    void LogStats() const;
+
+    //////////// OTATransferScheduler Implementation ///////////////
+    CHIP_ERROR ReserveTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId, const TransferParams & params,
+                               uint32_t & delayedActionTimeSec) override;
+
+    //////////// TransferObserver Implementation ///////////////
+    void OnTransferFinished(BdxOtaSender & sender, const BdxOtaSender::TransferMetrics & metrics) override;
+
+private:
+    //////////// UnsolicitedMessageHandler Implementation ///////////////
+    CHIP_ERROR OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                            chip::Messaging::ExchangeDelegate *& newDelegate) override;
+
+    //////////// ExchangeDelegate Implementation ///////////////
+    CHIP_ERROR OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                 chip::System::PacketBufferHandle && payload) override;
+    void OnResponseTimeout(chip::Messaging::ExchangeContext * ec) override {}
+
+    BdxOtaSender * FindSender(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+    BdxOtaSender * FindIdleSender();
+    void ExpireStaleReservations();
+    void ScheduleReservationExpiry();
+    static void HandleReservationExpiry(chip::System::Layer * systemLayer, void * context);
+
+    // Returns the time the requestor should wait before querying again, given the current load.
+    uint32_t ComputeDelayedActionTimeSec();
+    chip::System::Clock::Milliseconds64 RetrySpacing() const;
+    chip::System::Clock::Milliseconds64 EstimateTimeUntilSenderIsFree() const;
+    chip::System::Clock::Milliseconds64 AverageTransferDuration() const;
+
+    std::vector<std::unique_ptr<BdxOtaSender>> mSenders;
+    Stats mStats;
+
+    OTARetryScheduler mRetryScheduler;
+};
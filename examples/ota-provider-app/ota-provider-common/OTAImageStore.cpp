@@ -0,0 +1,224 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/OTAImageStore.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <new>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using chip::ByteSpan;
+
+namespace {
+
+// The header is read in chunks of this size until the parser has consumed all of it.
+constexpr size_t kHeaderReadChunkSize = 256;
+
+} // namespace
+
+OTAImage::~OTAImage()
+{
+    mParser.Clear();
+    if (mFd >= 0)
+    {
+        close(mFd);
+    }
+}
+
+CHIP_ERROR OTAImage::ReadBlock(uint64_t offset, size_t length, ByteSpan & block)
+{
+    if (offset >= mSize)
+    {
+        block = ByteSpan();
+        return CHIP_NO_ERROR;
+    }
+
+    uint64_t available = mSize - offset;
+    if (available < length)
+    {
+        // cast should be safe because available is smaller than length
+        length = static_cast<size_t>(available);
+    }
+
+    for (auto it = mBlockCache.begin(); it != mBlockCache.end(); ++it)
+    {
+        if (it->offset == offset && it->data.size() == length)
+        {
+            mBlockCache.splice(mBlockCache.begin(), mBlockCache, it);
+            block = ByteSpan(mBlockCache.front().data.data(), length);
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    // Reuse the storage of the least recently used block once the cache is full.
+    if (mBlockCache.size() < kMaxCachedBlocks)
+    {
+        mBlockCache.emplace_front();
+    }
+    else
+    {
+        mBlockCache.splice(mBlockCache.begin(), mBlockCache, std::prev(mBlockCache.end()));
+    }
+
+    CachedBlock & entry = mBlockCache.front();
+    entry.data.resize(length);
+
+    CHIP_ERROR error = ReadFully(offset, entry.data.data(), length);
+    if (error != CHIP_NO_ERROR)
+    {
+        mBlockCache.pop_front();
+        return error;
+    }
+
+    entry.offset = offset;
+    block        = ByteSpan(entry.data.data(), length);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImage::ReadFully(uint64_t offset, uint8_t * buffer, size_t length) const
+{
+    VerifyOrReturnError(chip::CanCastTo<off_t>(offset + length), CHIP_ERROR_READ_FAILED);
+
+    size_t done = 0;
+    while (done < length)
+    {
+        ssize_t count = pread(mFd, buffer + done, length - done, static_cast<off_t>(offset + done));
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        // A short read means the file was truncated after it was loaded.
+        VerifyOrReturnError(count > 0, CHIP_ERROR_READ_FAILED);
+        done += static_cast<size_t>(count);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImage::DecodeHeader(const char * path)
+{
+    uint8_t chunk[kHeaderReadChunkSize];
+    ByteSpan buffer;
+    uint64_t offset  = 0;
+    CHIP_ERROR error = CHIP_ERROR_BUFFER_TOO_SMALL;
+
+    mParser.Init();
+    VerifyOrReturnError(mParser.IsInitialized(), CHIP_ERROR_NO_MEMORY);
+
+    while (error == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        if (offset >= mSize)
+        {
+            ChipLogError(SoftwareUpdate, "OTA image %s is too short to hold its header", path);
+            return CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+        }
+
+        size_t length = static_cast<size_t>(chip::min<uint64_t>(sizeof(chunk), mSize - offset));
+        ReturnErrorOnFailure(ReadFully(offset, chunk, length));
+        offset += length;
+
+        buffer = ByteSpan(chunk, length);
+        error  = mParser.AccumulateAndDecode(buffer, mHeader);
+    }
+
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Error parsing OTA image header of %s: %" CHIP_ERROR_FORMAT, path, error.Format());
+        return error;
+    }
+
+    // Whatever the parser left in the last chunk is the start of the payload.
+    uint64_t headerSize = offset - buffer.size();
+    if (mSize - headerSize < mHeader.mPayloadSize)
+    {
+        ChipLogError(SoftwareUpdate,
+                     "OTA image %s is truncated: payload size is %" PRIu64 " but only %" PRIu64 " bytes follow the header", path,
+                     mHeader.mPayloadSize, mSize - headerSize);
+        return CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool OTAImage::IsSameFile(dev_t device, ino_t inode, uint64_t size, time_t modificationTime) const
+{
+    return mDevice == device && mInode == inode && mSize == size && mModification == modificationTime;
+}
+
+OTAImageStore & OTAImageStore::Instance()
+{
+    static OTAImageStore sInstance;
+    return sInstance;
+}
+
+CHIP_ERROR OTAImageStore::GetImage(const char * path, std::shared_ptr<OTAImage> & image)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Drop stale entries while looking for an already loaded image of the same file.
+    for (auto it = mImages.begin(); it != mImages.end();)
+    {
+        it = it->second.expired() ? mImages.erase(it) : std::next(it);
+    }
+
+    // A loaded image is reused as long as the path still refers to the same, unmodified file, which only costs a stat().
+    struct stat fileStat;
+    auto existing = mImages.find(path);
+    if (existing != mImages.end() && stat(path, &fileStat) == 0)
+    {
+        std::shared_ptr<OTAImage> cached = existing->second.lock();
+        if (cached &&
+            cached->IsSameFile(fileStat.st_dev, fileStat.st_ino, static_cast<uint64_t>(fileStat.st_size), fileStat.st_mtime))
+        {
+            image = std::move(cached);
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    // std::make_shared cannot be used since the constructor is private.
+    std::shared_ptr<OTAImage> loaded(new (std::nothrow) OTAImage());
+    VerifyOrReturnError(loaded, CHIP_ERROR_NO_MEMORY);
+
+    // From here on the image owns the descriptor and closes it when it is destroyed.
+    loaded->mFd = open(path, O_RDONLY | O_CLOEXEC);
+    if (loaded->mFd < 0 || fstat(loaded->mFd, &fileStat) != 0)
+    {
+        ChipLogError(SoftwareUpdate, "Error opening OTA image file: %s", path);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    loaded->mSize         = static_cast<uint64_t>(fileStat.st_size);
+    loaded->mDevice       = fileStat.st_dev;
+    loaded->mInode        = fileStat.st_ino;
+    loaded->mModification = fileStat.st_mtime;
+
+    ReturnErrorOnFailure(loaded->DecodeHeader(path));
+
+    ChipLogProgress(SoftwareUpdate, "Loaded OTA image %s (%" PRIu64 " bytes, version %" PRIu32 ")", path, loaded->GetSize(),
+                    loaded->GetHeader().mSoftwareVersion);
+
+    mImages[path] = loaded;
+    image         = std::move(loaded);
+    return CHIP_NO_ERROR;
+}
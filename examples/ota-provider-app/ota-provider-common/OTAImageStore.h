@@ -0,0 +1,122 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/OTAImageHeader.h>
+#include <lib/support/Span.h>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+/**
+ * A read-only OTA image file.
+ *
+ * The file is opened and its header decoded and validated once, when the image is loaded; the file stays open for as long as
+ * the image is alive. Block data is read from the file on demand through a small cache shared by all transfers of the image,
+ * so memory use does not grow with the image size and concurrent transfers at the same offset read the file only once.
+ */
+class OTAImage
+{
+public:
+    // Maximum number of blocks kept in the cache of each image.
+    static constexpr size_t kMaxCachedBlocks = 16;
+
+    ~OTAImage();
+
+    OTAImage(const OTAImage &)             = delete;
+    OTAImage & operator=(const OTAImage &) = delete;
+
+    const chip::OTAImageHeader & GetHeader() const { return mHeader; }
+
+    // Total size of the image file, including the header.
+    uint64_t GetSize() const { return mSize; }
+
+    /**
+     * Reads at most `length` bytes of the image starting at `offset`. The block is shorter than `length` when the end of the
+     * image is reached, and empty when `offset` is past the end of the image.
+     *
+     * The returned span points into the block cache and stays valid until the next call to ReadBlock() on this image.
+     *
+     * @retval CHIP_ERROR_READ_FAILED  The file could not be read, e.g. because it was truncated after the image was loaded.
+     */
+    CHIP_ERROR ReadBlock(uint64_t offset, size_t length, chip::ByteSpan & block);
+
+private:
+    friend class OTAImageStore;
+
+    struct CachedBlock
+    {
+        uint64_t offset = 0;
+        std::vector<uint8_t> data;
+    };
+
+    OTAImage() = default;
+
+    CHIP_ERROR ReadFully(uint64_t offset, uint8_t * buffer, size_t length) const;
+    CHIP_ERROR DecodeHeader(const char * path);
+    bool IsSameFile(dev_t device, ino_t inode, uint64_t size, time_t modificationTime) const;
+
+    int mFd              = -1;
+    uint64_t mSize       = 0;
+    dev_t mDevice        = 0;
+    ino_t mInode         = 0;
+    time_t mModification = 0;
+
+    // String members of mHeader point into the parser buffer, so the parser is kept alive with the header.
+    chip::OTAImageHeaderParser mParser;
+    chip::OTAImageHeader mHeader;
+
+    // Most recently used block first.
+    std::list<CachedBlock> mBlockCache;
+};
+
+/**
+ * Hands out OTA images shared between all concurrent BDX transfers of the same file.
+ *
+ * An image stays loaded for as long as at least one user holds a reference to it. If the file on disk is replaced while
+ * transfers are in progress, those transfers keep reading the old file and new transfers get the new one. Rewriting the file
+ * in place is not supported: in-flight transfers may then serve a mix of old and new contents, which the requestor rejects
+ * when verifying the image, or fail with a read error if the file got shorter.
+ *
+ * This class is not thread-safe and is expected to be used from the Matter thread only.
+ */
+class OTAImageStore
+{
+public:
+    static OTAImageStore & Instance();
+
+    /**
+     * Returns the image for the given file path, opening the file and validating its header if it is not loaded yet.
+     *
+     * @retval CHIP_ERROR_OPEN_FAILED              The file could not be opened.
+     * @retval CHIP_ERROR_READ_FAILED              The image header could not be read.
+     * @retval CHIP_ERROR_NO_MEMORY                Memory for the image could not be allocated.
+     * @retval CHIP_ERROR_INVALID_FILE_IDENTIFIER  The file is not a Matter OTA image.
+     * @retval Error code                          The image header is invalid.
+     */
+    CHIP_ERROR GetImage(const char * path, std::shared_ptr<OTAImage> & image);
+
+private:
+    std::map<std::string, std::weak_ptr<OTAImage>> mImages;
+};
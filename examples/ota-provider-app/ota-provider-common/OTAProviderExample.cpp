@@ -29,7 +29,6 @@
 #include <lib/support/CHIPMemString.h>
 #include <protocols/bdx/BdxUri.h>
 
-#include <fstream>
 #include <string.h>
 
 using chip::BitFlags;
@@ -52,7 +51,6 @@ using namespace chip::app::Clusters::OtaSoftwareUpdateProvider::Commands;
 
 constexpr uint8_t kUpdateTokenLen    = 32;                      // must be between 8 and 32
 constexpr uint8_t kUpdateTokenStrLen = kUpdateTokenLen * 2 + 1; // Hex string needs 2 hex chars for every byte
-constexpr size_t kOtaHeaderMaxSize   = 1024;
 
 // Arbitrary BDX Transfer Params
 constexpr uint32_t kMaxBdxBlockSize                = 1024;
@@ -120,13 +118,15 @@ void OTAProviderExample::SetImageUri(const char * imageUri)
 void OTAProviderExample::SetOTACandidates(std::vector<OTAProviderExample::DeviceSoftwareVersionModel> candidates)
 {
     mCandidates = std::move(candidates);
+    mCandidateImages.clear();
 
-    // Validate that each candidate matches the info in the image header
+    // Validate that each candidate matches the info in the image header. The images are kept loaded so that their headers
+    // are not parsed again when the candidates are served.
     for (auto candidate : mCandidates)
     {
-        OTAImageHeaderParser parser;
-        OTAImageHeader header;
-        ParseOTAHeader(parser, candidate.otaURL, header);
+        std::shared_ptr<OTAImage> image;
+        VerifyOrDie(OTAImageStore::Instance().GetImage(candidate.otaURL, image) == CHIP_NO_ERROR);
+        const OTAImageHeader & header = image->GetHeader();
 
         ChipLogDetail(SoftwareUpdate, "Validating image list candidate %s: ", candidate.otaURL);
         VerifyOrDie(candidate.vendorId == header.mVendorId);
@@ -143,7 +143,7 @@ void OTAProviderExample::SetOTACandidates(std::vector<OTAProviderExample::Device
         {
             VerifyOrDie(candidate.maxApplicableSoftwareVersion == header.mMaxApplicableVersion.Value());
         }
-        parser.Clear();
+        mCandidateImages.push_back(std::move(image));
     }
 }
 
@@ -193,41 +193,6 @@ UserConsentSubject OTAProviderExample::GetUserConsentSubject(const app::CommandH
     return subject;
 }
 
-bool OTAProviderExample::ParseOTAHeader(OTAImageHeaderParser & parser, const char * otaFilePath, OTAImageHeader & header)
-{
-    uint8_t otaFileContent[kOtaHeaderMaxSize];
-    ByteSpan buffer(otaFileContent);
-
-    std::ifstream otaFile(otaFilePath, std::ifstream::in);
-    if (!otaFile.is_open() || !otaFile.good())
-    {
-        ChipLogError(SoftwareUpdate, "Error opening OTA image file: %s", otaFilePath);
-        return false;
-    }
-
-    otaFile.read(reinterpret_cast<char *>(otaFileContent), kOtaHeaderMaxSize);
-    if (otaFile.bad())
-    {
-        ChipLogError(SoftwareUpdate, "Error reading OTA image file: %s", otaFilePath);
-        return false;
-    }
-
-    parser.Init();
-    if (!parser.IsInitialized())
-    {
-        return false;
-    }
-
-    CHIP_ERROR error = parser.AccumulateAndDecode(buffer, header);
-    if (error != CHIP_NO_ERROR)
-    {
-        ChipLogError(SoftwareUpdate, "Error parsing OTA image header: %" CHIP_ERROR_FORMAT, error.Format());
-        return false;
-    }
-
-    return true;
-}
-
 void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj, const app::ConcreteCommandPath & commandPath,
                                                 const QueryImage::DecodableType & commandData)
 {
@@ -237,6 +202,7 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
     bool requestorCanConsent             = commandData.requestorCanConsent.ValueOr(false);
     uint8_t updateToken[kUpdateTokenLen] = { 0 };
     char strBuf[kUpdateTokenStrLen]      = { 0 };
+    uint32_t delayedActionTimeSec        = mDelayedQueryActionTimeSec;
 
     // Set fields specific for an available status response
     if (mQueryImageStatus == OTAQueryStatus::kUpdateAvailable)
@@ -269,37 +235,52 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
         }
 
         // Initialize the transfer session in prepartion for a BDX transfer
-        BitFlags<TransferControlFlags> bdxFlags;
-        bdxFlags.Set(TransferControlFlags::kReceiverDrive);
-        if (mBdxOtaSender.InitializeTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
-                                             commandObj->GetSubjectDescriptor().subject) == CHIP_NO_ERROR)
+        CHIP_ERROR error = CHIP_NO_ERROR;
+        if (mTransferScheduler != nullptr)
         {
-            CHIP_ERROR error =
-                mBdxOtaSender.PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
-                                                 kMaxBdxBlockSize, kBdxTimeout, chip::System::Clock::Milliseconds32(mPollInterval));
-            if (error != CHIP_NO_ERROR)
-            {
-                ChipLogError(SoftwareUpdate, "Cannot prepare for transfer: %" CHIP_ERROR_FORMAT, error.Format());
-                commandObj->AddStatus(commandPath, Status::Failure);
-                return;
-            }
-
-            response.imageURI.Emplace(chip::CharSpan::fromCharString(mImageUri));
-            response.softwareVersion.Emplace(mSoftwareVersion);
-            response.softwareVersionString.Emplace(chip::CharSpan::fromCharString(mSoftwareVersionString));
-            response.updateToken.Emplace(chip::ByteSpan(updateToken));
+            OTATransferScheduler::TransferParams params = { kMaxBdxBlockSize, kBdxTimeout,
+                                                            chip::System::Clock::Milliseconds32(mPollInterval) };
+            error = mTransferScheduler->ReserveTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
+                                                        commandObj->GetSubjectDescriptor().subject, params, delayedActionTimeSec);
+        }
+        else if (mBdxOtaSender.InitializeTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
+                                                  commandObj->GetSubjectDescriptor().subject) == CHIP_NO_ERROR)
+        {
+            BitFlags<TransferControlFlags> bdxFlags;
+            bdxFlags.Set(TransferControlFlags::kReceiverDrive);
+            error = mBdxOtaSender.PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
+                                                     kMaxBdxBlockSize, kBdxTimeout,
+                                                     chip::System::Clock::Milliseconds32(mPollInterval));
         }
         else
         {
             // Another BDX transfer in progress
+            error = CHIP_ERROR_BUSY;
+        }
+
+        if (error == CHIP_ERROR_BUSY)
+        {
             mQueryImageStatus = OTAQueryStatus::kBusy;
         }
+        else if (error != CHIP_NO_ERROR)
+        {
+            ChipLogError(SoftwareUpdate, "Cannot prepare for transfer: %" CHIP_ERROR_FORMAT, error.Format());
+            commandObj->AddStatus(commandPath, Status::Failure);
+            return;
+        }
+        else
+        {
+            response.imageURI.Emplace(chip::CharSpan::fromCharString(mImageUri));
+            response.softwareVersion.Emplace(mSoftwareVersion);
+            response.softwareVersionString.Emplace(chip::CharSpan::fromCharString(mSoftwareVersionString));
+            response.updateToken.Emplace(chip::ByteSpan(updateToken));
+        }
     }
 
     // Delay action time is only applicable when the provider is busy
     if (mQueryImageStatus == OTAQueryStatus::kBusy)
     {
-        response.delayedActionTime.Emplace(mDelayedQueryActionTimeSec);
+        response.delayedActionTime.Emplace(delayedActionTimeSec);
     }
 
     // Set remaining fields common to all status types
@@ -353,14 +334,13 @@ void OTAProviderExample::HandleQueryImage(app::CommandHandler * commandObj, cons
         }
         else if (strlen(mOTAFilePath) > 0) // If OTA file is directly provided
         {
-            // Parse the header and set version info based on the header
-            OTAImageHeaderParser parser;
-            OTAImageHeader header;
-            VerifyOrDie(ParseOTAHeader(parser, mOTAFilePath, header) == true);
+            // Set version info based on the header. The image stays loaded between queries, so its header is only parsed
+            // again if the file changes.
+            VerifyOrDie(OTAImageStore::Instance().GetImage(mOTAFilePath, mOTAImage) == CHIP_NO_ERROR);
+            const OTAImageHeader & header = mOTAImage->GetHeader();
             VerifyOrDie(sizeof(mSoftwareVersionString) > header.mSoftwareVersionString.size());
             mSoftwareVersion = header.mSoftwareVersion;
             memcpy(mSoftwareVersionString, header.mSoftwareVersionString.data(), header.mSoftwareVersionString.size());
-            parser.Clear();
         }
 
         // If mUserConsentNeeded (set by the CLI) is true and requestor is capable of taking user consent
@@ -24,6 +24,9 @@
 #include <app/clusters/ota-provider/ota-provider-delegate.h>
 #include <lib/core/OTAImageHeader.h>
 #include <ota-provider-common/BdxOtaSender.h>
+#include <ota-provider-common/OTAImageStore.h>
+#include <ota-provider-common/OTATransferScheduler.h>
+#include <memory>
 #include <vector>
 
 /**
@@ -71,6 +74,10 @@ public:
     void SetImageUri(const char * imageUri);
     BdxOtaSender * GetBdxOtaSender() { return &mBdxOtaSender; }
 
+    // When set, BDX senders are reserved through the scheduler instead of the built-in single BdxOtaSender, which allows
+    // serving several requestors concurrently.
+    void SetTransferScheduler(OTATransferScheduler * scheduler) { mTransferScheduler = scheduler; }
+
     void SetOTACandidates(std::vector<OTAProviderExample::DeviceSoftwareVersionModel> candidates);
     void SetIgnoreQueryImageCount(uint32_t count) { mIgnoreQueryImageCount = count; }
     void SetIgnoreApplyUpdateCount(uint32_t count) { mIgnoreApplyUpdateCount = count; }
@@ -99,8 +106,6 @@ private:
                           const chip::app::Clusters::OtaSoftwareUpdateProvider::Commands::QueryImage::DecodableType & commandData,
                           uint32_t targetVersion);
 
-    bool ParseOTAHeader(chip::OTAImageHeaderParser & parser, const char * otaFilePath, chip::OTAImageHeader & header);
-
     /**
      * Called to send the response for a QueryImage command. If an error is encountered, an error status will be sent.
      */
@@ -109,7 +114,10 @@ private:
                            const chip::app::Clusters::OtaSoftwareUpdateProvider::Commands::QueryImage::DecodableType & commandData);
 
     BdxOtaSender mBdxOtaSender;
+    OTATransferScheduler * mTransferScheduler = nullptr;
     std::vector<DeviceSoftwareVersionModel> mCandidates;
+    std::vector<std::shared_ptr<OTAImage>> mCandidateImages;
+    std::shared_ptr<OTAImage> mOTAImage;
     char mOTAFilePath[kFilepathBufLen]; // null-terminated
     char mImageUri[kUriMaxLen];
     OTAQueryStatus mQueryImageStatus;
@@ -0,0 +1,53 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/OTARetryScheduler.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+
+using chip::System::Clock::Milliseconds64;
+using chip::System::Clock::Timestamp;
+
+constexpr uint32_t OTARetryScheduler::kMaxDelayedActionTimeSec;
+
+uint32_t OTARetryScheduler::ScheduleRetry(Timestamp now, Milliseconds64 timeUntilSenderIsFree, Milliseconds64 spacing)
+{
+    // Slots in the past belong to requestors that have come back already.
+    Timestamp retryAt = now + timeUntilSenderIsFree;
+    if (mLastScheduledRetry >= now)
+    {
+        retryAt = std::max(retryAt, mLastScheduledRetry + spacing);
+    }
+
+    uint64_t delaySec = (retryAt - now).count() / 1000 + 1;
+    delaySec          = std::min<uint64_t>(delaySec, kMaxDelayedActionTimeSec);
+
+    // Keep the slot consistent with the capped delay, so that the cap does not let the slots grow without bound.
+    mLastScheduledRetry = std::min<Timestamp>(retryAt, now + Milliseconds64(delaySec * 1000));
+    return static_cast<uint32_t>(delaySec);
+}
+
+void OTARetryScheduler::OnSenderFreed(Timestamp now, Milliseconds64 spacing)
+{
+    VerifyOrReturn(mLastScheduledRetry > now);
+
+    // The freed sender serves one of the scheduled requestors earlier than planned, so every later slot moves up by one. When
+    // no slot is left in the future, the next requestor only waits for the first free sender.
+    mLastScheduledRetry = (mLastScheduledRetry - now > spacing) ? (mLastScheduledRetry - spacing) : chip::System::Clock::kZero;
+}
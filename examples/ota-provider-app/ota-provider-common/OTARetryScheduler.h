@@ -0,0 +1,54 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <system/SystemClock.h>
+
+#include <stdint.h>
+
+/**
+ * Computes the DelayedActionTime given to OTA requestors that cannot be served yet.
+ *
+ * Requestors told to wait are given retry times one after the other, spaced by the rate at which senders are expected to
+ * become free, so that they do not all query again at the moment the first sender is released. Every sender that becomes free
+ * gives one of those retry slots back, so the retry times do not keep growing when senders free up sooner than estimated.
+ */
+class OTARetryScheduler
+{
+public:
+    static constexpr uint32_t kMaxDelayedActionTimeSec = 24 * 60 * 60;
+
+    /**
+     * Schedules the retry of a requestor and returns the time, in seconds, it should wait before querying again.
+     *
+     * @param[in] now                    The current monotonic time.
+     * @param[in] timeUntilSenderIsFree  The estimated time until the first sender becomes free.
+     * @param[in] spacing                The expected time between two senders becoming free.
+     */
+    uint32_t ScheduleRetry(chip::System::Clock::Timestamp now, chip::System::Clock::Milliseconds64 timeUntilSenderIsFree,
+                           chip::System::Clock::Milliseconds64 spacing);
+
+    // Must be called whenever a sender becomes free, with the same spacing as given to ScheduleRetry().
+    void OnSenderFreed(chip::System::Clock::Timestamp now, chip::System::Clock::Milliseconds64 spacing);
+
+    // Time until which requestors have been scheduled to come back.
+    chip::System::Clock::Timestamp GetLastScheduledRetry() const { return mLastScheduledRetry; }
+
+private:
+    chip::System::Clock::Timestamp mLastScheduledRetry{ 0 };
+};
@@ -0,0 +1,53 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <system/SystemClock.h>
+
+/**
+ * Decides whether a new BDX transfer can be started for an OTA requestor, and when a requestor that cannot be served right away
+ * should query again.
+ */
+class OTATransferScheduler
+{
+public:
+    struct TransferParams
+    {
+        uint16_t maxBlockSize;
+        chip::System::Clock::Timeout timeout;
+        chip::System::Clock::Timeout pollInterval;
+    };
+
+    virtual ~OTATransferScheduler() = default;
+
+    /**
+     * Reserves a BDX sender for the given requestor and prepares it for the transfer.
+     *
+     * @param[out] delayedActionTimeSec When the provider is at capacity, the number of seconds the requestor should wait before
+     *                                  sending the next QueryImage command.
+     *
+     * @retval CHIP_NO_ERROR    A sender is ready to accept the transfer from the requestor.
+     * @retval CHIP_ERROR_BUSY  The provider is at capacity, delayedActionTimeSec is set.
+     * @retval Error code       The sender could not be prepared.
+     */
+    virtual CHIP_ERROR ReserveTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId, const TransferParams & params,
+                                       uint32_t & delayedActionTimeSec) = 0;
+};
@@ -0,0 +1,121 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/OTARetryScheduler.h>
+
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+using namespace chip::System::Clock;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+constexpr Timestamp kStart = Timestamp(1'000'000);
+
+void TestFirstRetryWaitsForFirstFreeSender(nlTestSuite * inSuite, void * inContext)
+{
+    OTARetryScheduler scheduler;
+
+    // Delays are rounded up to the next second.
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart, 10'000_ms64, 60'000_ms64) == 11);
+    NL_TEST_ASSERT(inSuite, scheduler.GetLastScheduledRetry() == kStart + 10'000_ms64);
+}
+
+void TestRetriesAreSpaced(nlTestSuite * inSuite, void * inContext)
+{
+    OTARetryScheduler scheduler;
+
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart, 10'000_ms64, 60'000_ms64) == 11);
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart, 10'000_ms64, 60'000_ms64) == 71);
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart + 1'000_ms64, 9'000_ms64, 60'000_ms64) == 130);
+}
+
+void TestPastSlotsAreForgotten(nlTestSuite * inSuite, void * inContext)
+{
+    OTARetryScheduler scheduler;
+
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart, 10'000_ms64, 60'000_ms64) == 11);
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart, 10'000_ms64, 60'000_ms64) == 71);
+
+    // Once the scheduled requestors have come back, a new one only waits for the first free sender.
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart + 80'000_ms64, 5'000_ms64, 60'000_ms64) == 6);
+}
+
+void TestFreedSendersPullRetriesBack(nlTestSuite * inSuite, void * inContext)
+{
+    OTARetryScheduler scheduler;
+
+    for (int i = 0; i < 10; i++)
+    {
+        scheduler.ScheduleRetry(kStart, 10'000_ms64, 60'000_ms64);
+    }
+    NL_TEST_ASSERT(inSuite, scheduler.GetLastScheduledRetry() == kStart + 550'000_ms64);
+
+    // Senders freeing up sooner than estimated give their slots back, one each.
+    scheduler.OnSenderFreed(kStart + 1'000_ms64, 60'000_ms64);
+    NL_TEST_ASSERT(inSuite, scheduler.GetLastScheduledRetry() == kStart + 490'000_ms64);
+    scheduler.OnSenderFreed(kStart + 1'000_ms64, 60'000_ms64);
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart + 1'000_ms64, 10'000_ms64, 60'000_ms64) == 490);
+
+    // Slots never move back past the current time.
+    for (int i = 0; i < 20; i++)
+    {
+        scheduler.OnSenderFreed(kStart + 2'000_ms64, 60'000_ms64);
+    }
+    NL_TEST_ASSERT(inSuite, scheduler.GetLastScheduledRetry() == kZero);
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart + 2'000_ms64, 10'000_ms64, 60'000_ms64) == 11);
+}
+
+void TestDelayIsCapped(nlTestSuite * inSuite, void * inContext)
+{
+    OTARetryScheduler scheduler;
+    constexpr Milliseconds64 kHour = 3'600'000_ms64;
+
+    for (int i = 0; i < 100; i++)
+    {
+        NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart, kHour, kHour) <= OTARetryScheduler::kMaxDelayedActionTimeSec);
+    }
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart, kHour, kHour) == OTARetryScheduler::kMaxDelayedActionTimeSec);
+
+    // Capped slots do not accumulate beyond the cap, so a single freed sender brings the delay back under it.
+    scheduler.OnSenderFreed(kStart, kHour);
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart, kHour, kHour) == OTARetryScheduler::kMaxDelayedActionTimeSec);
+    scheduler.OnSenderFreed(kStart, kHour);
+    scheduler.OnSenderFreed(kStart, kHour);
+    NL_TEST_ASSERT(inSuite, scheduler.ScheduleRetry(kStart, kHour, kHour) < OTARetryScheduler::kMaxDelayedActionTimeSec);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestFirstRetryWaitsForFirstFreeSender", TestFirstRetryWaitsForFirstFreeSender),
+    NL_TEST_DEF("TestRetriesAreSpaced", TestRetriesAreSpaced),
+    NL_TEST_DEF("TestPastSlotsAreForgotten", TestPastSlotsAreForgotten),
+    NL_TEST_DEF("TestFreedSendersPullRetriesBack", TestFreedSendersPullRetriesBack),
+    NL_TEST_DEF("TestDelayIsCapped", TestDelayIsCapped),
+    NL_TEST_SENTINEL(),
+};
+
+} // namespace
+
+int TestOTARetryScheduler()
+{
+    nlTestSuite theSuite = { "OTARetryScheduler", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestOTARetryScheduler)
@@ -19,7 +19,9 @@
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/PlatformManager.h>
 
+#include <app/InteractionLatencyStats.h>
 #include <app/InteractionModelEngine.h>
+#include <app/WriteBehindAttributePersistenceProvider.h>
 #include <app/clusters/network-commissioning/network-commissioning.h>
 #include <app/server/Dnssd.h>
 #include <app/server/OnboardingCodesUtil.h>
@@ -269,6 +271,55 @@ LinuxCommissionableDataProvider gCommissionableDataProvider;
 
 chip::DeviceLayer::DeviceInfoProviderImpl gExampleDeviceInfoProvider;
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+// Commits all the attributes written by one flush to the KVS file at once.
+class KvsStorageBatch : public app::WriteBehindAttributePersistenceProvider::StorageBatch
+{
+public:
+    void BeginBatch() override { PersistedStorage::KeyValueStoreMgrImpl().BeginBatch(); }
+    CHIP_ERROR EndBatch() override { return PersistedStorage::KeyValueStoreMgrImpl().EndBatch(); }
+};
+KvsStorageBatch gKvsStorageBatch;
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
+app::WriteBehindAttributePersistenceProvider * gWriteBehindAttributePersister = nullptr;
+
+void InitWriteBehindAttributePersister()
+{
+    const LinuxDeviceOptions & options = LinuxDeviceOptions::GetInstance();
+    VerifyOrReturn(options.attributeWriteMaxDelayMs > 0);
+
+    app::WriteBehindAttributePersistenceProvider::StorageBatch * batch = nullptr;
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    batch = &gKvsStorageBatch;
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
+    gWriteBehindAttributePersister = Platform::New<app::WriteBehindAttributePersistenceProvider>(
+        Server::GetInstance().GetDefaultAttributePersister(), System::Clock::Milliseconds32(options.attributeWriteIdleDelayMs),
+        System::Clock::Milliseconds32(options.attributeWriteMaxDelayMs), batch);
+    VerifyOrReturn(gWriteBehindAttributePersister != nullptr);
+    if (gWriteBehindAttributePersister->Init(&DeviceLayer::SystemLayer()) != CHIP_NO_ERROR)
+    {
+        Platform::Delete(gWriteBehindAttributePersister);
+        gWriteBehindAttributePersister = nullptr;
+        return;
+    }
+    app::SetAttributePersistenceProvider(gWriteBehindAttributePersister);
+    ChipLogProgress(AppServer, "Writing persisted attributes at most %" PRIu32 " ms after they change",
+                    options.attributeWriteMaxDelayMs);
+}
+
+void ShutdownWriteBehindAttributePersister()
+{
+    VerifyOrReturn(gWriteBehindAttributePersister != nullptr);
+
+    // Write the pending attributes while the storage is still available.
+    gWriteBehindAttributePersister->Shutdown();
+    app::SetAttributePersistenceProvider(&Server::GetInstance().GetDefaultAttributePersister());
+    Platform::Delete(gWriteBehindAttributePersister);
+    gWriteBehindAttributePersister = nullptr;
+}
+
 void EventHandler(const DeviceLayer::ChipDeviceEvent * event, intptr_t arg)
 {
     (void) arg;
@@ -553,6 +604,11 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     static EnergyReportingTestEventTriggerHandler sEnergyReportingTestEventTriggerHandler;
     sTestEventTriggerDelegate.AddHandler(&sEnergyReportingTestEventTriggerHandler);
 #endif
+#if CHIP_CONFIG_IM_LATENCY_STATS
+    static app::InteractionLatencyStatsTestEventTriggerHandler sInteractionLatencyStatsTestEventTriggerHandler(
+        app::GetInteractionLatencyStats());
+    sTestEventTriggerDelegate.AddHandler(&sInteractionLatencyStatsTestEventTriggerHandler);
+#endif
 
     initParams.testEventTriggerDelegate = &sTestEventTriggerDelegate;
 
@@ -565,6 +621,9 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     // Init ZCL Data Model and CHIP App Server
     Server::GetInstance().Init(initParams);
 
+    // The attributes have been loaded from storage by Server::Init, defer the writes from now on.
+    InitWriteBehindAttributePersister();
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     // Set ReadHandler Capacity for Subscriptions
     chip::app::InteractionModelEngine::GetInstance()->SetHandlerCapacityForSubscriptions(
@@ -629,6 +688,7 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     shellThread.join();
 #endif
 
+    ShutdownWriteBehindAttributePersister();
     Server::GetInstance().Shutdown();
 
 #if ENABLE_TRACING
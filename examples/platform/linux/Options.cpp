@@ -105,6 +105,8 @@ enum
 #if CHIP_WITH_NLFAULTINJECTION
     kDeviceOption_FaultInjection = 0x1027,
 #endif
+    kDeviceOption_AttributeWriteMaxDelay  = 0x1028,
+    kDeviceOption_AttributeWriteIdleDelay = 0x1029,
 };
 
 constexpr unsigned kAppUsageLength = 64;
@@ -170,6 +172,8 @@ OptionDef sDeviceOptionDefs[] = {
 #if CHIP_WITH_NLFAULTINJECTION
     { "faults", kArgumentRequired, kDeviceOption_FaultInjection },
 #endif
+    { "attribute-write-max-delay", kArgumentRequired, kDeviceOption_AttributeWriteMaxDelay },
+    { "attribute-write-idle-delay", kArgumentRequired, kDeviceOption_AttributeWriteIdleDelay },
     {}
 };
 
@@ -305,6 +309,12 @@ const char * sDeviceOptionHelp =
     "  --faults <fault-string,...>\n"
     "       Inject specified fault(s) at runtime.\n"
 #endif
+    "  --attribute-write-max-delay <ms>\n"
+    "       Keep persisted attribute changes in memory and write them all at once, at most <ms> milliseconds after the\n"
+    "       first one. Disabled (each change is written immediately) when not set or 0.\n"
+    "  --attribute-write-idle-delay <ms>\n"
+    "       With --attribute-write-max-delay, write the pending attribute changes once none has been made for <ms>\n"
+    "       milliseconds. Defaults to 1000.\n"
     "\n";
 
 bool Base64ArgToVector(const char * arg, size_t maxSize, std::vector<uint8_t> & outVector)
@@ -589,6 +599,12 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
         break;
     }
 #endif
+    case kDeviceOption_AttributeWriteMaxDelay:
+        LinuxDeviceOptions::GetInstance().attributeWriteMaxDelayMs = static_cast<uint32_t>(strtoul(aValue, nullptr, 0));
+        break;
+    case kDeviceOption_AttributeWriteIdleDelay:
+        LinuxDeviceOptions::GetInstance().attributeWriteIdleDelayMs = static_cast<uint32_t>(strtoul(aValue, nullptr, 0));
+        break;
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
         retval = false;
@@ -68,7 +68,9 @@ struct LinuxDeviceOptions
     uint8_t testEventTriggerEnableKey[16] = { 0 };
     chip::FabricId commissionerFabricId   = chip::kUndefinedFabricId;
     std::vector<std::string> traceTo;
-    bool mSimulateNoInternalTime = false;
+    bool mSimulateNoInternalTime       = false;
+    uint32_t attributeWriteMaxDelayMs  = 0; // 0 writes persisted attributes through
+    uint32_t attributeWriteIdleDelayMs = 1000;
 #if defined(PW_RPC_ENABLED)
     uint16_t rpcServerPort = 33000;
 #endif
@@ -29,6 +29,8 @@
 #include <lib/support/DLLUtil.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <algorithm>
+
 using namespace chip;
 
 // TODO: Need to make it so that declarations of things that don't depend on generated files are not intermixed in af.h with
@@ -67,6 +69,14 @@ AttributePathExpandIterator::AttributePathExpandIterator(SingleLinkedListNode<At
                   "If this changes audit all uses where we set to UINT8_MAX");
     mGlobalAttributeIndex = UINT8_MAX;
 
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+    mTableEndpoint  = AttributePathTable::kInvalidIndex;
+    mTableAttribute = AttributePathTable::kInvalidIndex;
+    // An iterator without paths, e.g. the one of an unused ReadHandler, has no use for the table.
+    mUseTable        = (aAttributePath != nullptr) && AttributePathTable::Instance().EnsureBuilt();
+    mTableGeneration = AttributePathTable::Instance().GetGeneration();
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+
     // Make the iterator ready to emit the first valid path in the list.
     Next();
 }
@@ -167,11 +177,21 @@ void AttributePathExpandIterator::ResetCurrentCluster()
     // in a valid path, which is the first attribute id we will emit for the current cluster.
     mAttributeIndex       = UINT16_MAX;
     mGlobalAttributeIndex = UINT8_MAX;
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+    mTableAttribute = AttributePathTable::kInvalidIndex;
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
     Next();
 }
 
 bool AttributePathExpandIterator::Next()
 {
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+    if (mUseTable)
+    {
+        return NextFromTable();
+    }
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+
     for (; mpAttributePath != nullptr; (mpAttributePath = mpAttributePath->mpNext, mEndpointIndex = UINT16_MAX))
     {
         mOutputPath.mExpanded = mpAttributePath->mValue.IsWildcardPath();
@@ -255,5 +275,259 @@ bool AttributePathExpandIterator::Next()
     mOutputPath = ConcreteReadAttributePath();
     return false;
 }
+
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+
+void AttributePathExpandIterator::PrepareTableEndpointRange(const AttributePathTable & aTable,
+                                                            const AttributePathParams & aAttributePath)
+{
+    if (aAttributePath.HasWildcardEndpointId())
+    {
+        mTableEndpoint    = 0;
+        mTableEndEndpoint = aTable.GetEndpointCount();
+        return;
+    }
+
+    uint32_t index = aTable.FindEndpoint(aAttributePath.mEndpointId);
+    if (index == AttributePathTable::kInvalidIndex)
+    {
+        mTableEndpoint = mTableEndEndpoint = 0;
+        return;
+    }
+    mTableEndpoint    = index;
+    mTableEndEndpoint = index + 1;
+}
+
+void AttributePathExpandIterator::PrepareTableClusterRange(const AttributePathTable & aTable,
+                                                           const AttributePathParams & aAttributePath,
+                                                           const AttributePathTable::Endpoint & aEndpoint)
+{
+    if (aAttributePath.HasWildcardClusterId())
+    {
+        mTableCluster    = aEndpoint.mFirstCluster;
+        mTableEndCluster = aEndpoint.mEndCluster;
+        return;
+    }
+
+    uint32_t index = aTable.FindCluster(aEndpoint, aAttributePath.mClusterId);
+    if (index == AttributePathTable::kInvalidIndex)
+    {
+        mTableCluster = mTableEndCluster = 0;
+        return;
+    }
+    mTableCluster    = index;
+    mTableEndCluster = index + 1;
+}
+
+void AttributePathExpandIterator::PrepareTableAttributeRange(const AttributePathTable & aTable,
+                                                             const AttributePathParams & aAttributePath,
+                                                             const AttributePathTable::Cluster & aCluster)
+{
+    if (aAttributePath.HasWildcardAttributeId())
+    {
+        mTableAttribute    = aCluster.mFirstAttribute;
+        mTableEndAttribute = aCluster.mEndAttribute;
+        return;
+    }
+
+    // The table lists the global attributes that are not in the metadata too, so they are found here as well.
+    uint32_t index = aTable.FindAttribute(aCluster, aAttributePath.mAttributeId);
+    if (index == AttributePathTable::kInvalidIndex)
+    {
+        mTableAttribute = mTableEndAttribute = 0;
+        return;
+    }
+    mTableAttribute    = index;
+    mTableEndAttribute = index + 1;
+}
+
+void AttributePathExpandIterator::SeekInRebuiltTable(const AttributePathTable & aTable)
+{
+    mTableGeneration = aTable.GetGeneration();
+
+    // Concrete paths, and wildcard paths that have not been expanded yet, have no indexes into the table.
+    VerifyOrReturn(mpAttributePath != nullptr && mpAttributePath->mValue.IsWildcardPath() &&
+                   mTableEndpoint != AttributePathTable::kInvalidIndex);
+
+    const AttributePathParams & attributePath = mpAttributePath->mValue;
+    // ResetCurrentCluster() was called, the cluster of the last emitted path is expanded again.
+    const bool restartCluster = (mTableAttribute == AttributePathTable::kInvalidIndex);
+
+    // The endpoints before the one of the last emitted path, in ember order, have been expanded already.
+    PrepareTableEndpointRange(aTable, attributePath);
+    mTableEndpoint = std::max(mTableEndpoint, aTable.FindEndpointFromEmberIndex(mTableEmberIndex));
+    mTableCluster  = AttributePathTable::kInvalidIndex;
+    VerifyOrReturn(mTableEndpoint < mTableEndEndpoint);
+
+    // If the endpoint of the last emitted path was disabled, the next one is expanded from its start.
+    const AttributePathTable::Endpoint & endpoint = aTable.GetEndpoint(mTableEndpoint);
+    VerifyOrReturn(endpoint.mEndpointId == mOutputPath.mEndpointId);
+
+    // The clusters of an endpoint only change when it is replaced, in which case it is expanded from its start as well.
+    PrepareTableClusterRange(aTable, attributePath, endpoint);
+    uint32_t clusterIndex = aTable.FindCluster(endpoint, mOutputPath.mClusterId);
+    if (clusterIndex == AttributePathTable::kInvalidIndex)
+    {
+        mTableCluster = AttributePathTable::kInvalidIndex;
+        return;
+    }
+    mTableCluster = clusterIndex;
+
+    const AttributePathTable::Cluster & cluster = aTable.GetCluster(mTableCluster);
+    PrepareTableAttributeRange(aTable, attributePath, cluster);
+    uint32_t attributeIndex = aTable.FindAttribute(cluster, mOutputPath.mAttributeId);
+    if (restartCluster)
+    {
+        mTableAttribute = AttributePathTable::kInvalidIndex;
+    }
+    else if (attributeIndex != AttributePathTable::kInvalidIndex)
+    {
+        mTableAttribute = attributeIndex + 1;
+    }
+    // Otherwise the attributes of the cluster changed, and it is expanded from its start.
+}
+
+void AttributePathExpandIterator::SeekInDataModel()
+{
+    mUseTable = false;
+
+    mEndpointIndex        = UINT16_MAX;
+    mClusterIndex         = UINT8_MAX;
+    mAttributeIndex       = UINT16_MAX;
+    mGlobalAttributeIndex = UINT8_MAX;
+
+    // Paths that have not been expanded yet start from scratch.
+    VerifyOrReturn(mpAttributePath != nullptr && mTableEndpoint != AttributePathTable::kInvalidIndex);
+
+    const AttributePathParams & attributePath = mpAttributePath->mValue;
+    if (!attributePath.IsWildcardPath())
+    {
+        // This concrete path was emitted already.
+        mEndpointIndex = mEndEndpointIndex = 0;
+        return;
+    }
+
+    // ResetCurrentCluster() was called, the cluster of the last emitted path is expanded again.
+    const bool restartCluster = (mTableAttribute == AttributePathTable::kInvalidIndex);
+
+    // The endpoints before the one of the last emitted path, in ember order, have been expanded already.
+    PrepareEndpointIndexRange(attributePath);
+    mEndpointIndex = std::max(mEndpointIndex, mTableEmberIndex);
+    VerifyOrReturn(mEndpointIndex < mEndEndpointIndex);
+
+    // If the endpoint of the last emitted path was disabled, what is now at its index is expanded from its start.
+    VerifyOrReturn(emberAfEndpointIndexIsEnabled(mEndpointIndex) &&
+                   emberAfEndpointFromIndex(mEndpointIndex) == mOutputPath.mEndpointId);
+
+    PrepareClusterIndexRange(attributePath, mOutputPath.mEndpointId);
+    uint8_t clusterIndex = emberAfClusterIndex(mOutputPath.mEndpointId, mOutputPath.mClusterId, CLUSTER_MASK_SERVER);
+    if (clusterIndex == UINT8_MAX)
+    {
+        mClusterIndex = UINT8_MAX;
+        return;
+    }
+    mClusterIndex = clusterIndex;
+    VerifyOrReturn(!restartCluster);
+
+    PrepareAttributeIndexRange(attributePath, mOutputPath.mEndpointId, mOutputPath.mClusterId);
+    uint16_t attributeIndex =
+        emberAfGetServerAttributeIndexByAttributeId(mOutputPath.mEndpointId, mOutputPath.mClusterId, mOutputPath.mAttributeId);
+    if (attributeIndex != UINT16_MAX)
+    {
+        mAttributeIndex = static_cast<uint16_t>(attributeIndex + 1);
+        return;
+    }
+
+    // The last emitted path was a global attribute that is not in the metadata, which come after all the others.
+    for (uint8_t idx = 0; idx < ArraySize(GlobalAttributesNotInMetadata); ++idx)
+    {
+        if (GlobalAttributesNotInMetadata[idx] == mOutputPath.mAttributeId)
+        {
+            mAttributeIndex       = mEndAttributeIndex;
+            mGlobalAttributeIndex = static_cast<uint8_t>(idx + 1);
+            return;
+        }
+    }
+    // Otherwise the attributes of the cluster changed, and it is expanded from its start.
+    mAttributeIndex       = UINT16_MAX;
+    mGlobalAttributeIndex = UINT8_MAX;
+}
+
+bool AttributePathExpandIterator::NextFromTable()
+{
+    AttributePathTable & table = AttributePathTable::Instance();
+    if (!table.EnsureBuilt())
+    {
+        // The data model changed and the table could not follow: carry on from the data model itself.
+        SeekInDataModel();
+        return Next();
+    }
+
+    if (table.GetGeneration() != mTableGeneration)
+    {
+        SeekInRebuiltTable(table);
+    }
+
+    for (; mpAttributePath != nullptr;
+         (mpAttributePath = mpAttributePath->mpNext, mTableEndpoint = AttributePathTable::kInvalidIndex))
+    {
+        mOutputPath.mExpanded = mpAttributePath->mValue.IsWildcardPath();
+
+        if (mTableEndpoint == AttributePathTable::kInvalidIndex)
+        {
+            // Special case: If this is a concrete path, we just return its value as-is.
+            if (!mpAttributePath->mValue.IsWildcardPath())
+            {
+                mOutputPath.mEndpointId  = mpAttributePath->mValue.mEndpointId;
+                mOutputPath.mClusterId   = mpAttributePath->mValue.mClusterId;
+                mOutputPath.mAttributeId = mpAttributePath->mValue.mAttributeId;
+
+                // Prepare for next iteration
+                mTableEndpoint = mTableEndEndpoint = 0;
+                return true;
+            }
+
+            PrepareTableEndpointRange(table, mpAttributePath->mValue);
+            mTableCluster = AttributePathTable::kInvalidIndex;
+        }
+
+        for (; mTableEndpoint < mTableEndEndpoint; (mTableEndpoint++, mTableCluster = AttributePathTable::kInvalidIndex))
+        {
+            const AttributePathTable::Endpoint & endpoint = table.GetEndpoint(mTableEndpoint);
+
+            if (mTableCluster == AttributePathTable::kInvalidIndex)
+            {
+                PrepareTableClusterRange(table, mpAttributePath->mValue, endpoint);
+                mTableAttribute = AttributePathTable::kInvalidIndex;
+            }
+
+            for (; mTableCluster < mTableEndCluster; (mTableCluster++, mTableAttribute = AttributePathTable::kInvalidIndex))
+            {
+                const AttributePathTable::Cluster & cluster = table.GetCluster(mTableCluster);
+
+                if (mTableAttribute == AttributePathTable::kInvalidIndex)
+                {
+                    PrepareTableAttributeRange(table, mpAttributePath->mValue, cluster);
+                }
+
+                if (mTableAttribute < mTableEndAttribute)
+                {
+                    mOutputPath.mAttributeId = table.GetAttributeId(mTableAttribute);
+                    mOutputPath.mClusterId   = cluster.mClusterId;
+                    mOutputPath.mEndpointId  = endpoint.mEndpointId;
+                    mTableEmberIndex         = endpoint.mEmberIndex;
+                    mTableAttribute++;
+                    return true;
+                }
+            }
+        }
+    }
+
+    // Reset to default, invalid value.
+    mOutputPath = ConcreteReadAttributePath();
+    return false;
+}
+
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
 } // namespace app
 } // namespace chip
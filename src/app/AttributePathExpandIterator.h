@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
+#include <app/AttributePathTable.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/EventManagement.h>
 #include <lib/core/CHIPCore.h>
@@ -56,6 +58,12 @@ namespace app {
  * The iterator does not copy the given AttributePathParams, The given AttributePathParams must be valid when using the iterator.
  * If the set of endpoints, clusters, or attributes that are supported changes, AttributePathExpandIterator must be reinitialized.
  *
+ * When CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE is enabled, the iterator walks the AttributePathTable instead of querying the data
+ * model for every path, so that resuming a wildcard expansion in the next chunk does not depend on the number of endpoints. If
+ * the table is rebuilt because endpoints were enabled or disabled, the iterator resumes after the last path it emitted, and
+ * does not have to be reinitialized. If the table cannot be rebuilt, the iterator resumes in the same way from the data model
+ * itself, and keeps walking the data model until it is reinitialized.
+ *
  * A initialized iterator will return the first valid path, no need to call Next() before calling Get() for the first time.
  *
  * Note: The Next() and Get() are two separate operations by design since a possible call of this iterator might be:
@@ -118,6 +126,44 @@ private:
     // metadata.
     uint8_t mGlobalAttributeIndex, mGlobalAttributeEndIndex;
 
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+    // Whether the paths are expanded from the AttributePathTable, decided when the iterator is initialized. Cleared for good
+    // if the table goes out of date and cannot be rebuilt.
+    bool mUseTable = false;
+    // Generation of the table the indexes below refer to.
+    uint32_t mTableGeneration = 0;
+    // Ember index of the endpoint of the last emitted path, to find where to resume in a rebuilt table.
+    uint16_t mTableEmberIndex = 0;
+    uint32_t mTableEndpoint, mTableEndEndpoint;
+    uint32_t mTableCluster, mTableEndCluster;
+    uint32_t mTableAttribute, mTableEndAttribute;
+
+    bool NextFromTable();
+
+    /**
+     * PrepareTable*Range work as the Prepare*IndexRange functions below, with indexes into the AttributePathTable. A range
+     * that does not exist is empty, and AttributePathTable::kInvalidIndex means that the range has not been prepared yet.
+     */
+    void PrepareTableEndpointRange(const AttributePathTable & aTable, const AttributePathParams & aAttributePath);
+    void PrepareTableClusterRange(const AttributePathTable & aTable, const AttributePathParams & aAttributePath,
+                                  const AttributePathTable::Endpoint & aEndpoint);
+    void PrepareTableAttributeRange(const AttributePathTable & aTable, const AttributePathParams & aAttributePath,
+                                    const AttributePathTable::Cluster & aCluster);
+
+    /**
+     * Move the table indexes to where the expansion of the current path resumes in a rebuilt table: just after the last
+     * emitted path if its endpoint, cluster and attribute still exist, at the start of its cluster or endpoint otherwise, or at
+     * the next endpoint in ember order if its endpoint was disabled.
+     */
+    void SeekInRebuiltTable(const AttributePathTable & aTable);
+
+    /**
+     * Stop using the table, which is out of date, and move the ember indexes to where the expansion of the current path
+     * resumes, in the same way as SeekInRebuiltTable().
+     */
+    void SeekInDataModel();
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+
     /**
      * Prepare*IndexRange will update mBegin*Index and mEnd*Index variables.
      * If AttributePathParams contains a wildcard field, it will set mBegin*Index to 0 and mEnd*Index to count.
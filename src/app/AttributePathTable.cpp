@@ -0,0 +1,227 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathTable.h>
+
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+
+#include <app/GlobalAttributes.h>
+#include <lib/core/Optional.h>
+#include <lib/support/CHIPFaultInjection.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+using namespace chip;
+
+// The same declarations as in AttributePathExpandIterator.cpp, see the TODO there.
+extern uint16_t emberAfEndpointCount();
+extern uint8_t emberAfClusterCount(EndpointId endpoint, bool server);
+extern uint16_t emberAfGetServerAttributeCount(chip::EndpointId endpoint, chip::ClusterId cluster);
+extern chip::EndpointId emberAfEndpointFromIndex(uint16_t index);
+extern Optional<ClusterId> emberAfGetNthClusterId(chip::EndpointId endpoint, uint8_t n, bool server);
+extern Optional<AttributeId> emberAfGetServerAttributeIdByIndex(chip::EndpointId endpoint, chip::ClusterId cluster,
+                                                                uint16_t attributeIndex);
+extern bool emberAfEndpointIndexIsEnabled(uint16_t index);
+
+namespace chip {
+namespace app {
+
+AttributePathTable & AttributePathTable::Instance()
+{
+    static AttributePathTable sInstance;
+    return sInstance;
+}
+
+bool AttributePathTable::EnsureBuilt()
+{
+    if (mDirty)
+    {
+        CHIP_ERROR err = Build();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to build the attribute path table: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+    // A table left over from before a failed rebuild does not match the data model anymore.
+    return !mDirty;
+}
+
+void AttributePathTable::Free()
+{
+    Platform::MemoryFree(mEndpoints);
+    Platform::MemoryFree(mClusters);
+    Platform::MemoryFree(mAttributes);
+    mEndpoints     = nullptr;
+    mClusters      = nullptr;
+    mAttributes    = nullptr;
+    mEndpointCount = 0;
+    mDirty         = true;
+}
+
+CHIP_ERROR AttributePathTable::Build()
+{
+    // First pass: size the table.
+    const uint16_t emberEndpointCount = emberAfEndpointCount();
+    uint32_t endpointCount            = 0;
+    uint32_t clusterCount             = 0;
+    uint32_t attributeCount           = 0;
+    for (uint16_t endpointIndex = 0; endpointIndex < emberEndpointCount; endpointIndex++)
+    {
+        if (!emberAfEndpointIndexIsEnabled(endpointIndex))
+        {
+            continue;
+        }
+        EndpointId endpointId        = emberAfEndpointFromIndex(endpointIndex);
+        uint8_t endpointClusterCount = emberAfClusterCount(endpointId, true /* server */);
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointClusterCount; clusterIndex++)
+        {
+            ClusterId clusterId = emberAfGetNthClusterId(endpointId, clusterIndex, true /* server */).Value();
+            attributeCount += static_cast<uint32_t>(emberAfGetServerAttributeCount(endpointId, clusterId) +
+                                                    ArraySize(GlobalAttributesNotInMetadata));
+        }
+        clusterCount += endpointClusterCount;
+        endpointCount++;
+    }
+
+    // Allocate at least one entry of each, so that an empty data model still has a table.
+    auto * endpoints  = static_cast<Endpoint *>(Platform::MemoryCalloc(endpointCount + 1, sizeof(Endpoint)));
+    auto * clusters   = static_cast<Cluster *>(Platform::MemoryCalloc(clusterCount + 1, sizeof(Cluster)));
+    auto * attributes = static_cast<AttributeId *>(Platform::MemoryCalloc(attributeCount + 1, sizeof(AttributeId)));
+    CHIP_FAULT_INJECT(FaultInjection::kFault_AllocAttributePathTable, {
+        Platform::MemoryFree(endpoints);
+        endpoints = nullptr;
+    });
+    if (endpoints == nullptr || clusters == nullptr || attributes == nullptr)
+    {
+        // The table stays dirty, the rebuild is tried again on the next call.
+        Platform::MemoryFree(endpoints);
+        Platform::MemoryFree(clusters);
+        Platform::MemoryFree(attributes);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    // Second pass: fill it in.
+    uint32_t endpointPos  = 0;
+    uint32_t clusterPos   = 0;
+    uint32_t attributePos = 0;
+    for (uint16_t endpointIndex = 0; endpointIndex < emberEndpointCount && endpointPos < endpointCount; endpointIndex++)
+    {
+        if (!emberAfEndpointIndexIsEnabled(endpointIndex))
+        {
+            continue;
+        }
+        Endpoint & endpoint      = endpoints[endpointPos++];
+        endpoint.mEndpointId     = emberAfEndpointFromIndex(endpointIndex);
+        endpoint.mEmberIndex     = endpointIndex;
+        endpoint.mFirstCluster   = clusterPos;
+        uint8_t endpointClusters = emberAfClusterCount(endpoint.mEndpointId, true /* server */);
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointClusters && clusterPos < clusterCount; clusterIndex++)
+        {
+            Cluster & cluster           = clusters[clusterPos++];
+            cluster.mClusterId          = emberAfGetNthClusterId(endpoint.mEndpointId, clusterIndex, true /* server */).Value();
+            cluster.mFirstAttribute     = attributePos;
+            uint16_t metadataAttributes = emberAfGetServerAttributeCount(endpoint.mEndpointId, cluster.mClusterId);
+            for (uint16_t attributeIndex = 0; attributeIndex < metadataAttributes && attributePos < attributeCount;
+                 attributeIndex++)
+            {
+                attributes[attributePos++] =
+                    emberAfGetServerAttributeIdByIndex(endpoint.mEndpointId, cluster.mClusterId, attributeIndex).Value();
+            }
+            for (size_t i = 0; i < ArraySize(GlobalAttributesNotInMetadata) && attributePos < attributeCount; i++)
+            {
+                attributes[attributePos++] = GlobalAttributesNotInMetadata[i];
+            }
+            cluster.mEndAttribute = attributePos;
+        }
+        endpoint.mEndCluster = clusterPos;
+    }
+
+    Free();
+    mEndpoints     = endpoints;
+    mClusters      = clusters;
+    mAttributes    = attributes;
+    mEndpointCount = endpointPos;
+    mDirty         = false;
+    mGeneration++;
+
+    ChipLogDetail(DataManagement, "Built the attribute path table: %" PRIu32 " endpoints, %" PRIu32 " clusters, %" PRIu32
+                  " attributes", endpointPos, clusterPos, attributePos);
+    return CHIP_NO_ERROR;
+}
+
+uint32_t AttributePathTable::FindEndpoint(EndpointId aEndpointId) const
+{
+    for (uint32_t i = 0; i < mEndpointCount; i++)
+    {
+        if (mEndpoints[i].mEndpointId == aEndpointId)
+        {
+            return i;
+        }
+    }
+    return kInvalidIndex;
+}
+
+uint32_t AttributePathTable::FindEndpointFromEmberIndex(uint16_t aEmberIndex) const
+{
+    // Endpoints are sorted by ember index.
+    uint32_t low  = 0;
+    uint32_t high = mEndpointCount;
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+        if (mEndpoints[mid].mEmberIndex < aEmberIndex)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+uint32_t AttributePathTable::FindCluster(const Endpoint & aEndpoint, ClusterId aClusterId) const
+{
+    for (uint32_t i = aEndpoint.mFirstCluster; i < aEndpoint.mEndCluster; i++)
+    {
+        if (mClusters[i].mClusterId == aClusterId)
+        {
+            return i;
+        }
+    }
+    return kInvalidIndex;
+}
+
+uint32_t AttributePathTable::FindAttribute(const Cluster & aCluster, AttributeId aAttributeId) const
+{
+    for (uint32_t i = aCluster.mFirstAttribute; i < aCluster.mEndAttribute; i++)
+    {
+        if (mAttributes[i] == aAttributeId)
+        {
+            return i;
+        }
+    }
+    return kInvalidIndex;
+}
+
+} // namespace app
+} // namespace chip
+
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AppConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief Flattened table of the enabled endpoints, their server clusters and the attributes of those clusters.
+ *
+ * Expanding a wildcard path through the ember data model re-resolves the endpoint and cluster for every path it emits, which
+ * is linear in the number of endpoints. The table is built once from the data model and then lets AttributePathExpandIterator
+ * walk the paths with plain array indexes, and resume from them in constant time.
+ *
+ * - Endpoints are kept in ember index order, and each one refers to a contiguous range of clusters.
+ * - Clusters are kept in ember order, and each one refers to a contiguous range of attribute ids: the attributes of its
+ *   metadata, followed by the global attributes that are not part of the metadata.
+ *
+ * The data model must call MarkDirty() whenever the set of enabled endpoints changes. The table is then rebuilt, from the heap,
+ * the next time EnsureBuilt() is called. If the rebuild fails, the table is out of date: EnsureBuilt() returns false, so that
+ * paths are expanded from the data model itself, and the rebuild is tried again on the next call.
+ */
+class AttributePathTable
+{
+public:
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+    struct Endpoint
+    {
+        EndpointId mEndpointId;
+        uint16_t mEmberIndex;
+        uint32_t mFirstCluster;
+        uint32_t mEndCluster;
+    };
+
+    struct Cluster
+    {
+        ClusterId mClusterId;
+        uint32_t mFirstAttribute;
+        uint32_t mEndAttribute;
+    };
+
+    static AttributePathTable & Instance();
+
+    /**
+     * @brief Mark the table out of date. Must be called every time an endpoint is enabled or disabled, or the configuration
+     * of the data model changes otherwise.
+     */
+    void MarkDirty() { mDirty = true; }
+
+    /**
+     * @brief Rebuild the table if it is out of date.
+     *
+     * @return true if the table is up to date and can be used, false if it could not be rebuilt.
+     */
+    bool EnsureBuilt();
+
+    /**
+     * @brief Release the memory held by the table. The next call to EnsureBuilt() rebuilds it.
+     */
+    void Free();
+
+    /**
+     * @brief Incremented every time the table is rebuilt, so that indexes into a previous table can be detected.
+     */
+    uint32_t GetGeneration() const { return mGeneration; }
+
+    uint32_t GetEndpointCount() const { return mEndpointCount; }
+    const Endpoint & GetEndpoint(uint32_t aIndex) const { return mEndpoints[aIndex]; }
+    const Cluster & GetCluster(uint32_t aIndex) const { return mClusters[aIndex]; }
+    AttributeId GetAttributeId(uint32_t aIndex) const { return mAttributes[aIndex]; }
+
+    /// @brief Index of the endpoint with the given id, or kInvalidIndex if it is not enabled
+    uint32_t FindEndpoint(EndpointId aEndpointId) const;
+
+    /// @brief Index of the first endpoint with an ember index at or after the given one, or GetEndpointCount() if there is none
+    uint32_t FindEndpointFromEmberIndex(uint16_t aEmberIndex) const;
+
+    /// @brief Index of the server cluster with the given id on an endpoint, or kInvalidIndex if there is none
+    uint32_t FindCluster(const Endpoint & aEndpoint, ClusterId aClusterId) const;
+
+    /// @brief Index of the attribute with the given id in a cluster, or kInvalidIndex if there is none
+    uint32_t FindAttribute(const Cluster & aCluster, AttributeId aAttributeId) const;
+
+private:
+    CHIP_ERROR Build();
+
+    Endpoint * mEndpoints     = nullptr;
+    Cluster * mClusters       = nullptr;
+    AttributeId * mAttributes = nullptr;
+    uint32_t mEndpointCount   = 0;
+    uint32_t mGeneration      = 0;
+    bool mDirty               = true;
+};
+
+} // namespace app
+} // namespace chip
+
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
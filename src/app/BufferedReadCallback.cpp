@@ -36,6 +36,8 @@ void BufferedReadCallback::OnReportBegin()
 
 void BufferedReadCallback::OnReportEnd()
 {
+    EndStreamedList(StatusIB());
+
     CHIP_ERROR err = DispatchBufferedData(mBufferedPath, StatusIB(), true);
     if (err != CHIP_NO_ERROR)
     {
@@ -107,8 +109,8 @@ CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
     System::PacketBufferHandle handle;
 
     //
-    // We conservatively allocate a packet buffer as big as an IPv6 MTU (since we're buffering
-    // data received over the wire, which should always fit within that).
+    // We conservatively allocate a packet buffer as big as the largest message the session can carry (since we're buffering
+    // data received over the wire, which should always fit within that; over TCP, it may exceed an IPv6 MTU).
     //
     // We could have snapshotted the reader at its current position, advanced it past the current element
     // and computed the delta in its read point to figure out the size of the element before allocating
@@ -117,7 +119,7 @@ CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
     // TLV element. Since the tag can vary in size, for now, let's just do the safe thing. In the future, if this is a problem,
     // we can improve this.
     //
-    handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    handle = System::PacketBufferHandle::New(mMaxSduLength);
     VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     writer.Init(std::move(handle), false);
@@ -170,6 +172,80 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR BufferedReadCallback::StreamData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                            const StatusIB & aStatus)
+{
+    bool isListData     = aPath.IsListOperation() && aStatus.mStatus == Protocols::InteractionModel::Status::Success;
+    bool isStreamedPath = mIsStreamingList && mStreamedPath.MatchesConcreteAttributePath(aPath);
+
+    //
+    // Anything but more items of the list being streamed ends it. An error for the list itself means that the list
+    // was only partially delivered.
+    //
+    if (mIsStreamingList && !(isListData && isStreamedPath))
+    {
+        EndStreamedList(isStreamedPath ? aStatus : StatusIB());
+    }
+
+    if (!isListData)
+    {
+        mCallback.OnAttributeData(aPath, apData, aStatus);
+        return CHIP_NO_ERROR;
+    }
+
+    //
+    // A ReplaceAll starts the list over, without ending it if it is the list being streamed, since the list delivered so far
+    // is replaced. As when buffering, items appended to a list that was not started in this report are delivered as the
+    // whole list.
+    //
+    if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::ReplaceAll || !isStreamedPath)
+    {
+        mStreamedPath         = aPath;
+        mStreamedPath.mListOp = ConcreteDataAttributePath::ListOperation::ReplaceAll;
+        mNextListIndex        = 0;
+        mIsStreamingList      = true;
+        mCallback.OnAttributeListBegin(mStreamedPath);
+    }
+    mStreamedPath.mDataVersion = aPath.mDataVersion;
+
+    //
+    // Hand out a copy of the reader for each item, so that the callback cannot throw off the iteration over the list.
+    //
+    TLV::TLVReader itemReader;
+    if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::ReplaceAll)
+    {
+        TLV::TLVType outerContainer;
+
+        VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+        ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
+
+        CHIP_ERROR err;
+        while ((err = apData->Next()) == CHIP_NO_ERROR)
+        {
+            itemReader.Init(*apData);
+            mCallback.OnAttributeListItem(mStreamedPath, mNextListIndex++, &itemReader);
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+        ReturnErrorOnFailure(apData->ExitContainer(outerContainer));
+    }
+    else if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem)
+    {
+        itemReader.Init(*apData);
+        mCallback.OnAttributeListItem(mStreamedPath, mNextListIndex++, &itemReader);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void BufferedReadCallback::EndStreamedList(const StatusIB & aStatus)
+{
+    VerifyOrReturn(mIsStreamingList);
+
+    mIsStreamingList = false;
+    mCallback.OnAttributeListEnd(mStreamedPath, aStatus);
+}
+
 CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePath & aPath, const StatusIB & aStatusIB,
                                                       bool aEndOfReport)
 {
@@ -232,6 +308,12 @@ void BufferedReadCallback::OnAttributeData(const ConcreteDataAttributePath & aPa
 {
     CHIP_ERROR err;
 
+    if (mListDelivery == ListDelivery::kStreamItems)
+    {
+        err = StreamData(aPath, apData, aStatus);
+        ExitNow();
+    }
+
     //
     // First, let's dispatch to our registered callback any buffered up list data from previous calls.
     //
@@ -259,6 +341,7 @@ void BufferedReadCallback::OnAttributeData(const ConcreteDataAttributePath & aPa
 exit:
     if (err != CHIP_NO_ERROR)
     {
+        EndStreamedList(StatusIB(err));
         mCallback.OnError(err);
     }
 }
@@ -24,6 +24,7 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/ReadClient.h>
+#include <app/StatusResponse.h>
 #include <vector>
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
@@ -36,11 +37,23 @@ namespace app {
  * upon completion of delivery of all chunks. This is then delivered to a compliant ReadClient::Callback
  * without any awareness on their part that chunking happened.
  *
+ * Alternatively, callbacks that can consume list items one at a time can have the list items streamed to them through
+ * OnAttributeListBegin, OnAttributeListItem and OnAttributeListEnd, as they arrive. Nothing is then buffered, and
+ * chunked lists are delivered without any copy.
+ *
  */
 class BufferedReadCallback : public ReadClient::Callback
 {
 public:
-    BufferedReadCallback(Callback & callback) : mCallback(callback) {}
+    enum class ListDelivery : uint8_t
+    {
+        kWholeList,   ///< Reassemble lists and deliver them through OnAttributeData
+        kStreamItems, ///< Deliver list items through OnAttributeListBegin/Item/End as they arrive
+    };
+
+    BufferedReadCallback(Callback & callback, ListDelivery listDelivery = ListDelivery::kWholeList) :
+        mCallback(callback), mListDelivery(listDelivery)
+    {}
 
 private:
     /*
@@ -65,15 +78,33 @@ private:
      */
     CHIP_ERROR BufferData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apReader);
 
+    /*
+     * Deliver data when using ListDelivery::kStreamItems: list items are streamed to the callback, opening a new list
+     * if they do not belong to the one being streamed, and anything else is forwarded as is.
+     */
+    CHIP_ERROR StreamData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apReader, const StatusIB & aStatus);
+
+    /*
+     * Close the list being streamed, if any.
+     */
+    void EndStreamedList(const StatusIB & aStatus);
+
     //
     // ReadClient::Callback
     //
+    void OnReportMaxSduLength(size_t aMaxSduLength) override
+    {
+        mMaxSduLength = aMaxSduLength;
+        mCallback.OnReportMaxSduLength(aMaxSduLength);
+    }
+
     void OnReportBegin() override;
     void OnReportEnd() override;
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
     void OnError(CHIP_ERROR aError) override
     {
         mBufferedList.clear();
+        EndStreamedList(StatusIB(aError));
         return mCallback.OnError(aError);
     }
 
@@ -131,6 +162,15 @@ private:
     ConcreteDataAttributePath mBufferedPath;
     std::vector<System::PacketBufferHandle> mBufferedList;
     Callback & mCallback;
+    const ListDelivery mListDelivery;
+
+    // Largest message the reports being processed can arrive in, which bounds the size of a list item.
+    size_t mMaxSduLength = kMaxSecureSduLengthBytes;
+
+    // State of the list being streamed, when using ListDelivery::kStreamItems.
+    ConcreteDataAttributePath mStreamedPath;
+    ListIndex mNextListIndex = 0;
+    bool mIsStreamingList    = false;
 };
 
 } // namespace app
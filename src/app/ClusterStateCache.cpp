@@ -19,6 +19,10 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+#include <lib/support/SafeInt.h>
+
+#include <algorithm>
+#include <string.h>
 #include <tuple>
 
 namespace chip {
@@ -68,17 +72,6 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
                                           const StatusIB & aStatus)
 {
     AttributeState state;
-    bool endpointIsNew = false;
-
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
-    {
-        //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
-        // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
-        // we can appropriately notify our clients of the addition of a new endpoint.
-        //
-        endpointIsNew = true;
-    }
 
     if (apData)
     {
@@ -100,6 +93,39 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         {
             state.Set<size_t>(elementSize);
         }
+    }
+    else
+    {
+        if (mCacheData)
+        {
+            state.Set<StatusIB>(aStatus);
+        }
+        else
+        {
+            state.Set<size_t>(SizeOfStatusIB(aStatus));
+        }
+    }
+
+    StoreAttributeState(aPath, std::move(state), apData != nullptr);
+    return CHIP_NO_ERROR;
+}
+
+void ClusterStateCache::StoreAttributeState(const ConcreteDataAttributePath & aPath, AttributeState && aState, bool aHasData)
+{
+    bool endpointIsNew = false;
+
+    if (mCache.find(aPath.mEndpointId) == mCache.end())
+    {
+        //
+        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
+        // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
+        // we can appropriately notify our clients of the addition of a new endpoint.
+        //
+        endpointIsNew = true;
+    }
+
+    if (aHasData)
+    {
         //
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
@@ -130,17 +156,6 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
 
         mLastReportDataPath = aPath;
     }
-    else
-    {
-        if (mCacheData)
-        {
-            state.Set<StatusIB>(aStatus);
-        }
-        else
-        {
-            state.Set<size_t>(SizeOfStatusIB(aStatus));
-        }
-    }
 
     //
     // if the endpoint didn't exist previously, let's track the insertion
@@ -151,13 +166,80 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(aState);
 
     if (mCacheData)
     {
         mChangedAttributeSet.insert(aPath);
     }
+}
+
+CHIP_ERROR ClusterStateCache::ReserveListItemsSpace(size_t aSpace)
+{
+    VerifyOrReturnError(mListItems.AllocatedSize() - mListItemsLength < aSpace, CHIP_NO_ERROR);
+
+    Platform::ScopedMemoryBufferWithSize<uint8_t> newBuffer;
+    newBuffer.Alloc(std::max(2 * mListItems.AllocatedSize(), mListItemsLength + aSpace));
+    VerifyOrReturnError(newBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    if (mListItemsLength > 0)
+    {
+        memcpy(newBuffer.Get(), mListItems.Get(), mListItemsLength);
+    }
+
+    // Moving a buffer into another does not free the memory the latter held.
+    mListItems.Free();
+    mListItems = std::move(newBuffer);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ClusterStateCache::AppendListItem(TLV::TLVReader & aReader)
+{
+    // A list item always fits in a single message, so it can be copied in place once that much space is available.
+    ReturnErrorOnFailure(ReserveListItemsSpace(mMaxSduLength));
+
+    TLV::TLVWriter writer;
+    writer.Init(mListItems.Get() + mListItemsLength, mListItems.AllocatedSize() - mListItemsLength);
+    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), aReader));
+    ReturnErrorOnFailure(writer.Finalize());
+    mListItemsLength += writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ClusterStateCache::CommitListItems(const ConcreteDataAttributePath & aPath)
+{
+    // The pre-encoded members of a container include its end.
+    ReturnErrorOnFailure(ReserveListItemsSpace(1));
+    mListItems.Get()[mListItemsLength++] = static_cast<uint8_t>(TLV::TLVElementType::EndOfContainer);
+
+    // The anonymous array only adds its control byte.
+    size_t listSize = mListItemsLength + 1;
+    VerifyOrReturnError(CanCastTo<uint32_t>(listSize), CHIP_ERROR_NO_MEMORY);
+
+    AttributeData list;
+    list.Alloc(listSize);
+    VerifyOrReturnError(list.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    TLV::ScopedBufferTLVWriter writer(std::move(list), listSize);
+    ReturnErrorOnFailure(writer.PutPreEncodedContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, mListItems.Get(),
+                                                       static_cast<uint32_t>(mListItemsLength)));
+    ReturnErrorOnFailure(writer.Finalize(list));
+
+    // The list buffer is owned by the cache once stored, or by this function otherwise, until the call is forwarded.
+    TLV::TLVReader reader;
+    reader.Init(list.Get(), list.AllocatedSize());
+    ReturnErrorOnFailure(reader.Next());
+
+    AttributeState state;
+    if (mCacheData)
+    {
+        state.Set<AttributeData>(std::move(list));
+    }
+    else
+    {
+        state.Set<size_t>(listSize);
+    }
+    StoreAttributeState(aPath, std::move(state), true);
 
+    mCallback.OnAttributeData(aPath, &reader, StatusIB());
     return CHIP_NO_ERROR;
 }
 
@@ -174,7 +256,7 @@ CHIP_ERROR ClusterStateCache::UpdateEventCache(const EventHeader & aEventHeader,
         }
         if (mCacheData)
         {
-            System::PacketBufferHandle handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+            System::PacketBufferHandle handle = System::PacketBufferHandle::New(mMaxSduLength);
             VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
 
             System::PacketBufferTLVWriter writer;
@@ -394,6 +476,41 @@ void ClusterStateCache::OnAttributeData(const ConcreteDataAttributePath & aPath,
     mCallback.OnAttributeData(aPath, apData ? &dataSnapshot : nullptr, aStatus);
 }
 
+void ClusterStateCache::OnAttributeListBegin(const ConcreteDataAttributePath & aPath)
+{
+    mListItemsLength = 0;
+    mListItemsError  = CHIP_NO_ERROR;
+}
+
+void ClusterStateCache::OnAttributeListItem(const ConcreteDataAttributePath & aPath, ListIndex aIndex, TLV::TLVReader * apData)
+{
+    // Once an item could not be copied, the list can no longer be cached.
+    VerifyOrReturn(mListItemsError == CHIP_NO_ERROR);
+    mListItemsError = AppendListItem(*apData);
+}
+
+void ClusterStateCache::OnAttributeListEnd(const ConcreteDataAttributePath & aPath, const StatusIB & aStatus)
+{
+    CHIP_ERROR err = mListItemsError;
+
+    //
+    // A list that was only partially delivered is dropped. The error for the attribute, if there is one, is delivered
+    // through OnAttributeData.
+    //
+    if (err == CHIP_NO_ERROR && aStatus.IsSuccess())
+    {
+        err = CommitListItems(aPath);
+    }
+
+    mListItems.Free();
+    mListItemsLength = 0;
+
+    if (err != CHIP_NO_ERROR)
+    {
+        mCallback.OnError(err);
+    }
+}
+
 CHIP_ERROR ClusterStateCache::GetVersion(const ConcreteClusterPath & aPath, Optional<DataVersion> & aVersion) const
 {
     VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
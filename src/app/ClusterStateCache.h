@@ -25,6 +25,7 @@
 #include <app/AttributePathParams.h>
 #include <app/BufferedReadCallback.h>
 #include <app/ReadClient.h>
+#include <app/StatusResponse.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
 #include <lib/support/Variant.h>
@@ -107,7 +108,7 @@ public:
     ClusterStateCache(Callback & callback, Optional<EventNumber> highestReceivedEventNumber = Optional<EventNumber>::Missing(),
                       bool cacheData = true) :
         mCallback(callback),
-        mBufferedReader(*this), mCacheData(cacheData)
+        mBufferedReader(*this, BufferedReadCallback::ListDelivery::kStreamItems), mCacheData(cacheData)
     {
         mHighestReceivedEventNumber = highestReceivedEventNumber;
     }
@@ -597,6 +598,28 @@ private:
      */
     CHIP_ERROR UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus);
 
+    /*
+     * Stores the state of an attribute in the cache, and tracks the changes to report to the callback. aHasData tells
+     * whether the state comes from attribute data rather than a status.
+     */
+    void StoreAttributeState(const ConcreteDataAttributePath & aPath, AttributeState && aState, bool aHasData);
+
+    /*
+     * Grows mListItems, if needed, so that at least aSpace bytes are available after the items it already holds.
+     */
+    CHIP_ERROR ReserveListItemsSpace(size_t aSpace);
+
+    /*
+     * Copies a streamed list item to the end of mListItems.
+     */
+    CHIP_ERROR AppendListItem(TLV::TLVReader & aReader);
+
+    /*
+     * Wraps the streamed list items into a TLV array, stores it as the value of the attribute and forwards it to the
+     * callback.
+     */
+    CHIP_ERROR CommitListItems(const ConcreteDataAttributePath & aPath);
+
     /*
      * If apData is not null, updates the cached event set with the specified event header + payload.
      * If apData is null and apStatus is not null, the StatusIB is stored in the event status cache.
@@ -609,9 +632,18 @@ private:
     //
     // ReadClient::Callback
     //
+    void OnReportMaxSduLength(size_t aMaxSduLength) override
+    {
+        mMaxSduLength = aMaxSduLength;
+        mCallback.OnReportMaxSduLength(aMaxSduLength);
+    }
+
     void OnReportBegin() override;
     void OnReportEnd() override;
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
+    void OnAttributeListBegin(const ConcreteDataAttributePath & aPath) override;
+    void OnAttributeListItem(const ConcreteDataAttributePath & aPath, ListIndex aIndex, TLV::TLVReader * apData) override;
+    void OnAttributeListEnd(const ConcreteDataAttributePath & aPath, const StatusIB & aStatus) override;
     void OnError(CHIP_ERROR aError) override { return mCallback.OnError(aError); }
 
     void OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus) override;
@@ -671,6 +703,16 @@ private:
     Optional<EventNumber> mHighestReceivedEventNumber;
     std::map<ConcreteEventPath, StatusIB> mEventStatusCache;
     BufferedReadCallback mBufferedReader;
+
+    // Items of the list attribute being streamed by mBufferedReader, copied one after the other as they arrive, so that
+    // the list only needs to be wrapped into an array once complete.
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mListItems;
+    size_t mListItemsLength    = 0;
+    CHIP_ERROR mListItemsError = CHIP_NO_ERROR;
+
+    // Largest message the reports being processed can arrive in, which bounds the size of a list item or an event.
+    size_t mMaxSduLength = kMaxSecureSduLengthBytes;
+
     ConcreteClusterPath mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     const bool mCacheData                   = true;
 };
@@ -60,7 +60,15 @@ CHIP_ERROR CommandHandler::AllocateBuffer()
     {
         mCommandMessageWriter.Reset();
 
-        System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+        // Responses sent over TCP are not bound by the network MTU, so they are chunked in much larger messages.
+        size_t maxSduLength                      = kMaxSecureSduLengthBytes;
+        Messaging::ExchangeContext * exchangeCtx = GetExchangeContext();
+        if (exchangeCtx != nullptr && exchangeCtx->HasSessionHandle() && exchangeCtx->GetSessionHandle()->AllowsLargePayload())
+        {
+            maxSduLength = kMaxLargeSecureSduLengthBytes;
+        }
+
+        System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(maxSduLength);
         VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_NO_MEMORY);
 
         mCommandMessageWriter.Init(std::move(commandPacket));
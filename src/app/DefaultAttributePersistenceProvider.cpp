@@ -27,9 +27,6 @@ CHIP_ERROR DefaultAttributePersistenceProvider::InternalWriteValue(const Storage
 {
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    // TODO: we may want to have a small cache for values that change a lot, so
-    //  we only write them once a bunch of changes happen or on timer or
-    //  shutdown.
     if (!CanCastTo<uint16_t>(aValue.size()))
     {
         return CHIP_ERROR_BUFFER_TOO_SMALL;
@@ -0,0 +1,203 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/InteractionLatencyStats.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <inttypes.h>
+
+namespace chip {
+namespace app {
+
+uint32_t InteractionLatencyStats::Histogram::GetPercentileUs(uint8_t percentile) const
+{
+    VerifyOrReturnValue(mCount > 0, 0);
+
+    // Rank of the requested percentile, rounded up, and at least the first duration.
+    uint64_t rank = (static_cast<uint64_t>(mCount) * chip::min<uint8_t>(percentile, 100) + 99) / 100;
+    rank          = chip::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        seen += mBuckets[i];
+        if (seen >= rank)
+        {
+            return static_cast<uint32_t>(chip::min<uint64_t>(BucketUpperBound(i), mMaxUs));
+        }
+    }
+    return mMaxUs;
+}
+
+InteractionLatencyStats::Scope::Scope(InteractionLatencyStats & stats, Operation operation, ClusterId clusterId) :
+    mStats(stats), mStart(System::SystemClock().GetMonotonicMicroseconds64()), mClusterId(clusterId), mOperation(operation)
+{}
+
+InteractionLatencyStats::Scope::~Scope()
+{
+    size_t bytes = mBytes;
+    if (mpWriter != nullptr && mpWriter->GetLengthWritten() > mWriterLength)
+    {
+        bytes += mpWriter->GetLengthWritten() - mWriterLength;
+    }
+    mStats.Record(mOperation, mClusterId, System::SystemClock().GetMonotonicMicroseconds64() - mStart, bytes);
+}
+
+void InteractionLatencyStats::Record(Operation operation, ClusterId clusterId, System::Clock::Microseconds64 duration,
+                                     size_t bytes)
+{
+    Histogram * histogram = const_cast<Histogram *>(Find(operation, clusterId));
+    if (histogram == nullptr)
+    {
+        if (mHistogramCount == kMaxHistogramCount)
+        {
+            mDroppedCount++;
+            return;
+        }
+        histogram             = &mHistograms[mHistogramCount++];
+        *histogram            = Histogram{};
+        histogram->mClusterId = clusterId;
+        histogram->mOperation = operation;
+    }
+
+    const uint32_t durationUs = static_cast<uint32_t>(chip::min<uint64_t>(duration.count(), UINT32_MAX));
+    histogram->mCount++;
+    histogram->mMinUs = chip::min(histogram->mMinUs, durationUs);
+    histogram->mMaxUs = chip::max(histogram->mMaxUs, durationUs);
+    histogram->mTotalUs += durationUs;
+    histogram->mTotalBytes += bytes;
+    histogram->mBuckets[BucketIndex(durationUs)]++;
+}
+
+const InteractionLatencyStats::Histogram * InteractionLatencyStats::Find(Operation operation, ClusterId clusterId) const
+{
+    for (size_t i = 0; i < mHistogramCount; i++)
+    {
+        if (mHistograms[i].mOperation == operation && mHistograms[i].mClusterId == clusterId)
+        {
+            return &mHistograms[i];
+        }
+    }
+    return nullptr;
+}
+
+void InteractionLatencyStats::Reset()
+{
+    mHistogramCount = 0;
+    mDroppedCount   = 0;
+}
+
+void InteractionLatencyStats::LogStats() const
+{
+    ChipLogProgress(DataManagement, "Interaction Model latency, in microseconds (%u histograms, %" PRIu32 " dropped):",
+                    static_cast<unsigned>(mHistogramCount), mDroppedCount);
+    for (size_t i = 0; i < mHistogramCount; i++)
+    {
+        const Histogram & histogram = mHistograms[i];
+        ChipLogProgress(DataManagement,
+                        "  %-14s cluster " ChipLogFormatMEI ": count %" PRIu32 " min %" PRIu32 " mean %" PRIu32 " p50 %" PRIu32
+                        " p90 %" PRIu32 " p99 %" PRIu32 " max %" PRIu32 " bytes %" PRIu64,
+                        OperationToString(histogram.mOperation), ChipLogValueMEI(histogram.mClusterId), histogram.mCount,
+                        histogram.mMinUs, static_cast<uint32_t>(histogram.mTotalUs / histogram.mCount),
+                        histogram.GetPercentileUs(50), histogram.GetPercentileUs(90), histogram.GetPercentileUs(99),
+                        histogram.mMaxUs, histogram.mTotalBytes);
+    }
+}
+
+const char * InteractionLatencyStats::OperationToString(Operation operation)
+{
+    switch (operation)
+    {
+    case Operation::kRead:
+        return "Read";
+    case Operation::kSubscribe:
+        return "Subscribe";
+    case Operation::kWrite:
+        return "Write";
+    case Operation::kInvoke:
+        return "Invoke";
+    case Operation::kReport:
+        return "Report";
+    case Operation::kAttributeRead:
+        return "AttributeRead";
+    case Operation::kAttributeWrite:
+        return "AttributeWrite";
+    case Operation::kCommand:
+        return "Command";
+    }
+    return "Unknown";
+}
+
+size_t InteractionLatencyStats::BucketIndex(uint64_t durationUs)
+{
+    if (durationUs < kSubBucketCount)
+    {
+        return static_cast<size_t>(durationUs);
+    }
+
+    // The power of two below durationUs selects the bucket group, the next kSubBucketBits bits the bucket within it.
+    uint8_t exponent = 0;
+    for (uint64_t value = durationUs; value > 1; value >>= 1)
+    {
+        exponent++;
+    }
+    const size_t subBucket = static_cast<size_t>(durationUs >> (exponent - kSubBucketBits)) & (kSubBucketCount - 1);
+    const size_t index     = (exponent - kSubBucketBits + 1u) * kSubBucketCount + subBucket;
+    return chip::min(index, kBucketCount - 1);
+}
+
+uint64_t InteractionLatencyStats::BucketUpperBound(size_t index)
+{
+    if (index < kSubBucketCount)
+    {
+        return index;
+    }
+
+    const size_t exponent     = index / kSubBucketCount + kSubBucketBits - 1;
+    const uint64_t width      = uint64_t(1) << (exponent - kSubBucketBits);
+    const uint64_t lowerBound = (kSubBucketCount + index % kSubBucketCount) * width;
+    return lowerBound + width - 1;
+}
+
+CHIP_ERROR InteractionLatencyStatsTestEventTriggerHandler::HandleEventTrigger(uint64_t eventTrigger)
+{
+    switch (eventTrigger)
+    {
+    case kLogStatsTrigger:
+        mStats.LogStats();
+        return CHIP_NO_ERROR;
+    case kResetStatsTrigger:
+        mStats.Reset();
+        return CHIP_NO_ERROR;
+    default:
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+}
+
+#if CHIP_CONFIG_IM_LATENCY_STATS
+InteractionLatencyStats & GetInteractionLatencyStats()
+{
+    static InteractionLatencyStats sStats;
+    return sStats;
+}
+#endif
+
+} // namespace app
+} // namespace chip
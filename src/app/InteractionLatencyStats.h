@@ -0,0 +1,196 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Latency histograms of the interactions handled by the Interaction Model server, kept per cluster and
+ *      operation. The instrumentation is compiled out unless CHIP_CONFIG_IM_LATENCY_STATS is set.
+ */
+
+#pragma once
+
+#include <app/AppConfig.h>
+#include <app/TestEventTriggerDelegate.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVWriter.h>
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Latency histograms and byte counts of the Interaction Model server, one per (cluster, operation) pair.
+ *
+ * The interactions themselves (Read, Subscribe, Write, Invoke and Report) are recorded with kInvalidClusterId, since a
+ * single request may span several clusters. The work done for a single cluster (reading or writing an attribute,
+ * dispatching a command) is recorded with the cluster it targets, which is what points at a slow
+ * AttributeAccessInterface or CommandHandlerInterface.
+ *
+ * Durations are kept in log-linear buckets, in the manner of HDR histograms: every power of two is split in
+ * kSubBucketCount buckets, so a reported percentile is at most 1/kSubBucketCount above the actual value.
+ *
+ * This class is not thread-safe, and must only be used with the Matter stack lock held.
+ */
+class InteractionLatencyStats
+{
+public:
+    enum class Operation : uint8_t
+    {
+        kRead,
+        kSubscribe,
+        kWrite,
+        kInvoke,
+        kReport,
+        kAttributeRead,
+        kAttributeWrite,
+        kCommand,
+    };
+
+    static constexpr uint8_t kSubBucketBits    = 2;
+    static constexpr size_t kSubBucketCount    = 1u << kSubBucketBits;
+    static constexpr size_t kBucketCount       = kSubBucketCount * (32 - kSubBucketBits + 1);
+    static constexpr size_t kMaxHistogramCount = CHIP_CONFIG_IM_LATENCY_STATS_MAX_HISTOGRAMS;
+
+    struct Histogram
+    {
+        ClusterId mClusterId = kInvalidClusterId;
+        Operation mOperation = Operation::kRead;
+        uint32_t mCount      = 0;
+        uint32_t mMinUs      = UINT32_MAX;
+        uint32_t mMaxUs      = 0;
+        uint64_t mTotalUs    = 0;
+        uint64_t mTotalBytes = 0;
+        uint32_t mBuckets[kBucketCount];
+
+        /**
+         * Returns an upper bound of the given percentile (0 to 100) of the recorded durations, in microseconds, or 0
+         * if nothing has been recorded.
+         */
+        uint32_t GetPercentileUs(uint8_t percentile) const;
+    };
+
+    /**
+     * Measures the time between its construction and its destruction, and records it along with the bytes added to
+     * it, or written to the tracked TLV writer, in the meantime.
+     */
+    class Scope
+    {
+    public:
+        Scope(InteractionLatencyStats & stats, Operation operation, ClusterId clusterId);
+        ~Scope();
+
+        Scope(const Scope &)             = delete;
+        Scope & operator=(const Scope &) = delete;
+
+        void AddBytes(size_t bytes) { mBytes += bytes; }
+
+        /**
+         * Count the bytes written to `writer` from now on. `writer` must outlive the scope.
+         */
+        void TrackWriter(const TLV::TLVWriter & writer)
+        {
+            mpWriter      = &writer;
+            mWriterLength = writer.GetLengthWritten();
+        }
+
+    private:
+        InteractionLatencyStats & mStats;
+        const TLV::TLVWriter * mpWriter = nullptr;
+        System::Clock::Microseconds64 mStart;
+        size_t mBytes          = 0;
+        uint32_t mWriterLength = 0;
+        ClusterId mClusterId;
+        Operation mOperation;
+    };
+
+    /**
+     * Record a single duration. Once kMaxHistogramCount pairs are tracked, the durations of new pairs are dropped.
+     */
+    void Record(Operation operation, ClusterId clusterId, System::Clock::Microseconds64 duration, size_t bytes);
+
+    /**
+     * Returns the histogram of the given pair, or nullptr if nothing was recorded for it.
+     */
+    const Histogram * Find(Operation operation, ClusterId clusterId) const;
+
+    size_t GetHistogramCount() const { return mHistogramCount; }
+    const Histogram & GetHistogram(size_t index) const { return mHistograms[index]; }
+
+    /**
+     * Number of durations that were not recorded because all the histograms were in use.
+     */
+    uint32_t GetDroppedCount() const { return mDroppedCount; }
+
+    void Reset();
+
+    /**
+     * Log a summary of every histogram: count, min, mean, p50, p90, p99, max and bytes.
+     */
+    void LogStats() const;
+
+    static const char * OperationToString(Operation operation);
+    static size_t BucketIndex(uint64_t durationUs);
+    static uint64_t BucketUpperBound(size_t index);
+
+private:
+    Histogram mHistograms[kMaxHistogramCount];
+    size_t mHistogramCount = 0;
+    uint32_t mDroppedCount = 0;
+};
+
+/**
+ * Logs the latency statistics with kLogStatsTrigger, and clears them with kResetStatsTrigger.
+ */
+class InteractionLatencyStatsTestEventTriggerHandler : public TestEventTriggerHandler
+{
+public:
+    static constexpr uint64_t kLogStatsTrigger   = 0x0033'0000'1a7e'0000;
+    static constexpr uint64_t kResetStatsTrigger = 0x0033'0000'1a7e'0001;
+
+    explicit InteractionLatencyStatsTestEventTriggerHandler(InteractionLatencyStats & stats) : mStats(stats) {}
+
+    CHIP_ERROR HandleEventTrigger(uint64_t eventTrigger) override;
+
+private:
+    InteractionLatencyStats & mStats;
+};
+
+#if CHIP_CONFIG_IM_LATENCY_STATS
+/**
+ * The statistics recorded by the Interaction Model server.
+ */
+InteractionLatencyStats & GetInteractionLatencyStats();
+#endif
+
+} // namespace app
+} // namespace chip
+
+#if CHIP_CONFIG_IM_LATENCY_STATS
+#define CHIP_IM_LATENCY_SCOPE(scope, operation, clusterId)                                                                         \
+    ::chip::app::InteractionLatencyStats::Scope scope(::chip::app::GetInteractionLatencyStats(), operation, clusterId)
+#define CHIP_IM_LATENCY_ADD_BYTES(scope, bytes) scope.AddBytes(bytes)
+#define CHIP_IM_LATENCY_TRACK_WRITER(scope, writer) scope.TrackWriter(writer)
+#else
+#define CHIP_IM_LATENCY_SCOPE(scope, operation, clusterId)
+#define CHIP_IM_LATENCY_ADD_BYTES(scope, bytes)
+#define CHIP_IM_LATENCY_TRACK_WRITER(scope, writer)
+#endif
@@ -25,11 +25,14 @@
 
 #include "InteractionModelEngine.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <new>
 
 #include "access/RequestPath.h"
 #include "access/SubjectDescriptor.h"
 #include <app/AppConfig.h>
+#include <app/InteractionLatencyStats.h>
 #include <app/RequiredPrivilege.h>
 #include <app/util/af-types.h>
 #include <app/util/ember-compatibility-functions.h>
@@ -165,6 +168,9 @@ void InteractionModelEngine::Shutdown()
     mAttributePathPool.ReleaseAll();
     mEventPathPool.ReleaseAll();
     mDataVersionFilterPool.ReleaseAll();
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+    AttributePathTable::Instance().Free();
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
     mpExchangeMgr->UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id);
 
     mpCASESessionMgr = nullptr;
@@ -413,6 +419,9 @@ Status InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeContext
                                                       const PayloadHeader & aPayloadHeader, System::PacketBufferHandle && aPayload,
                                                       bool aIsTimedInvoke)
 {
+    CHIP_IM_LATENCY_SCOPE(latency, InteractionLatencyStats::Operation::kInvoke, kInvalidClusterId);
+    CHIP_IM_LATENCY_ADD_BYTES(latency, aPayload->DataLength());
+
     CommandHandler * commandHandler = mCommandHandlerObjs.CreateObject(this);
     if (commandHandler == nullptr)
     {
@@ -662,6 +671,12 @@ Protocols::InteractionModel::Status InteractionModelEngine::OnReadInitialRequest
 {
     ChipLogDetail(InteractionModel, "Received %s request",
                   aInteractionType == ReadHandler::InteractionType::Subscribe ? "Subscribe" : "Read");
+    CHIP_IM_LATENCY_SCOPE(latency,
+                          aInteractionType == ReadHandler::InteractionType::Subscribe
+                              ? InteractionLatencyStats::Operation::kSubscribe
+                              : InteractionLatencyStats::Operation::kRead,
+                          kInvalidClusterId);
+    CHIP_IM_LATENCY_ADD_BYTES(latency, aPayload->DataLength());
 
     //
     // Let's first figure out if the client has sent us a subscribe request and requested we keep any existing
@@ -846,6 +861,8 @@ Protocols::InteractionModel::Status InteractionModelEngine::OnWriteRequest(Messa
                                                                            bool aIsTimedWrite)
 {
     ChipLogDetail(InteractionModel, "Received Write request");
+    CHIP_IM_LATENCY_SCOPE(latency, InteractionLatencyStats::Operation::kWrite, kInvalidClusterId);
+    CHIP_IM_LATENCY_ADD_BYTES(latency, aPayload->DataLength());
 
     for (auto & writeHandler : mWriteHandlers)
     {
@@ -1537,14 +1554,19 @@ CHIP_ERROR InteractionModelEngine::PushFrontAttributePathList(SingleLinkedListNo
     return err;
 }
 
-void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths)
+namespace {
+
+// Removes the concrete paths of the list that point to existing attributes and for which aIsDuplicate returns true. aRelease
+// is called on each removed node.
+template <typename IsDuplicate, typename Release>
+void RemoveConcreteAttributePathsIf(SingleLinkedListNode<AttributePathParams> *& aAttributePaths, IsDuplicate && aIsDuplicate,
+                                    Release && aRelease)
 {
     SingleLinkedListNode<AttributePathParams> * prev = nullptr;
     auto * path1                                     = aAttributePaths;
 
     while (path1 != nullptr)
     {
-        bool duplicate = false;
         // skip all wildcard paths and invalid concrete attribute
         if (path1->mValue.IsWildcardPath() ||
             !emberAfContainsAttribute(path1->mValue.mEndpointId, path1->mValue.mClusterId, path1->mValue.mAttributeId))
@@ -1554,23 +1576,8 @@ void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedLi
             continue;
         }
 
-        // Check whether a wildcard path expands to something that includes this concrete path.
-        for (auto * path2 = aAttributePaths; path2 != nullptr; path2 = path2->mpNext)
-        {
-            if (path2 == path1)
-            {
-                continue;
-            }
-
-            if (path2->mValue.IsWildcardPath() && path2->mValue.IsAttributePathSupersetOf(path1->mValue))
-            {
-                duplicate = true;
-                break;
-            }
-        }
-
         // if path1 duplicates something from wildcard expansion, discard path1
-        if (!duplicate)
+        if (!aIsDuplicate(path1))
         {
             prev  = path1;
             path1 = path1->mpNext;
@@ -1580,18 +1587,172 @@ void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedLi
         if (path1 == aAttributePaths)
         {
             aAttributePaths = path1->mpNext;
-            mAttributePathPool.ReleaseObject(path1);
+            aRelease(path1);
             path1 = aAttributePaths;
         }
         else
         {
             prev->mpNext = path1->mpNext;
-            mAttributePathPool.ReleaseObject(path1);
+            aRelease(path1);
             path1 = prev->mpNext;
         }
     }
 }
 
+// Check whether a wildcard path expands to something that includes this concrete path.
+bool IsIncludedInWildcardPath(const SingleLinkedListNode<AttributePathParams> * aAttributePaths,
+                              const SingleLinkedListNode<AttributePathParams> * aConcretePath)
+{
+    for (auto * path2 = aAttributePaths; path2 != nullptr; path2 = path2->mpNext)
+    {
+        if (path2 == aConcretePath)
+        {
+            continue;
+        }
+
+        if (path2->mValue.IsWildcardPath() && path2->mValue.IsAttributePathSupersetOf(aConcretePath->mValue))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+constexpr uint8_t kWildcardEndpointId  = 0x01;
+constexpr uint8_t kWildcardClusterId   = 0x02;
+constexpr uint8_t kWildcardAttributeId = 0x04;
+
+// The fields of a wildcard path that a concrete path has to match to be included in it, with the other fields cleared.
+struct WildcardPathKey
+{
+    WildcardPathKey(uint8_t aWildcards, const AttributePathParams & aPath, ListIndex aListIndex) :
+        mWildcards(aWildcards), mEndpointId((aWildcards & kWildcardEndpointId) ? kInvalidEndpointId : aPath.mEndpointId),
+        mClusterId((aWildcards & kWildcardClusterId) ? kInvalidClusterId : aPath.mClusterId),
+        mAttributeId((aWildcards & kWildcardAttributeId) ? kInvalidAttributeId : aPath.mAttributeId), mListIndex(aListIndex)
+    {}
+
+    bool operator<(const WildcardPathKey & aOther) const
+    {
+        if (mWildcards != aOther.mWildcards)
+        {
+            return mWildcards < aOther.mWildcards;
+        }
+        if (mEndpointId != aOther.mEndpointId)
+        {
+            return mEndpointId < aOther.mEndpointId;
+        }
+        if (mClusterId != aOther.mClusterId)
+        {
+            return mClusterId < aOther.mClusterId;
+        }
+        if (mAttributeId != aOther.mAttributeId)
+        {
+            return mAttributeId < aOther.mAttributeId;
+        }
+        return mListIndex < aOther.mListIndex;
+    }
+
+    uint8_t mWildcards;
+    EndpointId mEndpointId;
+    ClusterId mClusterId;
+    AttributeId mAttributeId;
+    ListIndex mListIndex;
+};
+
+uint8_t GetWildcards(const AttributePathParams & aPath)
+{
+    return static_cast<uint8_t>((aPath.HasWildcardEndpointId() ? kWildcardEndpointId : 0) |
+                                (aPath.HasWildcardClusterId() ? kWildcardClusterId : 0) |
+                                (aPath.HasWildcardAttributeId() ? kWildcardAttributeId : 0));
+}
+
+// Same as IsIncludedInWildcardPath, with the keys of the wildcard paths sorted: a concrete path is included in a wildcard path
+// if and only if its key for the same wildcards, with either its list index or the wildcard list index, is one of them.
+bool IsIncludedInSortedWildcardPaths(const WildcardPathKey * aKeys, size_t aKeyCount, uint8_t aUsedWildcards,
+                                     const AttributePathParams & aConcretePath)
+{
+    for (uint8_t wildcards = 1; wildcards <= (kWildcardEndpointId | kWildcardClusterId | kWildcardAttributeId); wildcards++)
+    {
+        if ((aUsedWildcards & (1 << wildcards)) == 0)
+        {
+            continue;
+        }
+        if (std::binary_search(aKeys, aKeys + aKeyCount, WildcardPathKey(wildcards, aConcretePath, kInvalidListIndex)) ||
+            (!aConcretePath.HasWildcardListIndex() &&
+             std::binary_search(aKeys, aKeys + aKeyCount, WildcardPathKey(wildcards, aConcretePath, aConcretePath.mListIndex))))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+
+} // namespace
+
+void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths)
+{
+    RemoveConcreteAttributePathsIf(
+        aAttributePaths,
+        [&aAttributePaths](SingleLinkedListNode<AttributePathParams> * path) {
+            return IsIncludedInWildcardPath(aAttributePaths, path);
+        },
+        [this](SingleLinkedListNode<AttributePathParams> * path) { mAttributePathPool.ReleaseObject(path); });
+}
+
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                                                   PathListArena & aArena)
+{
+    size_t wildcardCount = 0;
+    for (auto * path = aAttributePaths; path != nullptr; path = path->mpNext)
+    {
+        wildcardCount += path->mValue.IsWildcardPath() ? 1 : 0;
+    }
+    // Concrete paths can only duplicate wildcard paths.
+    VerifyOrReturn(wildcardCount > 0);
+
+    // Removed nodes are freed with the arena.
+    auto releaseNothing = [](SingleLinkedListNode<AttributePathParams> * path) {};
+
+    PathListArena::Checkpoint checkpoint = aArena.GetCheckpoint();
+    WildcardPathKey * keys               = aArena.AllocateArray<WildcardPathKey>(wildcardCount);
+    if (keys == nullptr)
+    {
+        RemoveConcreteAttributePathsIf(
+            aAttributePaths,
+            [&aAttributePaths](SingleLinkedListNode<AttributePathParams> * path) {
+                return IsIncludedInWildcardPath(aAttributePaths, path);
+            },
+            releaseNothing);
+        return;
+    }
+
+    size_t keyCount       = 0;
+    uint8_t usedWildcards = 0;
+    for (auto * path = aAttributePaths; path != nullptr; path = path->mpNext)
+    {
+        if (path->mValue.IsWildcardPath())
+        {
+            uint8_t wildcards = GetWildcards(path->mValue);
+            new (&keys[keyCount++]) WildcardPathKey(wildcards, path->mValue, path->mValue.mListIndex);
+            usedWildcards = static_cast<uint8_t>(usedWildcards | (1 << wildcards));
+        }
+    }
+    std::sort(keys, keys + keyCount);
+
+    RemoveConcreteAttributePathsIf(
+        aAttributePaths,
+        [&](SingleLinkedListNode<AttributePathParams> * path) {
+            return IsIncludedInSortedWildcardPaths(keys, keyCount, usedWildcards, path->mValue);
+        },
+        releaseNothing);
+
+    aArena.Rewind(checkpoint);
+}
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+
 void InteractionModelEngine::ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList)
 {
     ReleasePool(aEventPathList, mEventPathPool);
@@ -1659,6 +1820,8 @@ CHIP_ERROR InteractionModelEngine::PushFront(SingleLinkedListNode<T> *& aObjectL
 void InteractionModelEngine::DispatchCommand(CommandHandler & apCommandObj, const ConcreteCommandPath & aCommandPath,
                                              TLV::TLVReader & apPayload)
 {
+    CHIP_IM_LATENCY_SCOPE(latency, InteractionLatencyStats::Operation::kCommand, aCommandPath.mClusterId);
+
     CommandHandlerInterface * handler = FindCommandHandler(aCommandPath.mEndpointId, aCommandPath.mClusterId);
 
     if (handler)
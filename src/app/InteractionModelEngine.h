@@ -38,6 +38,7 @@
 #include <app/EventPathParams.h>
 #include <app/MessageDef/AttributeReportIBs.h>
 #include <app/MessageDef/ReportDataMessage.h>
+#include <app/PathListArena.h>
 #include <app/ReadClient.h>
 #include <app/ReadHandler.h>
 #include <app/StatusResponse.h>
@@ -196,6 +197,12 @@ public:
     // the path SHALL be removed from the list.
     void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths);
 
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+    // Same as above for a list allocated from aArena, which the removed paths are left to. The wildcard paths of the request
+    // are sorted in scratch memory from the arena, so that finding the duplicates is O(n log n) instead of O(n^2).
+    void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths, PathListArena & aArena);
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+
     void ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList);
 
     CHIP_ERROR PushFrontEventPathParamsList(SingleLinkedListNode<EventPathParams> *& aEventPathList, EventPathParams & aEventPath);
@@ -608,6 +615,10 @@ private:
     static constexpr size_t kReservedHandlersForReads = kMinSupportedReadRequestsPerFabric * (CHIP_CONFIG_MAX_FABRICS);
     static constexpr size_t kReservedPathsForReads    = kMinSupportedPathsPerReadRequest * kReservedHandlersForReads;
 
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA && !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#error "CHIP_CONFIG_IM_PATH_LIST_ARENA allocates path lists from the heap and requires CHIP_SYSTEM_CONFIG_POOL_USE_HEAP"
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
     static_assert(CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS >=
                       CHIP_CONFIG_MAX_FABRICS * (kMinSupportedPathsPerSubscription * kMinSupportedSubscriptionsPerFabric),
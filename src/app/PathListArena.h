@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LinkedList.h>
+
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief Bump allocator for the path lists of one interaction.
+ *
+ * Memory is handed out from blocks of CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE bytes allocated from the heap, so the nodes of
+ * a list that are pushed one after the other are next to each other in memory. Nothing is freed until Release(), or
+ * Rewind() for temporary allocations made after a checkpoint.
+ *
+ * Destructors are never called, so the objects allocated from the arena must not own any resource.
+ */
+class PathListArena
+{
+private:
+    struct Block;
+
+public:
+    /// @brief Position in the arena that Rewind() can go back to
+    struct Checkpoint
+    {
+        Block * mpBlock;
+        size_t mUsed;
+    };
+
+    PathListArena() = default;
+    ~PathListArena() { Release(); }
+
+    PathListArena(const PathListArena &)             = delete;
+    PathListArena & operator=(const PathListArena &) = delete;
+
+    /**
+     * @brief Allocate a node holding a copy of aValue and push it to the front of aList. The node is not destroyed when the
+     * arena is released.
+     *
+     * @return CHIP_ERROR_NO_MEMORY if the arena could not grow.
+     */
+    template <typename T>
+    CHIP_ERROR PushFront(SingleLinkedListNode<T> *& aList, const T & aValue)
+    {
+        void * memory = Allocate(sizeof(SingleLinkedListNode<T>), alignof(SingleLinkedListNode<T>));
+        VerifyOrReturnError(memory != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        auto * node  = new (memory) SingleLinkedListNode<T>();
+        node->mValue = aValue;
+        node->mpNext = aList;
+        aList        = node;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * @brief Allocate an uninitialized array of aCount objects.
+     *
+     * @return The array, or nullptr if the arena could not grow.
+     */
+    template <typename T>
+    T * AllocateArray(size_t aCount)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena objects are never destroyed");
+        VerifyOrReturnValue(aCount <= SIZE_MAX / sizeof(T), nullptr);
+        return static_cast<T *>(Allocate(aCount * sizeof(T), alignof(T)));
+    }
+
+    Checkpoint GetCheckpoint() const { return Checkpoint{ mpBlocks, (mpBlocks == nullptr) ? 0 : mpBlocks->mUsed }; }
+
+    /**
+     * @brief Free everything that was allocated after aCheckpoint was taken.
+     */
+    void Rewind(const Checkpoint & aCheckpoint)
+    {
+        while (mpBlocks != aCheckpoint.mpBlock && mpBlocks != nullptr)
+        {
+            Block * next = mpBlocks->mpNext;
+            Platform::MemoryFree(mpBlocks);
+            mpBlocks = next;
+            mBlockCount--;
+        }
+        if (mpBlocks != nullptr)
+        {
+            mpBlocks->mUsed = aCheckpoint.mUsed;
+        }
+    }
+
+    /**
+     * @brief Free all the memory of the arena. The lists allocated from it must no longer be used.
+     */
+    void Release() { Rewind(Checkpoint{ nullptr, 0 }); }
+
+    /// @brief Number of blocks currently allocated from the heap
+    size_t GetBlockCount() const { return mBlockCount; }
+
+private:
+    struct Block
+    {
+        Block * mpNext;
+        size_t mCapacity;
+        size_t mUsed;
+
+        uint8_t * Data() { return reinterpret_cast<uint8_t *>(this) + kHeaderSize; }
+    };
+
+    static constexpr size_t kMaxAlignment = alignof(max_align_t);
+    static constexpr size_t kHeaderSize   = (sizeof(Block) + kMaxAlignment - 1) / kMaxAlignment * kMaxAlignment;
+
+    static size_t AlignUp(size_t aValue, size_t aAlignment) { return (aValue + aAlignment - 1) / aAlignment * aAlignment; }
+
+    void * Allocate(size_t aSize, size_t aAlignment)
+    {
+        VerifyOrReturnValue(aAlignment <= kMaxAlignment, nullptr);
+
+        if (mpBlocks != nullptr)
+        {
+            size_t offset = AlignUp(mpBlocks->mUsed, aAlignment);
+            if (offset <= mpBlocks->mCapacity && aSize <= mpBlocks->mCapacity - offset)
+            {
+                mpBlocks->mUsed = offset + aSize;
+                return mpBlocks->Data() + offset;
+            }
+        }
+
+        // Data() is aligned for any object, so a new block always fits an allocation of its capacity.
+        size_t capacity = (aSize > CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE) ? aSize : CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE;
+        VerifyOrReturnValue(capacity <= SIZE_MAX - kHeaderSize, nullptr);
+        auto * block = static_cast<Block *>(Platform::MemoryAlloc(kHeaderSize + capacity));
+        VerifyOrReturnValue(block != nullptr, nullptr);
+
+        block->mpNext    = mpBlocks;
+        block->mCapacity = capacity;
+        block->mUsed     = aSize;
+        mpBlocks         = block;
+        mBlockCount++;
+        return block->Data();
+    }
+
+    Block * mpBlocks   = nullptr;
+    size_t mBlockCount = 0;
+};
+
+} // namespace app
+} // namespace chip
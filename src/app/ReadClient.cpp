@@ -722,6 +722,15 @@ void ReadClient::NoteReportingData()
 {
     if (!mIsReporting)
     {
+        // Reports over TCP are not bound by the network MTU, so they may arrive in much larger messages.
+        size_t maxSduLength                   = kMaxSecureSduLengthBytes;
+        Messaging::ExchangeContext * exchange = mExchange.Get();
+        if (exchange != nullptr && exchange->HasSessionHandle() && exchange->GetSessionHandle()->AllowsLargePayload())
+        {
+            maxSduLength = kMaxLargeSecureSduLengthBytes;
+        }
+
+        mpCallback.OnReportMaxSduLength(maxSduLength);
         mpCallback.OnReportBegin();
         mIsReporting = true;
     }
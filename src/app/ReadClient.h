@@ -103,6 +103,13 @@ public:
          */
         virtual void OnReportBegin() {}
 
+        /**
+         * Used to signal, right before OnReportBegin, the largest message in which the reports of the exchange can arrive. This
+         * is kMaxSecureSduLengthBytes, unless the session allows large payloads (see Session::AllowsLargePayload), and lets
+         * callbacks that copy received data size their buffers for the session rather than for the largest possible message.
+         */
+        virtual void OnReportMaxSduLength(size_t aMaxSduLength) {}
+
         /**
          * Used to signal the completion of processing of the last attribute or event report in a given exchange.
          *
@@ -145,6 +152,49 @@ public:
          */
         virtual void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) {}
 
+        /**
+         * Used by a BufferedReadCallback constructed with ListDelivery::kStreamItems to signal that the items of a list
+         * attribute are about to be delivered, one at a time, through OnAttributeListItem. The list replaces any list
+         * previously delivered for the same path. OnAttributeData is not called for the successfully delivered list.
+         *
+         * If OnAttributeListBegin is called again for the same path before OnAttributeListEnd, the server replaced the list
+         * again in the same report: the list starts over, and the items delivered so far must be discarded.
+         *
+         * This object MUST continue to exist after this call is completed. The application shall wait until it
+         * receives an OnDone call to destroy the object.
+         *
+         * @param[in] aPath        The attribute path of the list.
+         */
+        virtual void OnAttributeListBegin(const ConcreteDataAttributePath & aPath) {}
+
+        /**
+         * Used to deliver one item of the list announced by the last OnAttributeListBegin call. Items are delivered in list
+         * order, as soon as they are received, without being copied.
+         *
+         * This object MUST continue to exist after this call is completed. The application shall wait until it
+         * receives an OnDone call to destroy the object.
+         *
+         * @param[in] aPath        The attribute path of the list, with the data version of the report the item was received in.
+         * @param[in] aIndex       The index of the item in the list.
+         * @param[in] apData       A TLVReader positioned on the item. It is only valid during this call.
+         */
+        virtual void OnAttributeListItem(const ConcreteDataAttributePath & aPath, ListIndex aIndex, TLV::TLVReader * apData) {}
+
+        /**
+         * Used to signal that all the items of the list announced by the last OnAttributeListBegin call were delivered.
+         *
+         * If aStatus is not Success, the list was only partially delivered, e.g. because the server reported an error for
+         * the attribute in a later chunk, and the items delivered since OnAttributeListBegin must be discarded. Any attribute
+         * specific error is then delivered through OnAttributeData as usual.
+         *
+         * This object MUST continue to exist after this call is completed. The application shall wait until it
+         * receives an OnDone call to destroy the object.
+         *
+         * @param[in] aPath        The attribute path of the list, with the data version of the last report it was received in.
+         * @param[in] aStatus      Success if the whole list was delivered.
+         */
+        virtual void OnAttributeListEnd(const ConcreteDataAttributePath & aPath, const StatusIB & aStatus) {}
+
         /**
          * OnSubscriptionEstablished will be called when a subscription is established for the given subscription transaction.
          * If using auto resubscription, OnSubscriptionEstablished will be called whenever resubscription is established.
@@ -102,7 +102,7 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
     for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths.AllocatedSize(); i++)
     {
         AttributePathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths[i].GetParams();
-        CHIP_ERROR err = mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, params);
+        CHIP_ERROR err = PushFrontAttributePath(params);
         if (err != CHIP_NO_ERROR)
         {
             Close();
@@ -112,7 +112,7 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
     for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths.AllocatedSize(); i++)
     {
         EventPathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths[i].GetParams();
-        CHIP_ERROR err = mManagementCallback.GetInteractionModelEngine()->PushFrontEventPathParamsList(mpEventPathList, params);
+        CHIP_ERROR err = PushFrontEventPath(params);
         if (err != CHIP_NO_ERROR)
         {
             Close();
@@ -158,9 +158,11 @@ ReadHandler::~ReadHandler()
     {
         mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReportConfirm();
     }
+#if !CHIP_CONFIG_IM_PATH_LIST_ARENA
     mManagementCallback.GetInteractionModelEngine()->ReleaseAttributePathList(mpAttributePathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseEventPathList(mpEventPathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+#endif // !CHIP_CONFIG_IM_PATH_LIST_ARENA
 }
 
 void ReadHandler::Close(CloseOptions options)
@@ -356,7 +358,7 @@ CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload, b
     {
         mPreviousReportsBeginGeneration = mCurrentReportsBeginGeneration;
         ClearForceDirtyFlag();
-        mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+        ReleaseDataVersionFilterList();
     }
 
     return err;
@@ -492,13 +494,12 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
         AttributePathIB::Parser path;
         ReturnErrorOnFailure(path.Init(reader));
         ReturnErrorOnFailure(path.ParsePath(attribute));
-        ReturnErrorOnFailure(
-            mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, attribute));
+        ReturnErrorOnFailure(PushFrontAttributePath(attribute));
     }
     // if we have exhausted this container
     if (CHIP_END_OF_TLV == err)
     {
-        mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
+        RemoveDuplicateConcreteAttributePaths();
         mAttributePathExpandIterator = AttributePathExpandIterator(mpAttributePathList);
         err                          = CHIP_NO_ERROR;
     }
@@ -525,8 +526,7 @@ CHIP_ERROR ReadHandler::ProcessDataVersionFilterList(DataVersionFilterIBs::Parse
         ReturnErrorOnFailure(path.GetEndpoint(&(versionFilter.mEndpointId)));
         ReturnErrorOnFailure(path.GetCluster(&(versionFilter.mClusterId)));
         VerifyOrReturnError(versionFilter.IsValidDataVersionFilter(), CHIP_ERROR_IM_MALFORMED_DATA_VERSION_FILTER_IB);
-        ReturnErrorOnFailure(mManagementCallback.GetInteractionModelEngine()->PushFrontDataVersionFilterList(
-            mpDataVersionFilterList, versionFilter));
+        ReturnErrorOnFailure(PushFrontDataVersionFilter(versionFilter));
     }
 
     if (CHIP_END_OF_TLV == err)
@@ -548,7 +548,7 @@ CHIP_ERROR ReadHandler::ProcessEventPaths(EventPathIBs::Parser & aEventPathsPars
         EventPathIB::Parser path;
         ReturnErrorOnFailure(path.Init(reader));
         ReturnErrorOnFailure(path.ParsePath(event));
-        ReturnErrorOnFailure(mManagementCallback.GetInteractionModelEngine()->PushFrontEventPathParamsList(mpEventPathList, event));
+        ReturnErrorOnFailure(PushFrontEventPath(event));
     }
 
     // if we have exhausted this container
@@ -559,6 +559,69 @@ CHIP_ERROR ReadHandler::ProcessEventPaths(EventPathIBs::Parser & aEventPathsPars
     return err;
 }
 
+CHIP_ERROR ReadHandler::PushFrontAttributePath(AttributePathParams & aAttributePath)
+{
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+    CHIP_ERROR err = mPathListArena.PushFront(mpAttributePathList, aAttributePath);
+    if (err == CHIP_ERROR_NO_MEMORY)
+    {
+        ChipLogError(InteractionModel, "AttributePath arena full");
+        return CHIP_IM_GLOBAL_STATUS(PathsExhausted);
+    }
+    return err;
+#else
+    return mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, aAttributePath);
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+}
+
+CHIP_ERROR ReadHandler::PushFrontEventPath(EventPathParams & aEventPath)
+{
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+    CHIP_ERROR err = mPathListArena.PushFront(mpEventPathList, aEventPath);
+    if (err == CHIP_ERROR_NO_MEMORY)
+    {
+        ChipLogError(InteractionModel, "EventPath arena full");
+        return CHIP_IM_GLOBAL_STATUS(PathsExhausted);
+    }
+    return err;
+#else
+    return mManagementCallback.GetInteractionModelEngine()->PushFrontEventPathParamsList(mpEventPathList, aEventPath);
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+}
+
+CHIP_ERROR ReadHandler::PushFrontDataVersionFilter(DataVersionFilter & aDataVersionFilter)
+{
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+    if (mPathListArena.PushFront(mpDataVersionFilterList, aDataVersionFilter) == CHIP_ERROR_NO_MEMORY)
+    {
+        ChipLogError(InteractionModel, "DataVersionFilter arena full, ignore this filter");
+    }
+    return CHIP_NO_ERROR;
+#else
+    return mManagementCallback.GetInteractionModelEngine()->PushFrontDataVersionFilterList(mpDataVersionFilterList,
+                                                                                          aDataVersionFilter);
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+}
+
+void ReadHandler::RemoveDuplicateConcreteAttributePaths()
+{
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+    mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList, mPathListArena);
+#else
+    mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+}
+
+void ReadHandler::ReleaseDataVersionFilterList()
+{
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+    // The filters stay in the arena until the handler is destroyed.
+    mpDataVersionFilterList = nullptr;
+#else
+    mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+}
+
 CHIP_ERROR ReadHandler::ProcessEventFilters(EventFilterIBs::Parser & aEventFiltersParser)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -37,6 +37,7 @@
 #include <app/MessageDef/EventFilterIBs.h>
 #include <app/MessageDef/EventPathIBs.h>
 #include <app/OperationalSessionSetup.h>
+#include <app/PathListArena.h>
 #include <app/SubscriptionResumptionSessionEstablisher.h>
 #include <app/SubscriptionResumptionStorage.h>
 #include <lib/core/CHIPCallback.h>
@@ -66,6 +67,7 @@ namespace reporting {
 class Engine;
 class TestReportingEngine;
 class ReportScheduler;
+class PriorityReportSchedulerImpl;
 class TestReportScheduler;
 } // namespace reporting
 
@@ -438,6 +440,9 @@ private:
     // ForceDirtyState() and IsDirty() to know when to schedule a run so it is declared as a friend class.
     friend class chip::app::reporting::ReportScheduler;
 
+    // The priority report scheduler ranks reportable handlers by what they have to report and by the fabric they report to.
+    friend class chip::app::reporting::PriorityReportSchedulerImpl;
+
     enum class HandlerState : uint8_t
     {
         Idle,                   ///< The handler has been initialized and is ready
@@ -466,6 +471,17 @@ private:
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessAttributePaths(AttributePathIBs::Parser & aAttributePathListParser);
     CHIP_ERROR ProcessEventPaths(EventPathIBs::Parser & aEventPathsParser);
+
+    /**
+     * The path lists of the handler are allocated from mPathListArena when CHIP_CONFIG_IM_PATH_LIST_ARENA is enabled, and from
+     * the pools of the InteractionModelEngine otherwise.
+     */
+    CHIP_ERROR PushFrontAttributePath(AttributePathParams & aAttributePath);
+    CHIP_ERROR PushFrontEventPath(EventPathParams & aEventPath);
+    CHIP_ERROR PushFrontDataVersionFilter(DataVersionFilter & aDataVersionFilter);
+    void RemoveDuplicateConcreteAttributePaths();
+    void ReleaseDataVersionFilterList();
+
     CHIP_ERROR ProcessEventFilters(EventFilterIBs::Parser & aEventFiltersParser);
     CHIP_ERROR OnStatusResponse(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload,
                                 bool & aSendStatusResponse);
@@ -554,6 +570,11 @@ private:
     SingleLinkedListNode<EventPathParams> * mpEventPathList           = nullptr;
     SingleLinkedListNode<DataVersionFilter> * mpDataVersionFilterList = nullptr;
 
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+    // Holds the nodes of the lists above. Nodes that are removed from the lists are freed with the arena, along with the handler.
+    PathListArena mPathListArena;
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+
     ManagementCallback & mManagementCallback;
 
     uint32_t mLastWrittenEventsBytes = 0;
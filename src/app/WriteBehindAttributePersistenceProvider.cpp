@@ -0,0 +1,193 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/WriteBehindAttributePersistenceProvider.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+WriteBehindAttributePersistenceProvider::~WriteBehindAttributePersistenceProvider()
+{
+    Shutdown();
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::Init(System::Layer * systemLayer)
+{
+    VerifyOrReturnError(systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mSystemLayer == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    mSystemLayer = systemLayer;
+    return CHIP_NO_ERROR;
+}
+
+void WriteBehindAttributePersistenceProvider::Shutdown()
+{
+    Flush();
+    mSystemLayer = nullptr;
+}
+
+void WriteBehindAttributePersistenceProvider::Flush()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(OnFlushTimer, this);
+    }
+    VerifyOrReturn(mpPending != nullptr);
+
+    ChipLogDetail(DataManagement, "Flushing %u pending attribute values", static_cast<unsigned>(mPendingCount));
+
+    PendingValue * pending = mpPending;
+    mpPending              = nullptr;
+    mPendingCount          = 0;
+
+    if (mBatch != nullptr)
+    {
+        mBatch->BeginBatch();
+    }
+    while (pending != nullptr)
+    {
+        CHIP_ERROR err = mPersister.WriteValue(pending->mPath, ByteSpan(pending->mValue.Get(), pending->mSize));
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to persist attribute " ChipLogFormatMEI " of cluster " ChipLogFormatMEI
+                         " on endpoint %u: %" CHIP_ERROR_FORMAT,
+                         ChipLogValueMEI(pending->mPath.mAttributeId), ChipLogValueMEI(pending->mPath.mClusterId),
+                         pending->mPath.mEndpointId, err.Format());
+        }
+        PendingValue * next = pending->mpNext;
+        Platform::Delete(pending);
+        pending = next;
+    }
+    if (mBatch != nullptr)
+    {
+        CHIP_ERROR err = mBatch->EndBatch();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to commit the persisted attributes: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, mPersister.WriteValue(aPath, aValue));
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    PendingValue * pending             = FindPending(aPath);
+    if (pending == nullptr)
+    {
+        pending = Platform::New<PendingValue>();
+        VerifyOrReturnError(pending != nullptr, mPersister.WriteValue(aPath, aValue));
+        if (mpPending == nullptr)
+        {
+            mOldestWriteTime = now;
+        }
+        pending->mPath  = aPath;
+        pending->mpNext = mpPending;
+        mpPending       = pending;
+        mPendingCount++;
+    }
+
+    if (!pending->mValue || pending->mSize != aValue.size())
+    {
+        // Allocate at least one byte, so that empty values are pending too.
+        pending->mValue.Alloc(aValue.empty() ? 1 : aValue.size());
+        if (!pending->mValue)
+        {
+            // Not enough memory to defer this write: the previous pending value is stale, write this one through instead.
+            RemovePending(pending);
+            return mPersister.WriteValue(aPath, aValue);
+        }
+        pending->mSize = aValue.size();
+    }
+    if (!aValue.empty())
+    {
+        memcpy(pending->mValue.Get(), aValue.data(), aValue.size());
+    }
+
+    mLastWriteTime = now;
+    ScheduleFlush();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath,
+                                                              const EmberAfAttributeMetadata * aMetadata, MutableByteSpan & aValue)
+{
+    const PendingValue * pending = FindPending(aPath);
+    if (pending == nullptr)
+    {
+        return mPersister.ReadValue(aPath, aMetadata, aValue);
+    }
+
+    VerifyOrReturnError(aValue.size() >= pending->mSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(aValue.data(), pending->mValue.Get(), pending->mSize);
+    aValue.reduce_size(pending->mSize);
+    return CHIP_NO_ERROR;
+}
+
+WriteBehindAttributePersistenceProvider::PendingValue *
+WriteBehindAttributePersistenceProvider::FindPending(const ConcreteAttributePath & aPath) const
+{
+    for (PendingValue * pending = mpPending; pending != nullptr; pending = pending->mpNext)
+    {
+        if (pending->mPath == aPath)
+        {
+            return pending;
+        }
+    }
+    return nullptr;
+}
+
+void WriteBehindAttributePersistenceProvider::RemovePending(PendingValue * aPending)
+{
+    for (PendingValue ** link = &mpPending; *link != nullptr; link = &(*link)->mpNext)
+    {
+        if (*link == aPending)
+        {
+            *link = aPending->mpNext;
+            Platform::Delete(aPending);
+            mPendingCount--;
+            return;
+        }
+    }
+}
+
+void WriteBehindAttributePersistenceProvider::ScheduleFlush()
+{
+    const System::Clock::Timestamp now      = System::SystemClock().GetMonotonicTimestamp();
+    const System::Clock::Timestamp deadline = chip::min(mOldestWriteTime + mMaxDelay, mLastWriteTime + mIdleDelay);
+    const System::Clock::Timeout delay      = (deadline > now) ? deadline - now : System::Clock::kZero;
+
+    // Restarting the timer on every write moves the flush forward by the idle delay, never past the maximum delay.
+    CHIP_ERROR err = mSystemLayer->StartTimer(delay, OnFlushTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to schedule the attribute flush: %" CHIP_ERROR_FORMAT, err.Format());
+        Flush();
+    }
+}
+
+void WriteBehindAttributePersistenceProvider::OnFlushTimer(System::Layer * aLayer, void * aAppState)
+{
+    static_cast<WriteBehindAttributePersistenceProvider *>(aAppState)->Flush();
+}
+
+} // namespace app
+} // namespace chip
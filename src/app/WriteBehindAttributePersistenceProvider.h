@@ -0,0 +1,125 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributePersistenceProvider.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Decorator class for the AttributePersistenceProvider implementation that
+ * keeps every written attribute in memory and writes all of them to the
+ * decorated persister at once.
+ *
+ * Unlike DeferredAttributePersistenceProvider, no attribute has to be listed
+ * up front: all the writes are coalesced, so that an attribute changing many
+ * times in a row, such as the CurrentLevel attribute of the LevelControl
+ * cluster during a transition, is only written once.
+ *
+ * The pending values are flushed:
+ *  - once no attribute has been written for the idle delay,
+ *  - at the latest when the oldest pending value has waited for the maximum
+ *    delay, which bounds the changes that can be lost on a power cut,
+ *  - when Flush() or Shutdown() is called.
+ *
+ * If a StorageBatch is given, the writes of a flush are made within one batch
+ * of the underlying storage, so that they can be committed to flash together.
+ */
+class WriteBehindAttributePersistenceProvider : public AttributePersistenceProvider
+{
+public:
+    /**
+     * Interface of a storage that can group several writes into one commit.
+     */
+    class StorageBatch
+    {
+    public:
+        virtual ~StorageBatch() = default;
+
+        virtual void BeginBatch()      = 0;
+        virtual CHIP_ERROR EndBatch() = 0;
+    };
+
+    WriteBehindAttributePersistenceProvider(AttributePersistenceProvider & persister, System::Clock::Milliseconds32 idleDelay,
+                                            System::Clock::Milliseconds32 maxDelay, StorageBatch * batch = nullptr) :
+        mPersister(persister),
+        mBatch(batch), mIdleDelay(idleDelay), mMaxDelay(maxDelay)
+    {}
+    ~WriteBehindAttributePersistenceProvider() override;
+
+    // The system layer must outlive this object, or Shutdown() must be called first.
+    CHIP_ERROR Init(System::Layer * systemLayer);
+
+    /*
+     * Write all the pending values to the decorated persister, and stop
+     * deferring writes.
+     */
+    void Shutdown();
+
+    /*
+     * Write all the pending values to the decorated persister now. Failures are
+     * logged, and the values that could not be written are dropped.
+     */
+    void Flush();
+
+    /*
+     * Keep a copy of the value to write it later. If no memory is left for the
+     * copy, the value is written immediately, as are all the writes made before
+     * Init() or after Shutdown().
+     */
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override;
+
+    /*
+     * Return the pending value of the attribute if there is one, and read the
+     * decorated persister otherwise.
+     */
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override;
+
+    size_t GetPendingCount() const { return mPendingCount; }
+
+private:
+    struct PendingValue
+    {
+        PendingValue * mpNext = nullptr;
+        ConcreteAttributePath mPath;
+        Platform::ScopedMemoryBuffer<uint8_t> mValue;
+        size_t mSize = 0;
+    };
+
+    PendingValue * FindPending(const ConcreteAttributePath & aPath) const;
+    void RemovePending(PendingValue * aPending);
+    void ScheduleFlush();
+    static void OnFlushTimer(System::Layer * aLayer, void * aAppState);
+
+    AttributePersistenceProvider & mPersister;
+    StorageBatch * const mBatch;
+    const System::Clock::Milliseconds32 mIdleDelay;
+    const System::Clock::Milliseconds32 mMaxDelay;
+    System::Layer * mSystemLayer = nullptr;
+    PendingValue * mpPending     = nullptr;
+    size_t mPendingCount         = 0;
+    System::Clock::Timestamp mOldestWriteTime;
+    System::Clock::Timestamp mLastWriteTime;
+};
+
+} // namespace app
+} // namespace chip
@@ -18,6 +18,7 @@
 
 #include "messaging/ExchangeContext.h"
 #include <app/AppConfig.h>
+#include <app/InteractionLatencyStats.h>
 #include <app/InteractionModelEngine.h>
 #include <app/MessageDef/EventPathIB.h>
 #include <app/StatusResponse.h>
@@ -342,7 +343,10 @@ CHIP_ERROR WriteHandler::ProcessAttributeDataIBs(TLV::TLVReader & aAttributeData
             err = CHIP_NO_ERROR;
         }
         SuccessOrExit(err);
-        err = WriteSingleClusterData(subjectDescriptor, dataAttributePath, dataReader, this);
+        {
+            CHIP_IM_LATENCY_SCOPE(latency, InteractionLatencyStats::Operation::kAttributeWrite, dataAttributePath.mClusterId);
+            err = WriteSingleClusterData(subjectDescriptor, dataAttributePath, dataReader, this);
+        }
         if (err != CHIP_NO_ERROR)
         {
             mWriteResponseBuilder.GetWriteResponses().Rollback(backup);
@@ -483,7 +487,10 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
             chip::TLV::TLVReader tmpDataReader(dataReader);
 
             MatterPreAttributeWriteCallback(dataAttributePath);
-            err = WriteSingleClusterData(subjectDescriptor, dataAttributePath, tmpDataReader, this);
+            {
+                CHIP_IM_LATENCY_SCOPE(latency, InteractionLatencyStats::Operation::kAttributeWrite, dataAttributePath.mClusterId);
+                err = WriteSingleClusterData(subjectDescriptor, dataAttributePath, tmpDataReader, this);
+            }
 
             if (err != CHIP_NO_ERROR)
             {
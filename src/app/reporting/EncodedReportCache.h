@@ -0,0 +1,202 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @brief Cache of encoded AttributeReportIBs, shared by the read handlers served by one run of the reporting engine.
+ *
+ * Subscribers that are interested in the same attributes and have the same access to them get identical AttributeReportIBs.
+ * Each fragment is keyed by everything that can make the encoding differ between subscribers: the concrete path, whether
+ * it was expanded from a wildcard, the accessing fabric, whether the read is fabric-filtered and the outcome of the access
+ * control check.
+ *
+ * Paths whose reports turned out too large for an entry are remembered as such, whatever the key, so that the owner can
+ * encode them directly without first checking the cache.
+ *
+ * The cache does not track data versions: the owner must Invalidate() it whenever attribute data may have changed.
+ *
+ * @tparam kNumEntries   Number of fragments kept. Once full, the oldest fragment is replaced.
+ * @tparam kMaxEntrySize Size of the largest fragment that can be cached, in bytes.
+ */
+template <size_t kNumEntries, size_t kMaxEntrySize>
+class EncodedReportCache
+{
+public:
+    struct Key
+    {
+        Key(const ConcreteAttributePath & aPath, FabricIndex aAccessingFabricIndex, bool aIsFabricFiltered, bool aAccessAllowed) :
+            mPath(aPath), mAccessingFabricIndex(aAccessingFabricIndex), mIsFabricFiltered(aIsFabricFiltered),
+            mAccessAllowed(aAccessAllowed)
+        {}
+
+        bool operator==(const Key & aOther) const
+        {
+            return mPath == aOther.mPath && mPath.mExpanded == aOther.mPath.mExpanded &&
+                mAccessingFabricIndex == aOther.mAccessingFabricIndex && mIsFabricFiltered == aOther.mIsFabricFiltered &&
+                mAccessAllowed == aOther.mAccessAllowed;
+        }
+
+        ConcreteAttributePath mPath;
+        FabricIndex mAccessingFabricIndex;
+        bool mIsFabricFiltered;
+        bool mAccessAllowed;
+    };
+
+    struct Stats
+    {
+        uint32_t mHits       = 0;
+        uint32_t mMisses     = 0;
+        uint32_t mInsertions = 0;
+        uint32_t mEvictions  = 0;
+
+        // Fragments that could not be cached because they exceeded kMaxEntrySize.
+        uint32_t mUncacheable = 0;
+
+        // Percentage of lookups that found a fragment.
+        uint32_t HitRatePercent() const
+        {
+            uint32_t lookups = mHits + mMisses;
+            return (lookups == 0) ? 0 : static_cast<uint32_t>(static_cast<uint64_t>(mHits) * 100 / lookups);
+        }
+    };
+
+    static constexpr size_t kMaxFragmentSize = kMaxEntrySize;
+
+    /**
+     * @brief Drop all the cached fragments. Statistics are kept.
+     */
+    void Invalidate()
+    {
+        for (auto & entry : mEntries)
+        {
+            entry.mValid = false;
+        }
+    }
+
+    /**
+     * @brief Look up the fragment cached for a key.
+     *
+     * @return true, with outFragment set to the cached bytes, if there is one. The bytes remain valid until the next call to
+     *         Insert(), MarkOversized() or Invalidate().
+     */
+    bool Lookup(const Key & aKey, ByteSpan & outFragment)
+    {
+        for (auto & entry : mEntries)
+        {
+            if (entry.mValid && !entry.mOversized && entry.mKey == aKey)
+            {
+                mStats.mHits++;
+                outFragment = ByteSpan(entry.mData, entry.mLength);
+                return true;
+            }
+        }
+        mStats.mMisses++;
+        return false;
+    }
+
+    /**
+     * @brief Cache a copy of the fragment for aKey, replacing the oldest entry.
+     *
+     * aFragment must not be larger than kMaxFragmentSize.
+     */
+    void Insert(const Key & aKey, const ByteSpan & aFragment)
+    {
+        Entry & entry = NextEntry();
+        memcpy(entry.mData, aFragment.data(), aFragment.size());
+        entry.mKey    = aKey;
+        entry.mLength = aFragment.size();
+        mStats.mInsertions++;
+    }
+
+    /**
+     * @brief Remember that the reports for aPath do not fit in an entry, until the next Invalidate().
+     */
+    void MarkOversized(const ConcreteAttributePath & aPath)
+    {
+        Entry & entry    = NextEntry();
+        entry.mKey       = Key(aPath, kUndefinedFabricIndex, false, false);
+        entry.mOversized = true;
+        mStats.mUncacheable++;
+    }
+
+    /**
+     * @brief Whether MarkOversized() was called for aPath since the last Invalidate().
+     */
+    bool IsOversized(const ConcreteAttributePath & aPath) const
+    {
+        for (auto & entry : mEntries)
+        {
+            if (entry.mValid && entry.mOversized && entry.mKey.mPath == aPath &&
+                entry.mKey.mPath.mExpanded == aPath.mExpanded)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const Stats & GetStats() const { return mStats; }
+    void ResetStats() { mStats = Stats(); }
+
+private:
+    static_assert(kNumEntries > 0, "EncodedReportCache needs at least one entry");
+
+    struct Entry
+    {
+        Key mKey{ ConcreteAttributePath(), kUndefinedFabricIndex, false, false };
+        size_t mLength  = 0;
+        bool mValid     = false;
+        bool mOversized = false;
+        uint8_t mData[kMaxEntrySize];
+    };
+
+    // Takes over the oldest entry, which is returned valid and with no fragment.
+    Entry & NextEntry()
+    {
+        Entry & entry = mEntries[mNextEntry];
+        mNextEntry    = (mNextEntry + 1) % kNumEntries;
+        if (entry.mValid)
+        {
+            mStats.mEvictions++;
+        }
+        entry.mValid     = true;
+        entry.mOversized = false;
+        entry.mLength    = 0;
+        return entry;
+    }
+
+    Entry mEntries[kNumEntries];
+    size_t mNextEntry = 0;
+    Stats mStats;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -28,6 +28,7 @@
 #include <app/icd/server/ICDNotifier.h> // nogncheck
 #endif
 #include <app/AppConfig.h>
+#include <app/InteractionLatencyStats.h>
 #include <app/InteractionModelEngine.h>
 #include <app/RequiredPrivilege.h>
 #include <app/reporting/Engine.h>
@@ -57,6 +58,9 @@ void Engine::Shutdown()
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    mReportCache.Invalidate();
+#endif
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -82,12 +86,15 @@ bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFil
 CHIP_ERROR
 Engine::RetrieveClusterData(const SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                             AttributeReportIBs::Builder & aAttributeReportIBs, const ConcreteReadAttributePath & aPath,
-                            AttributeValueEncoder::AttributeEncodeState * aEncoderState)
+                            AttributeValueEncoder::AttributeEncodeState * aEncoderState, Optional<bool> aAccessAllowed)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", aPath.mClusterId,
                   aPath.mAttributeId);
+    CHIP_IM_LATENCY_SCOPE(latency, InteractionLatencyStats::Operation::kAttributeRead, aPath.mClusterId);
+    CHIP_IM_LATENCY_TRACK_WRITER(latency, *aAttributeReportIBs.GetWriter());
     MatterPreAttributeReadCallback(aPath);
-    ReturnErrorOnFailure(ReadSingleClusterData(aSubjectDescriptor, aIsFabricFiltered, aPath, aAttributeReportIBs, aEncoderState));
+    ReturnErrorOnFailure(
+        ReadSingleClusterData(aSubjectDescriptor, aIsFabricFiltered, aPath, aAttributeReportIBs, aEncoderState, aAccessAllowed));
     MatterPostAttributeReadCallback(aPath);
     return CHIP_NO_ERROR;
 }
@@ -97,6 +104,89 @@ static bool IsOutOfWriterSpaceError(CHIP_ERROR err)
     return err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL;
 }
 
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+namespace {
+
+// Appends the AttributeReportIB elements of a cached fragment.
+CHIP_ERROR CopyReportFragment(AttributeReportIBs::Builder & aAttributeReportIBs, const ByteSpan & aFragment)
+{
+    TLV::TLVReader reader;
+    CHIP_ERROR err;
+
+    reader.Init(aFragment);
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(aAttributeReportIBs.GetWriter()->CopyElement(TLV::AnonymousTag(), reader));
+    }
+    return err == CHIP_END_OF_TLV ? CHIP_NO_ERROR : err;
+}
+
+} // namespace
+
+CHIP_ERROR Engine::RetrieveClusterDataThroughReportCache(ReadHandler * apReadHandler,
+                                                         AttributeReportIBs::Builder & aAttributeReportIBs,
+                                                         const ConcreteReadAttributePath & aPath,
+                                                         AttributeValueEncoder::AttributeEncodeState * aEncoderState)
+{
+    const SubjectDescriptor subjectDescriptor = apReadHandler->GetSubjectDescriptor();
+    const bool isFabricFiltered               = apReadHandler->IsFabricFiltered();
+
+    // Paths already found too large for the cache are encoded directly, without a separate access check.
+    if (mReportCache.IsOversized(aPath))
+    {
+        return RetrieveClusterData(subjectDescriptor, isFabricFiltered, aAttributeReportIBs, aPath, aEncoderState);
+    }
+
+    // The access control outcome is part of the key, since ReadSingleClusterData encodes a status instead of the data, or
+    // nothing at all for expanded paths, when access is denied. It is handed over to ReadSingleClusterData, so that the check
+    // is only made once.
+    RequestPath requestPath{ .cluster = aPath.mClusterId, .endpoint = aPath.mEndpointId };
+    CHIP_ERROR err = GetAccessControl().Check(subjectDescriptor, requestPath, RequiredPrivilege::ForReadAttribute(aPath));
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_ACCESS_DENIED)
+    {
+        // Let ReadSingleClusterData report the failure the way it always does, which may be an unsupported path status.
+        return RetrieveClusterData(subjectDescriptor, isFabricFiltered, aAttributeReportIBs, aPath, aEncoderState);
+    }
+
+    const bool accessAllowed = (err == CHIP_NO_ERROR);
+    ReportCache::Key key(aPath, subjectDescriptor.fabricIndex, isFabricFiltered, accessAllowed);
+    ByteSpan fragment;
+    if (mReportCache.Lookup(key, fragment))
+    {
+        TLV::TLVWriter backup;
+        aAttributeReportIBs.Checkpoint(backup);
+        if (CopyReportFragment(aAttributeReportIBs, fragment) == CHIP_NO_ERROR)
+        {
+            return CHIP_NO_ERROR;
+        }
+
+        // Most likely out of space: let RetrieveClusterData encode the attribute, as it knows how to chunk it.
+        aAttributeReportIBs.Rollback(backup);
+        return RetrieveClusterData(subjectDescriptor, isFabricFiltered, aAttributeReportIBs, aPath, aEncoderState,
+                                   MakeOptional(accessAllowed));
+    }
+
+    // Encode straight into the report, then keep a copy of what was written if it fits in an entry. Report messages are
+    // encoded into a single buffer, so what was written is contiguous.
+    TLV::TLVWriter * writer     = aAttributeReportIBs.GetWriter();
+    const uint8_t * start       = writer->GetWritePoint();
+    const uint32_t lengthBefore = writer->GetLengthWritten();
+    ReturnErrorOnFailure(RetrieveClusterData(subjectDescriptor, isFabricFiltered, aAttributeReportIBs, aPath, aEncoderState,
+                                             MakeOptional(accessAllowed)));
+
+    const size_t length = writer->GetLengthWritten() - lengthBefore;
+    if (length <= ReportCache::kMaxFragmentSize && writer->GetWritePoint() == start + length)
+    {
+        mReportCache.Insert(key, ByteSpan(start, length));
+    }
+    else
+    {
+        mReportCache.MarkOversized(aPath);
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+
 CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & aReportDataBuilder,
                                                            ReadHandler * apReadHandler, bool * apHasMoreChunks,
                                                            bool * apHasEncodedData)
@@ -194,8 +284,18 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             ConcreteReadAttributePath pathForRetrieval(readPath);
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeValueEncoder::AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(), attributeReportIBs,
-                                      pathForRetrieval, &encodeState);
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+            // Another read handler may already have encoded this path, unless we are resuming a list chunked in a previous report.
+            if (!encodeState.AllowPartialData() && mpImEngine->mReadHandlers.Allocated() > 1)
+            {
+                err = RetrieveClusterDataThroughReportCache(apReadHandler, attributeReportIBs, pathForRetrieval, &encodeState);
+            }
+            else
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+            {
+                err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(),
+                                          attributeReportIBs, pathForRetrieval, &encodeState);
+            }
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(DataManagement,
@@ -473,10 +573,11 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::System::PacketBufferTLVWriter reportDataWriter;
     ReportDataMessage::Builder reportDataBuilder;
-    chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    uint16_t reservedSize                      = 0;
-    bool hasMoreChunks                         = false;
-    bool needCloseReadHandler                  = false;
+    chip::System::PacketBufferHandle bufHandle;
+    size_t maxSduLength       = kMaxSecureSduLengthBytes;
+    uint16_t reservedSize     = 0;
+    bool hasMoreChunks        = false;
+    bool needCloseReadHandler = false;
 
     // Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
     const uint32_t kReservedSizeForMoreChunksFlag = 1 + 1;
@@ -491,13 +592,20 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     // Reserved size for an empty EventReportIBs, so we can at least check if there are any events need to be reported.
     const uint32_t kReservedSizeForEventReportIBs = 3; // type, tag, end of container
 
+    CHIP_IM_LATENCY_SCOPE(latency, InteractionLatencyStats::Operation::kReport, kInvalidClusterId);
+    CHIP_IM_LATENCY_TRACK_WRITER(latency, reportDataWriter);
+
     VerifyOrExit(apReadHandler != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(apReadHandler->GetSession() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+    // Sessions over TCP are not bound by the network MTU, so their reports are chunked in much larger messages.
+    maxSduLength = apReadHandler->GetSession()->AllowsLargePayload() ? kMaxLargeSecureSduLengthBytes : kMaxSecureSduLengthBytes;
+    bufHandle    = System::PacketBufferHandle::New(maxSduLength);
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
-    if (bufHandle->AvailableDataLength() > kMaxSecureSduLengthBytes)
+    if (bufHandle->AvailableDataLength() > maxSduLength)
     {
-        reservedSize = static_cast<uint16_t>(bufHandle->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        reservedSize = static_cast<uint16_t>(bufHandle->AvailableDataLength() - maxSduLength);
     }
 
     reportDataWriter.Init(std::move(bufHandle));
@@ -506,8 +614,8 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     reportDataWriter.ReserveBuffer(mReservedSize);
 #endif
 
-    // Always limit the size of the generated packet to fit within kMaxSecureSduLengthBytes regardless of the available buffer
-    // capacity.
+    // Always limit the size of the generated packet to fit within the max SDU length of the session regardless of the available
+    // buffer capacity.
     // Also, we need to reserve some extra space for the MIC field.
     reportDataWriter.ReserveBuffer(static_cast<uint32_t>(reservedSize + chip::Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES));
 
@@ -644,9 +752,26 @@ void Engine::Run()
 {
     uint32_t numReadHandled = 0;
 
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    // Attributes that are not reported as dirty, e.g. counters or clocks, may have changed since the last run.
+    mReportCache.Invalidate();
+#endif
+
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
     size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
+
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+    // Let the report scheduler choose which handlers get the reports in flight, if it orders them. Pools that can grow past
+    // the configured number of handlers fall back to round-robin when they do.
+    if (mpImEngine->GetReportScheduler()->OrdersReportableHandlers() && initialAllocated <= ArraySize(mOrderedReadHandlers))
+    {
+        VerifyOrReturn(BuildReportsInSchedulerOrder() == CHIP_NO_ERROR);
+        // Nothing left to go through round-robin.
+        numReadHandled = static_cast<uint32_t>(initialAllocated);
+    }
+#endif // CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+
     while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
     {
         ReadHandler * readHandler =
@@ -702,6 +827,48 @@ void Engine::Run()
     }
 }
 
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+CHIP_ERROR Engine::BuildReportsInSchedulerOrder()
+{
+    ReportScheduler * scheduler = mpImEngine->GetReportScheduler();
+    size_t numReportable        = 0;
+
+    mpImEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        VerifyOrReturnValue(numReportable < ArraySize(mOrderedReadHandlers), Loop::Break);
+        if (handler->ShouldReportUnscheduled() || scheduler->IsReportableNow(handler))
+        {
+            mOrderedReadHandlers[numReportable++] = handler;
+        }
+        return Loop::Continue;
+    });
+
+    scheduler->OrderReportableHandlers(Span<ReadHandler *>(mOrderedReadHandlers, numReportable));
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    for (size_t i = 0; i < numReportable && mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT; i++)
+    {
+        ReadHandler * readHandler = mOrderedReadHandlers[i];
+        // Building a report may have deallocated read handlers further down the list, or made them unreportable.
+        if (readHandler == nullptr || !(readHandler->ShouldReportUnscheduled() || scheduler->IsReportableNow(readHandler)))
+        {
+            continue;
+        }
+
+        mRunningReadHandler = readHandler;
+        err                 = BuildAndSendSingleReportData(readHandler);
+        mRunningReadHandler = nullptr;
+        SuccessOrExit(err);
+    }
+
+exit:
+    for (size_t i = 0; i < numReportable; i++)
+    {
+        mOrderedReadHandlers[i] = nullptr;
+    }
+    return err;
+}
+#endif // CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
     return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
@@ -840,6 +1007,9 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
 CHIP_ERROR Engine::SetDirty(AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    mReportCache.Invalidate();
+#endif
 
     bool intersectsInterestPath = false;
     mpImEngine->mReadHandlers.ForEachActiveObject([&aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
@@ -936,7 +1106,7 @@ CHIP_ERROR Engine::ScheduleEventDelivery(ConcreteEventPath & aPath, uint32_t aBy
     // we don't need to call schedule run for event.
     // If schedule run is called, actually we would not delivery events as well.
     // Just wanna save one schedule run here
-    if (mpImEngine->mEventPathPool.Allocated() == 0)
+    if (!HasEventPaths())
     {
         return CHIP_NO_ERROR;
     }
@@ -971,6 +1141,21 @@ CHIP_ERROR Engine::ScheduleEventDelivery(ConcreteEventPath & aPath, uint32_t aBy
     return ScheduleBufferPressureEventDelivery(aBytesWritten);
 }
 
+bool Engine::HasEventPaths()
+{
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+    // Event paths are allocated from the arenas of the read handlers, not from the pool of the InteractionModelEngine.
+    bool hasEventPaths = false;
+    mpImEngine->mReadHandlers.ForEachActiveObject([&hasEventPaths](ReadHandler * handler) {
+        hasEventPaths = (handler->GetEventPathList() != nullptr);
+        return hasEventPaths ? Loop::Break : Loop::Continue;
+    });
+    return hasEventPaths;
+#else
+    return mpImEngine->mEventPathPool.Allocated() != 0;
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+}
+
 void Engine::ScheduleUrgentEventDeliverySync(Optional<FabricIndex> fabricIndex)
 {
     mpImEngine->mReadHandlers.ForEachActiveObject([fabricIndex](ReadHandler * handler) {
@@ -27,6 +27,7 @@
 #include <access/AccessControl.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/reporting/EncodedReportCache.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -122,6 +123,16 @@ public:
             // https://github.com/project-chip/connectedhomeip/issues/13809
             mCurReadHandlerIdx = 0;
         }
+
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+        for (auto & handler : mOrderedReadHandlers)
+        {
+            if (handler == apReadHandlerBeingDeleted)
+            {
+                handler = nullptr;
+            }
+        }
+#endif // CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
     }
 
     uint32_t GetNumReportsInFlight() const { return mNumReportsInFlight; }
@@ -140,6 +151,16 @@ public:
     size_t GetGlobalDirtySetSize() { return mGlobalDirtySet.Allocated(); }
 #endif
 
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    using ReportCache = EncodedReportCache<CHIP_IM_SERVER_REPORT_CACHE_SIZE, CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRY_SIZE>;
+
+    /**
+     * Hit rate and usage of the cache of encoded attribute reports shared between read handlers.
+     */
+    const ReportCache::Stats & GetReportCacheStats() const { return mReportCache.GetStats(); }
+    void ResetReportCacheStats() { mReportCache.ResetStats(); }
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+
 private:
     /**
      * Main work-horse function that executes the run-loop.
@@ -171,7 +192,24 @@ private:
     CHIP_ERROR RetrieveClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                                    AttributeReportIBs::Builder & aAttributeReportIBs,
                                    const ConcreteReadAttributePath & aClusterInfo,
-                                   AttributeValueEncoder::AttributeEncodeState * apEncoderState);
+                                   AttributeValueEncoder::AttributeEncodeState * apEncoderState,
+                                   Optional<bool> aAccessAllowed = NullOptional);
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    /**
+     * Same as RetrieveClusterData for apReadHandler, but copies the AttributeReportIBs from the report cache when another
+     * read handler with the same access has already encoded aPath, and caches them otherwise.
+     */
+    CHIP_ERROR RetrieveClusterDataThroughReportCache(ReadHandler * apReadHandler, AttributeReportIBs::Builder & aAttributeReportIBs,
+                                                     const ConcreteReadAttributePath & aPath,
+                                                     AttributeValueEncoder::AttributeEncodeState * aEncoderState);
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+    /**
+     * Build reports for the reportable read handlers, in the order chosen by the report scheduler, until we run out of
+     * reports in flight.
+     */
+    CHIP_ERROR BuildReportsInSchedulerOrder();
+#endif // CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
     CHIP_ERROR CheckAccessDeniedEventPaths(TLV::TLVWriter & aWriter, bool & aHasEncodedData, ReadHandler * apReadHandler);
 
     // If version match, it means don't send, if version mismatch, it means send.
@@ -195,6 +233,10 @@ private:
     static void Run(System::Layer * aSystemLayer, void * apAppState);
 
     CHIP_ERROR ScheduleBufferPressureEventDelivery(uint32_t aBytesWritten);
+
+    // Whether any read handler is interested in events.
+    bool HasEventPaths();
+
     void GetMinEventLogPosition(uint32_t & aMinLogPosition);
 
     /**
@@ -256,6 +298,13 @@ private:
      */
     ReadHandler * mRunningReadHandler = nullptr;
 
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+    /**
+     * The read handlers BuildReportsInSchedulerOrder() is serving, in order. Handlers deallocated while it runs are set to nullptr.
+     */
+    ReadHandler * mOrderedReadHandlers[CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS] = {};
+#endif // CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+
     /**
      *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
      *
@@ -287,6 +336,14 @@ private:
 #endif
 
     InteractionModelEngine * mpImEngine = nullptr;
+
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    /**
+     * Encoded attribute reports shared between the read handlers served by a run. Invalidated at the start of each run and
+     * whenever a path is marked dirty, so that it never holds data older than the current dirty set generation.
+     */
+    ReportCache mReportCache;
+#endif
 };
 
 }; // namespace reporting
@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AppConfig.h>
+#include <app/reporting/PriorityReportSchedulerImpl.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+using namespace System::Clock;
+
+bool PriorityReportSchedulerImpl::ReportRank::IsServedBefore(const ReportRank & aOther) const
+{
+    // Urgent and overdue reports are not held back by fabric credit.
+    if (mKind != aOther.mKind && (mKind <= ReportKind::kOverdue || aOther.mKind <= ReportKind::kOverdue))
+    {
+        return mKind < aOther.mKind;
+    }
+    if (mHasCredit != aOther.mHasCredit)
+    {
+        return mHasCredit;
+    }
+    if (mKind != aOther.mKind)
+    {
+        return mKind < aOther.mKind;
+    }
+    return mDeadline < aOther.mDeadline;
+}
+
+void PriorityReportSchedulerImpl::OnSubscriptionReportSent(ReadHandler * aReadHandler)
+{
+    FabricCredit * credit = FindOrAddFabricCredit(aReadHandler->GetAccessingFabricIndex());
+    if (nullptr != credit && credit->mCredits > 0)
+    {
+        credit->mCredits--;
+    }
+
+    ReportSchedulerImpl::OnSubscriptionReportSent(aReadHandler);
+}
+
+void PriorityReportSchedulerImpl::OrderReportableHandlers(Span<ReadHandler *> aReadHandlers)
+{
+    ReportRank ranks[CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS];
+    // The engine never has more handlers than this; leave its order alone if that ever changes.
+    VerifyOrReturn(aReadHandlers.size() <= ArraySize(ranks));
+
+    bool anyHasCredit = false;
+    for (size_t i = 0; i < aReadHandlers.size(); i++)
+    {
+        ranks[i]     = GetReportRank(aReadHandlers[i]);
+        anyHasCredit = anyHasCredit || ranks[i].mHasCredit;
+    }
+
+    if (!anyHasCredit && aReadHandlers.size() > 0)
+    {
+        RefillFabricCredits();
+        for (size_t i = 0; i < aReadHandlers.size(); i++)
+        {
+            ranks[i].mHasCredit = true;
+        }
+    }
+
+    // Insertion sort: the lists are short, and it keeps handlers of equal rank in the order of the engine without allocating.
+    for (size_t i = 1; i < aReadHandlers.size(); i++)
+    {
+        ReadHandler * handler = aReadHandlers[i];
+        ReportRank rank       = ranks[i];
+        size_t j              = i;
+        while (j > 0 && rank.IsServedBefore(ranks[j - 1]))
+        {
+            aReadHandlers[j] = aReadHandlers[j - 1];
+            ranks[j]         = ranks[j - 1];
+            j--;
+        }
+        aReadHandlers[j] = handler;
+        ranks[j]         = rank;
+    }
+}
+
+uint8_t PriorityReportSchedulerImpl::GetFabricCredits(FabricIndex aFabricIndex) const
+{
+    for (size_t i = 0; i < mNumFabricCredits; i++)
+    {
+        if (mFabricCredits[i].mFabricIndex == aFabricIndex)
+        {
+            return mFabricCredits[i].mCredits;
+        }
+    }
+    return CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS;
+}
+
+PriorityReportSchedulerImpl::ReportRank PriorityReportSchedulerImpl::GetReportRank(ReadHandler * aReadHandler)
+{
+    ReportRank rank;
+    rank.mHasCredit = GetFabricCredits(aReadHandler->GetAccessingFabricIndex()) > 0;
+
+    // Reads and priming reports have no node, they are reported as soon as the engine runs.
+    ReadHandlerNode * node = FindReadHandlerNode(aReadHandler);
+    if (nullptr == node)
+    {
+        rank.mKind     = ReportKind::kUrgent;
+        rank.mDeadline = Milliseconds64(0);
+        return rank;
+    }
+
+    if (aReadHandler->ShouldReportUnscheduled() || aReadHandler->IsChunkedReport() ||
+        aReadHandler->mFlags.Has(ReadHandler::ReadHandlerFlags::ForceDirty))
+    {
+        rank.mKind     = ReportKind::kUrgent;
+        rank.mDeadline = node->GetMinTimestamp();
+    }
+    else if (mTimerDelegate->GetCurrentMonotonicTimestamp() >= node->GetMaxTimestamp())
+    {
+        // The subscriber expects a report by now, and may soon consider the subscription lost.
+        rank.mKind     = ReportKind::kOverdue;
+        rank.mDeadline = node->GetMaxTimestamp();
+    }
+    else if (aReadHandler->IsDirty())
+    {
+        rank.mKind     = ReportKind::kDirty;
+        rank.mDeadline = node->GetMinTimestamp();
+    }
+    else
+    {
+        rank.mKind     = ReportKind::kKeepAlive;
+        rank.mDeadline = node->GetMaxTimestamp();
+    }
+    return rank;
+}
+
+PriorityReportSchedulerImpl::FabricCredit * PriorityReportSchedulerImpl::FindOrAddFabricCredit(FabricIndex aFabricIndex)
+{
+    for (size_t i = 0; i < mNumFabricCredits; i++)
+    {
+        if (mFabricCredits[i].mFabricIndex == aFabricIndex)
+        {
+            return &mFabricCredits[i];
+        }
+    }
+
+    VerifyOrReturnValue(mNumFabricCredits < ArraySize(mFabricCredits), nullptr);
+    FabricCredit * credit = &mFabricCredits[mNumFabricCredits++];
+    credit->mFabricIndex  = aFabricIndex;
+    credit->mCredits      = CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS;
+    return credit;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/reporting/ReportSchedulerImpl.h>
+#include <lib/core/DataModelTypes.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @class PriorityReportSchedulerImpl
+ *
+ * @brief This class extends ReportSchedulerImpl and chooses the order in which the reporting engine serves reportable
+ * ReadHandlers.
+ *
+ * Each node still schedules its own reports as in ReportSchedulerImpl. The order only matters when more ReadHandlers are
+ * reportable than there can be reports in flight, in which case the handlers served last wait for the next engine run.
+ *
+ * ## Ordering Logic
+ *
+ * Reportable ReadHandlers are ranked, from first to last served, by:
+ *
+ * - Urgency: reads, priming reports, ongoing chunked reports and handlers forced dirty (e.g. by an urgent event) come first.
+ *
+ * - Overdue reports: handlers that reached their max interval, with or without dirty data, come next, so that a steady flow
+ *   of dirty reports cannot hold back the reports that keep other subscriptions alive.
+ *
+ * - Fabric credit: each fabric may send CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS subscription reports before its
+ *   handlers are ranked after the handlers of the fabrics that still have credit. Credits of all fabrics are refilled once no
+ *   reportable handler belongs to a fabric with credit left, so that the scheduler never leaves a report in flight unused.
+ *
+ * - Report kind: handlers with dirty data come before the others.
+ *
+ * - Deadline: the earliest min interval expiry for dirty handlers, and the earliest max interval expiry for the others.
+ *
+ * @note Urgent and overdue reports are not held back by fabric credit, but they still use it up.
+ */
+class PriorityReportSchedulerImpl : public ReportSchedulerImpl
+{
+public:
+    PriorityReportSchedulerImpl(TimerDelegate * aTimerDelegate) : ReportSchedulerImpl(aTimerDelegate) {}
+
+    /**
+     * @brief When a ReadHandler report is sent, use one credit of its fabric and reschedule the report as
+     * ReportSchedulerImpl does.
+     */
+    void OnSubscriptionReportSent(ReadHandler * aReadHandler) override;
+
+    /**
+     * @brief Sort the reportable ReadHandlers according to the ordering logic described above. Handlers of equal rank keep
+     * their relative order.
+     */
+    void OrderReportableHandlers(Span<ReadHandler *> aReadHandlers) override;
+    bool OrdersReportableHandlers() const override { return true; }
+
+    /// @brief Get the number of subscription reports a fabric may still send before other fabrics are served first
+    uint8_t GetFabricCredits(FabricIndex aFabricIndex) const;
+
+private:
+    friend class chip::app::reporting::TestReportScheduler;
+
+    enum class ReportKind : uint8_t
+    {
+        kUrgent    = 0,
+        kOverdue   = 1,
+        kDirty     = 2,
+        kKeepAlive = 3,
+    };
+
+    struct ReportRank
+    {
+        bool mHasCredit;
+        ReportKind mKind;
+        Timestamp mDeadline;
+
+        bool IsServedBefore(const ReportRank & aOther) const;
+    };
+
+    static_assert(CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS > 0 && CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS <= UINT8_MAX,
+                  "Fabric credits must fit in a uint8_t and not be 0");
+
+    struct FabricCredit
+    {
+        FabricIndex mFabricIndex;
+        uint8_t mCredits;
+    };
+
+    ReportRank GetReportRank(ReadHandler * aReadHandler);
+
+    /// @brief Find the credit entry of a fabric, allocating one with full credit if the fabric has none
+    /// @return The entry, or nullptr if all the entries are in use, in which case the fabric keeps full credit
+    FabricCredit * FindOrAddFabricCredit(FabricIndex aFabricIndex);
+
+    /// @brief Give every fabric its full credit back
+    void RefillFabricCredits() { mNumFabricCredits = 0; }
+
+    // Fabrics that have sent reports since the last refill. Fabrics without an entry have full credit. The extra entry is for
+    // subscriptions over PASE sessions, which have no fabric.
+    FabricCredit mFabricCredits[CHIP_CONFIG_MAX_FABRICS + 1];
+    size_t mNumFabricCredits = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -21,6 +21,7 @@
 #include <app/ReadHandler.h>
 #include <app/icd/server/ICDStateObserver.h>
 #include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
 #include <system/SystemClock.h>
 
 namespace chip {
@@ -202,6 +203,17 @@ public:
         return (nullptr != node) ? node->IsReportableNow(now) : false;
     }
 
+    /// @brief Reorder the ReadHandlers the reporting engine is about to build reports for. The engine builds reports in the
+    /// resulting order until it runs out of reports in flight, so the handlers placed first are the ones served first when there
+    /// are more reportable handlers than reports in flight. The default implementation keeps the order of the engine.
+    /// @note Only used by the reporting engine when CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED is set.
+    /// @param[in,out] aReadHandlers read handlers that are reportable now
+    virtual void OrderReportableHandlers(Span<ReadHandler *> aReadHandlers) {}
+
+    /// @brief Whether OrderReportableHandlers() chooses an order. When it does not, the reporting engine serves the reportable
+    /// ReadHandlers round-robin.
+    virtual bool OrdersReportableHandlers() const { return false; }
+
     /// @brief Check if a ReadHandler is reportable without considering the timing
     bool IsReadHandlerReportable(ReadHandler * aReadHandler) const
     {
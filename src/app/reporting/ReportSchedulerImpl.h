@@ -112,7 +112,7 @@ public:
      *
      * @note This method sets a now Timestamp that is used to calculate the next report timeout.
      */
-    void OnSubscriptionReportSent(ReadHandler * aReadHandler) final;
+    void OnSubscriptionReportSent(ReadHandler * aReadHandler) override;
 
     /**
      * @brief When a ReadHandler is destroyed, remove the node from the scheduler node pool and cancel the timer associated to it.
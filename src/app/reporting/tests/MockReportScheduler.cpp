@@ -17,6 +17,7 @@
  */
 
 #include <app/TimerDelegates.h>
+#include <app/reporting/PriorityReportSchedulerImpl.h>
 #include <app/reporting/ReportSchedulerImpl.h>
 #include <app/reporting/SynchronizedReportSchedulerImpl.h>
 
@@ -24,12 +25,13 @@ namespace chip {
 namespace app {
 namespace reporting {
 
-/// @brief Static instance of the default report scheduler and synchronized report scheduler meant for injection into IM engine in
+/// @brief Static instances of the default, synchronized and priority report schedulers meant for injection into IM engine in
 /// tests
 
 static chip::app::DefaultTimerDelegate sTimerDelegate;
 static ReportSchedulerImpl sTestDefaultReportScheduler(&sTimerDelegate);
 static SynchronizedReportSchedulerImpl sTestSyncReportScheduler(&sTimerDelegate);
+static PriorityReportSchedulerImpl sTestPriorityReportScheduler(&sTimerDelegate);
 
 ReportSchedulerImpl * GetDefaultReportScheduler()
 {
@@ -41,6 +43,11 @@ SynchronizedReportSchedulerImpl * GetSynchronizedReportScheduler()
     return &sTestSyncReportScheduler;
 }
 
+PriorityReportSchedulerImpl * GetPriorityReportScheduler()
+{
+    return &sTestPriorityReportScheduler;
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
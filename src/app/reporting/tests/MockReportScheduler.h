@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <app/reporting/PriorityReportSchedulerImpl.h>
 #include <app/reporting/ReportSchedulerImpl.h>
 #include <app/reporting/SynchronizedReportSchedulerImpl.h>
 
@@ -29,6 +30,8 @@ ReportSchedulerImpl * GetDefaultReportScheduler();
 
 SynchronizedReportSchedulerImpl * GetSynchronizedReportScheduler();
 
+PriorityReportSchedulerImpl * GetPriorityReportScheduler();
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
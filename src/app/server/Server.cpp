@@ -692,7 +692,11 @@ PersistentStorageOperationalKeystore CommonCaseDeviceServerInitParams::sPersiste
 Credentials::PersistentStorageOpCertStore CommonCaseDeviceServerInitParams::sPersistentStorageOpCertStore;
 Credentials::GroupDataProviderImpl CommonCaseDeviceServerInitParams::sGroupDataProvider;
 app::DefaultTimerDelegate CommonCaseDeviceServerInitParams::sTimerDelegate;
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+app::reporting::PriorityReportSchedulerImpl
+#else
 app::reporting::ReportSchedulerImpl
+#endif // CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
     CommonCaseDeviceServerInitParams::sReportScheduler(&CommonCaseDeviceServerInitParams::sTimerDelegate);
 #if CHIP_CONFIG_ENABLE_SESSION_RESUMPTION
 SimpleSessionResumptionStorage CommonCaseDeviceServerInitParams::sSessionResumptionStorage;
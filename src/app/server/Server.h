@@ -66,7 +66,11 @@
 #include <transport/raw/BLE.h>
 #endif
 #include <app/TimerDelegates.h>
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+#include <app/reporting/PriorityReportSchedulerImpl.h>
+#else
 #include <app/reporting/ReportSchedulerImpl.h>
+#endif // CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
 #include <transport/raw/UDP.h>
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -277,7 +281,11 @@ private:
     static Credentials::PersistentStorageOpCertStore sPersistentStorageOpCertStore;
     static Credentials::GroupDataProviderImpl sGroupDataProvider;
     static chip::app::DefaultTimerDelegate sTimerDelegate;
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+    static app::reporting::PriorityReportSchedulerImpl sReportScheduler;
+#else
     static app::reporting::ReportSchedulerImpl sReportScheduler;
+#endif // CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
 
 #if CHIP_CONFIG_ENABLE_SESSION_RESUMPTION
     static SimpleSessionResumptionStorage sSessionResumptionStorage;
@@ -21,8 +21,12 @@
 #include <app/ConcreteAttributePath.h>
 #include <app/EventManagement.h>
 #include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/TLVDebug.h>
+#include <lib/support/CHIPFaultInjection.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/LinkedList.h>
@@ -417,8 +421,128 @@ void TestMultipleClusInfo(nlTestSuite * apSuite, void * apContext)
     NL_TEST_ASSERT(apSuite, index == ArraySize(paths));
 }
 
+void TestResumeFromCopy(nlTestSuite * apSuite, void * apContext)
+{
+    SingleLinkedListNode<app::AttributePathParams> clusInfo;
+
+    // Copying the iterator is how a ReadHandler rolls back to the first path that did not fit in a chunk.
+    app::AttributePathExpandIterator iter(&clusInfo);
+    for (int i = 0; i < 7; i++)
+    {
+        NL_TEST_ASSERT(apSuite, iter.Next());
+    }
+
+    app::AttributePathExpandIterator resumed = iter;
+    app::ConcreteAttributePath path;
+    app::ConcreteAttributePath resumedPath;
+    size_t count = 0;
+    for (; iter.Get(path); iter.Next(), resumed.Next())
+    {
+        NL_TEST_ASSERT(apSuite, resumed.Get(resumedPath) && resumedPath == path);
+        count++;
+    }
+    NL_TEST_ASSERT(apSuite, !resumed.Valid());
+    NL_TEST_ASSERT(apSuite, count > 0);
+}
+
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+const MockNodeConfig & WithoutEndpoint2Config()
+{
+    // clang-format off
+    static const MockNodeConfig config({
+        MockEndpointConfig(kMockEndpoint1, {
+            MockClusterConfig(MockClusterId(1), {
+                Clusters::Globals::Attributes::ClusterRevision::Id, Clusters::Globals::Attributes::FeatureMap::Id,
+            }),
+        }),
+        MockEndpointConfig(kMockEndpoint3, {
+            MockClusterConfig(MockClusterId(1), {
+                Clusters::Globals::Attributes::ClusterRevision::Id, Clusters::Globals::Attributes::FeatureMap::Id,
+                MockAttributeId(1),
+            }),
+        }),
+    });
+    // clang-format on
+    return config;
+}
+
+void TestResumeInRebuiltTable(nlTestSuite * apSuite, void * apContext)
+{
+    SingleLinkedListNode<app::AttributePathParams> clusInfo;
+    clusInfo.mValue.mClusterId = MockClusterId(1);
+
+    app::AttributePathExpandIterator iter(&clusInfo);
+    app::ConcreteAttributePath path;
+    const P lastPath(kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::FeatureMap::Id);
+    while (iter.Get(path) && !(path == lastPath))
+    {
+        iter.Next();
+    }
+    NL_TEST_ASSERT(apSuite, iter.Valid());
+
+    // A rebuild of the same data model resumes right after the last path.
+    uint32_t generation = AttributePathTable::Instance().GetGeneration();
+    ResetMockNodeConfig();
+    NL_TEST_ASSERT(apSuite, iter.Next() && iter.Get(path));
+    NL_TEST_ASSERT(apSuite, AttributePathTable::Instance().GetGeneration() == generation + 1);
+    NL_TEST_ASSERT(apSuite,
+                   path == P(kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::GeneratedCommandList::Id));
+
+    // Once the endpoint of the last path is gone, the next endpoint is expanded from its start.
+    SetMockNodeConfig(WithoutEndpoint2Config());
+    NL_TEST_ASSERT(apSuite, iter.Next() && iter.Get(path));
+    NL_TEST_ASSERT(apSuite, path == P(kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::ClusterRevision::Id));
+    NL_TEST_ASSERT(apSuite, iter.Next() && iter.Get(path));
+    NL_TEST_ASSERT(apSuite, path == P(kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::FeatureMap::Id));
+
+    ResetMockNodeConfig();
+}
+
+#if CHIP_WITH_NLFAULTINJECTION
+void TestExpandWhileTableRebuildFails(nlTestSuite * apSuite, void * apContext)
+{
+    SingleLinkedListNode<app::AttributePathParams> clusInfo;
+    clusInfo.mValue.mClusterId = MockClusterId(1);
+
+    app::AttributePathExpandIterator iter(&clusInfo);
+    app::ConcreteAttributePath path;
+    const P lastPath(kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::FeatureMap::Id);
+    while (iter.Get(path) && !(path == lastPath))
+    {
+        iter.Next();
+    }
+    NL_TEST_ASSERT(apSuite, iter.Valid());
+
+    // Every rebuild of the table fails from now on, and endpoint 2 goes away: the out of date table must not be used, the
+    // expansion resumes from the data model instead.
+    FaultInjection::GetManager().FailAtFault(FaultInjection::kFault_AllocAttributePathTable, 0, UINT16_MAX);
+    SetMockNodeConfig(WithoutEndpoint2Config());
+    NL_TEST_ASSERT(apSuite, iter.Next() && iter.Get(path));
+    NL_TEST_ASSERT(apSuite, path == P(kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::ClusterRevision::Id));
+    NL_TEST_ASSERT(apSuite, iter.Next() && iter.Get(path));
+    NL_TEST_ASSERT(apSuite, path == P(kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::FeatureMap::Id));
+    NL_TEST_ASSERT(apSuite, iter.Next() && iter.Get(path));
+    NL_TEST_ASSERT(apSuite, path == P(kMockEndpoint3, MockClusterId(1), MockAttributeId(1)));
+
+    // New iterators walk the data model too.
+    app::AttributePathExpandIterator newIter(&clusInfo);
+    size_t count = 0;
+    for (; newIter.Get(path); newIter.Next())
+    {
+        NL_TEST_ASSERT(apSuite, path.mEndpointId == kMockEndpoint1 || path.mEndpointId == kMockEndpoint3);
+        count++;
+    }
+    NL_TEST_ASSERT(apSuite, count > 0);
+
+    FaultInjection::GetManager().ResetFaultConfigurations(FaultInjection::kFault_AllocAttributePathTable);
+    ResetMockNodeConfig();
+}
+#endif // CHIP_WITH_NLFAULTINJECTION
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+
 static int TestSetup(void * inContext)
 {
+    VerifyOrReturnError(CHIP_NO_ERROR == chip::Platform::MemoryInit(), FAILURE);
     return SUCCESS;
 }
 
@@ -427,6 +551,10 @@ static int TestSetup(void * inContext)
  */
 static int TestTeardown(void * inContext)
 {
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+    AttributePathTable::Instance().Free();
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+    chip::Platform::MemoryShutdown();
     return SUCCESS;
 }
 
@@ -445,6 +573,13 @@ const nlTest sTests[] =
         NL_TEST_DEF("TestWildcardAttribute", TestWildcardAttribute),
         NL_TEST_DEF("TestNoWildcard", TestNoWildcard),
         NL_TEST_DEF("TestMultipleClusInfo", TestMultipleClusInfo),
+        NL_TEST_DEF("TestResumeFromCopy", TestResumeFromCopy),
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+        NL_TEST_DEF("TestResumeInRebuiltTable", TestResumeInRebuiltTable),
+#if CHIP_WITH_NLFAULTINJECTION
+        NL_TEST_DEF("TestExpandWhileTableRebuildFails", TestExpandWhileTableRebuildFails),
+#endif // CHIP_WITH_NLFAULTINJECTION
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
         NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -29,6 +29,7 @@
 #include <lib/support/UnitTestContext.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
+#include <string>
 #include <vector>
 
 using TestContext = chip::Test::AppContext;
@@ -599,10 +600,175 @@ void TestBufferedSequences(nlTestSuite * apSuite, void * apContext)
     });
 }
 
+//
+// Records what a streaming BufferedReadCallback delivers, as e.g. "A" for attribute data, "C[2]" for a list of two items and
+// "C|e" for an attribute error.
+//
+class ListItemRecorder : public BufferedReadCallback::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        // Lists are only ever streamed, only their errors come through here.
+        NL_TEST_ASSERT(gSuite, !aPath.IsListOperation() || aStatus.IsFailure());
+        mEvents.push_back(Name(aPath) + (aStatus.IsSuccess() ? "" : "|e"));
+    }
+
+    void OnAttributeListBegin(const ConcreteDataAttributePath & aPath) override
+    {
+        // A list can only start over before it ends.
+        NL_TEST_ASSERT(gSuite, !mInList || mListPath.MatchesConcreteAttributePath(aPath));
+        NL_TEST_ASSERT(gSuite, aPath.mListOp == ConcreteDataAttributePath::ListOperation::ReplaceAll);
+        mListPath  = aPath;
+        mInList    = true;
+        mItemCount = 0;
+    }
+
+    void OnAttributeListItem(const ConcreteDataAttributePath & aPath, ListIndex aIndex, TLV::TLVReader * apData) override
+    {
+        NL_TEST_ASSERT(gSuite, mInList);
+        NL_TEST_ASSERT(gSuite, aIndex == mItemCount);
+
+        // Items are generated with their index, modulo the range of the smallest item type.
+        if (aPath.mAttributeId == Clusters::UnitTesting::Attributes::ListInt8u::Id)
+        {
+            uint8_t value;
+            NL_TEST_ASSERT(gSuite, DataModel::Decode(*apData, value) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(gSuite, value == static_cast<uint8_t>(aIndex));
+        }
+        else
+        {
+            Clusters::UnitTesting::Structs::TestListStructOctet::DecodableType value;
+            NL_TEST_ASSERT(gSuite, DataModel::Decode(*apData, value) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(gSuite, value.member1 == aIndex);
+        }
+        mItemCount++;
+    }
+
+    void OnAttributeListEnd(const ConcreteDataAttributePath & aPath, const StatusIB & aStatus) override
+    {
+        NL_TEST_ASSERT(gSuite, mInList);
+        mInList = false;
+        mEvents.push_back(Name(aPath) + "[" + std::to_string(mItemCount) + "]" + (aStatus.IsSuccess() ? "" : "|e"));
+    }
+
+    void OnReportEnd() override { NL_TEST_ASSERT(gSuite, !mInList); }
+    void OnDone(ReadClient *) override {}
+
+    std::vector<std::string> mEvents;
+
+private:
+    static std::string Name(const ConcreteAttributePath & aPath)
+    {
+        switch (aPath.mAttributeId)
+        {
+        case Clusters::UnitTesting::Attributes::Int8u::Id:
+            return "A";
+        case Clusters::UnitTesting::Attributes::Int32u::Id:
+            return "B";
+        case Clusters::UnitTesting::Attributes::ListStructOctetString::Id:
+            return "C";
+        case Clusters::UnitTesting::Attributes::ListInt8u::Id:
+            return "D";
+        default:
+            return "?";
+        }
+    }
+
+    ConcreteDataAttributePath mListPath;
+    uint32_t mItemCount = 0;
+    bool mInList        = false;
+};
+
+void RunAndValidateStreamedSequence(std::vector<ValidationInstruction> instructionList, std::vector<std::string> expectedEvents)
+{
+    ListItemRecorder recorder;
+    BufferedReadCallback bufferedCallback(recorder, BufferedReadCallback::ListDelivery::kStreamItems);
+    DataSeriesGenerator generator(bufferedCallback, instructionList);
+    generator.Generate();
+
+    NL_TEST_ASSERT(gSuite, recorder.mEvents == expectedEvents);
+}
+
+void TestStreamedSequences(nlTestSuite * apSuite, void * apContext)
+{
+    ChipLogProgress(DataManagement, "Validating sequences of attribute data IBs with streamed list items...");
+
+    ChipLogProgress(DataManagement, "A B --> A B");
+    RunAndValidateStreamedSequence({ { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kSimpleAttributeB } },
+                                   { "A", "B" });
+
+    ChipLogProgress(DataManagement, "A C[] --> A C[0]");
+    RunAndValidateStreamedSequence(
+        { { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kListAttributeC_Empty } }, { "A", "C[0]" });
+
+    ChipLogProgress(DataManagement, "C[2] C[] --> C[0]");
+    RunAndValidateStreamedSequence(
+        { { ValidationInstruction::kListAttributeC_NotEmpty }, { ValidationInstruction::kListAttributeC_Empty } }, { "C[0]" });
+
+    ChipLogProgress(DataManagement, "C[] C0..C511 C[2] --> C[2]");
+    RunAndValidateStreamedSequence(
+        { { ValidationInstruction::kListAttributeC_NotEmpty_Chunked }, { ValidationInstruction::kListAttributeC_NotEmpty } },
+        { "C[2]" });
+
+    ChipLogProgress(DataManagement, "C[] A C[2] --> C[0] A C[2]");
+    RunAndValidateStreamedSequence({ { ValidationInstruction::kListAttributeC_Empty },
+                                     { ValidationInstruction::kSimpleAttributeA },
+                                     { ValidationInstruction::kListAttributeC_NotEmpty } },
+                                   { "C[0]", "A", "C[2]" });
+
+    ChipLogProgress(DataManagement, "C[2] C|e --> C[2]|e C|e");
+    RunAndValidateStreamedSequence(
+        { { ValidationInstruction::kListAttributeC_NotEmpty }, { ValidationInstruction::kListAttributeC_Error } },
+        { "C[2]|e", "C|e" });
+
+    ChipLogProgress(DataManagement, "C|e C[2] --> C|e C[2]");
+    RunAndValidateStreamedSequence(
+        { { ValidationInstruction::kListAttributeC_Error }, { ValidationInstruction::kListAttributeC_NotEmpty } },
+        { "C|e", "C[2]" });
+
+    ChipLogProgress(DataManagement, "C[] C0..C511 --> C[512]");
+    RunAndValidateStreamedSequence({ { ValidationInstruction::kListAttributeC_NotEmpty_Chunked } }, { "C[512]" });
+
+    ChipLogProgress(DataManagement, "C[] C0..C511 D[] D0..D511 A --> C[512] D[512] A");
+    RunAndValidateStreamedSequence({ { ValidationInstruction::kListAttributeC_NotEmpty_Chunked },
+                                     { ValidationInstruction::kListAttributeD_NotEmpty_Chunked },
+                                     { ValidationInstruction::kSimpleAttributeA } },
+                                   { "C[512]", "D[512]", "A" });
+}
+
+//
+// Records the largest message length a BufferedReadCallback is told the reports arrive in.
+//
+class MaxSduLengthRecorder : public BufferedReadCallback::Callback
+{
+public:
+    void OnReportMaxSduLength(size_t aMaxSduLength) override { mMaxSduLength = aMaxSduLength; }
+    void OnDone(ReadClient *) override {}
+
+    size_t mMaxSduLength = 0;
+};
+
+void TestReportMaxSduLength(nlTestSuite * apSuite, void * apContext)
+{
+    MaxSduLengthRecorder recorder;
+    BufferedReadCallback bufferedCallback(recorder);
+    ReadClient::Callback * callback = &bufferedCallback;
+
+    // The length is passed on to the wrapped callback, which may buffer data as well.
+    callback->OnReportMaxSduLength(kMaxLargeSecureSduLengthBytes);
+    NL_TEST_ASSERT(apSuite, recorder.mMaxSduLength == kMaxLargeSecureSduLengthBytes);
+
+    callback->OnReportMaxSduLength(kMaxSecureSduLengthBytes);
+    NL_TEST_ASSERT(apSuite, recorder.mMaxSduLength == kMaxSecureSduLengthBytes);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestBufferedSequences", TestBufferedSequences),
+    NL_TEST_DEF("TestStreamedSequences", TestStreamedSequences),
+    NL_TEST_DEF("TestReportMaxSduLength", TestReportMaxSduLength),
     NL_TEST_SENTINEL()
 };
 
@@ -128,7 +128,7 @@ public:
 
     void SetExpectation() { mExpectedBuffers.clear(); }
 
-    void ValidateData(TLV::TLVReader & aData, bool isListOperation)
+    void ValidateData(TLV::TLVReader & aData)
     {
         NL_TEST_ASSERT(gSuite, !mExpectedBuffers.empty());
         if (!mExpectedBuffers.empty() > 0)
@@ -136,15 +136,8 @@ public:
             auto buffer = mExpectedBuffers.front();
             mExpectedBuffers.erase(mExpectedBuffers.begin());
             uint32_t length = static_cast<uint32_t>(buffer.size());
-            if (isListOperation)
-            {
-                // List operation will attach end of container
-                NL_TEST_ASSERT(gSuite, length < aData.GetRemainingLength());
-            }
-            else
-            {
-                NL_TEST_ASSERT(gSuite, length == aData.GetRemainingLength());
-            }
+            // Lists are reassembled by the cache from their streamed items, with nothing after the end of the list.
+            NL_TEST_ASSERT(gSuite, length == aData.GetRemainingLength());
             if (length <= aData.GetRemainingLength() && length > 0)
             {
                 NL_TEST_ASSERT(gSuite, memcmp(aData.GetReadPoint(), buffer.data(), length) == 0);
@@ -295,7 +288,7 @@ private:
             NL_TEST_ASSERT(gSuite, apData != nullptr);
             if (apData)
             {
-                mDataCallbackValidator.ValidateData(*apData, aPath.IsListOperation());
+                mDataCallbackValidator.ValidateData(*apData);
             }
         }
         else
@@ -0,0 +1,219 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/InteractionModelEngine.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/DataModelHandler.h>
+#include <app/util/attribute-storage.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+using TestContext = chip::Test::AppContext;
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+//
+// This suite runs against the real attribute storage of the controller data model rather than the mock ember. Its generated
+// endpoint_config only has the fixed endpoint 1, so the root endpoint and the bridged endpoints below are all dynamic.
+//
+constexpr EndpointId kRootEndpointId       = 0;
+constexpr EndpointId kAggregatorEndpointId = 2;
+constexpr EndpointId kBridgedEndpointId3   = 3;
+constexpr EndpointId kBridgedEndpointId4   = 4;
+
+constexpr uint16_t kRootIndex       = 0;
+constexpr uint16_t kAggregatorIndex = 1;
+constexpr uint16_t kBridgedIndex    = 2;
+constexpr uint16_t kTestIndexCount  = 3;
+
+static_assert(CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT >= kTestIndexCount, "Not enough dynamic endpoints for the tests");
+
+// clang-format off
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(descriptorAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(Descriptor::Attributes::PartsList::Id, ARRAY, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpointClusters)
+DECLARE_DYNAMIC_CLUSTER(Descriptor::Id, descriptorAttrs, ZAP_CLUSTER_MASK(SERVER), nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint, testEndpointClusters);
+// clang-format on
+
+// The Descriptor cluster is the only server cluster of the test endpoints, so each of them has a single data version.
+// Reporting a change of the PartsList bumps it, while reporting a whole endpoint does not.
+DataVersion gDataVersions[kTestIndexCount];
+
+CHIP_ERROR SetTestEndpoint(uint16_t index, EndpointId endpoint, EndpointId parentEndpoint)
+{
+    return emberAfSetDynamicEndpoint(index, endpoint, &testEndpoint, Span<DataVersion>(&gDataVersions[index], 1),
+                                     Span<const EmberAfDeviceType>(), parentEndpoint);
+}
+
+// Every call to MatterReportingAttributeChangeCallback marks a path dirty, which bumps the dirty set generation.
+uint64_t GetReportCount()
+{
+    return InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
+}
+
+void ClearTestEndpoints()
+{
+    for (uint16_t index = kTestIndexCount; index > 0; index--)
+    {
+        emberAfClearDynamicEndpoint(static_cast<uint16_t>(index - 1));
+    }
+}
+
+/*
+ * Adding endpoints under an aggregator reports each new endpoint, and the PartsList of the root and of the aggregator,
+ * once on commit. Nothing is reported before the outermost batch is committed.
+ */
+void TestCoalescedPartsListReports(nlTestSuite * apSuite, void * apContext)
+{
+    InitDataModelHandler();
+
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kRootIndex, kRootEndpointId, kInvalidEndpointId) == CHIP_NO_ERROR);
+
+    uint64_t reportCount        = GetReportCount();
+    DataVersion rootDataVersion = gDataVersions[kRootIndex];
+
+    emberAfBeginDynamicEndpointBatch();
+
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kAggregatorIndex, kAggregatorEndpointId, kRootEndpointId) == CHIP_NO_ERROR);
+
+    emberAfBeginDynamicEndpointBatch();
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kBridgedIndex, kBridgedEndpointId3, kAggregatorEndpointId) == CHIP_NO_ERROR);
+    emberAfCommitDynamicEndpointBatch();
+
+    // The endpoints are usable right away, but the inner commit does not report anything.
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kBridgedEndpointId3) != kEmberInvalidEndpointIndex);
+    NL_TEST_ASSERT(apSuite, GetReportCount() == reportCount);
+    NL_TEST_ASSERT(apSuite, gDataVersions[kRootIndex] == rootDataVersion);
+
+    DataVersion aggregatorDataVersion = gDataVersions[kAggregatorIndex];
+    DataVersion bridgedDataVersion    = gDataVersions[kBridgedIndex];
+
+    emberAfCommitDynamicEndpointBatch();
+
+    // Two new endpoints, and the PartsList of the root and of the aggregator. Without a batch, the PartsList of the root
+    // would have been reported once for each new endpoint.
+    NL_TEST_ASSERT(apSuite, GetReportCount() == reportCount + 4);
+    NL_TEST_ASSERT(apSuite, gDataVersions[kRootIndex] == static_cast<DataVersion>(rootDataVersion + 1));
+    NL_TEST_ASSERT(apSuite, gDataVersions[kAggregatorIndex] == static_cast<DataVersion>(aggregatorDataVersion + 1));
+    NL_TEST_ASSERT(apSuite, gDataVersions[kBridgedIndex] == bridgedDataVersion);
+
+    ClearTestEndpoints();
+}
+
+/*
+ * Endpoints that are disabled or cleared before the batch is committed are not reported, but the PartsList of their
+ * (still enabled) ancestors is.
+ */
+void TestNoReportsForRemovedEndpoints(nlTestSuite * apSuite, void * apContext)
+{
+    InitDataModelHandler();
+
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kRootIndex, kRootEndpointId, kInvalidEndpointId) == CHIP_NO_ERROR);
+
+    uint64_t reportCount        = GetReportCount();
+    DataVersion rootDataVersion = gDataVersions[kRootIndex];
+
+    emberAfBeginDynamicEndpointBatch();
+
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kAggregatorIndex, kAggregatorEndpointId, kRootEndpointId) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kBridgedIndex, kBridgedEndpointId3, kAggregatorEndpointId) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, emberAfEndpointEnableDisable(kBridgedEndpointId3, false));
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(kAggregatorIndex) == kAggregatorEndpointId);
+
+    emberAfCommitDynamicEndpointBatch();
+
+    // Only the PartsList of the root is left to report.
+    NL_TEST_ASSERT(apSuite, GetReportCount() == reportCount + 1);
+    NL_TEST_ASSERT(apSuite, gDataVersions[kRootIndex] == static_cast<DataVersion>(rootDataVersion + 1));
+
+    // emberAfClearDynamicEndpoint() skips disabled endpoints.
+    NL_TEST_ASSERT(apSuite, emberAfEndpointEnableDisable(kBridgedEndpointId3, true));
+    ClearTestEndpoints();
+}
+
+/*
+ * An endpoint index that is cleared and set again within a batch does not carry the pending reports of the endpoint
+ * it used to hold over to the new one.
+ */
+void TestIndexReuse(nlTestSuite * apSuite, void * apContext)
+{
+    InitDataModelHandler();
+
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kRootIndex, kRootEndpointId, kInvalidEndpointId) == CHIP_NO_ERROR);
+
+    uint64_t reportCount        = GetReportCount();
+    DataVersion rootDataVersion = gDataVersions[kRootIndex];
+
+    emberAfBeginDynamicEndpointBatch();
+
+    // The PartsList of the aggregator changes when its child comes and goes.
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kAggregatorIndex, kAggregatorEndpointId, kRootEndpointId) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kBridgedIndex, kBridgedEndpointId3, kAggregatorEndpointId) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(kBridgedIndex) == kBridgedEndpointId3);
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(kAggregatorIndex) == kAggregatorEndpointId);
+
+    // Reuse the index of the aggregator for an endpoint without children.
+    NL_TEST_ASSERT(apSuite, SetTestEndpoint(kAggregatorIndex, kBridgedEndpointId4, kRootEndpointId) == CHIP_NO_ERROR);
+
+    DataVersion bridgedDataVersion = gDataVersions[kAggregatorIndex];
+
+    emberAfCommitDynamicEndpointBatch();
+
+    // The new endpoint and the PartsList of the root, but not the PartsList of the aggregator.
+    NL_TEST_ASSERT(apSuite, GetReportCount() == reportCount + 2);
+    NL_TEST_ASSERT(apSuite, gDataVersions[kRootIndex] == static_cast<DataVersion>(rootDataVersion + 1));
+    NL_TEST_ASSERT(apSuite, gDataVersions[kAggregatorIndex] == bridgedDataVersion);
+
+    ClearTestEndpoints();
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestCoalescedPartsListReports", TestCoalescedPartsListReports),
+    NL_TEST_DEF("TestNoReportsForRemovedEndpoints", TestNoReportsForRemovedEndpoints),
+    NL_TEST_DEF("TestIndexReuse", TestIndexReuse),
+    NL_TEST_SENTINEL(),
+};
+
+nlTestSuite sSuite = {
+    "TestDynamicEndpointBatch",
+    &sTests[0],
+    TestContext::nlTestSetUpTestSuite,
+    TestContext::nlTestTearDownTestSuite,
+    TestContext::nlTestSetUp,
+    TestContext::nlTestTearDown,
+};
+
+} // namespace
+
+int TestDynamicEndpointBatchTests()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDynamicEndpointBatchTests)
@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/EncodedReportCache.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+using TestCache = reporting::EncodedReportCache<2, 16>;
+
+// Caches aLength bytes of aValue for aKey.
+void Insert(TestCache & cache, const TestCache::Key & aKey, uint8_t aValue, size_t aLength)
+{
+    uint8_t buffer[TestCache::kMaxFragmentSize];
+    memset(buffer, aValue, aLength);
+    cache.Insert(aKey, ByteSpan(buffer, aLength));
+}
+
+void TestLookupAndKeys(nlTestSuite * inSuite, void * inContext)
+{
+    TestCache cache;
+    ConcreteAttributePath path(1, 6, 0);
+    TestCache::Key key(path, 1, true, true);
+    ByteSpan fragment;
+
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(key, fragment));
+    Insert(cache, key, 0xAB, 5);
+
+    NL_TEST_ASSERT(inSuite, cache.Lookup(key, fragment));
+    NL_TEST_ASSERT(inSuite, fragment.size() == 5);
+    NL_TEST_ASSERT(inSuite, fragment.data()[0] == 0xAB && fragment.data()[4] == 0xAB);
+
+    // Any difference in what the encoding depends on is a different fragment.
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(TestCache::Key(ConcreteAttributePath(1, 6, 1), 1, true, true), fragment));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(TestCache::Key(ConcreteAttributePath(2, 6, 0), 1, true, true), fragment));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(TestCache::Key(path, 2, true, true), fragment));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(TestCache::Key(path, 1, false, true), fragment));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(TestCache::Key(path, 1, true, false), fragment));
+
+    ConcreteAttributePath expandedPath(1, 6, 0);
+    expandedPath.mExpanded = true;
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(TestCache::Key(expandedPath, 1, true, true), fragment));
+
+    // An empty fragment, e.g. for an expanded path the subject has no access to, is a valid fragment.
+    TestCache::Key deniedKey(expandedPath, 1, true, false);
+    cache.Insert(deniedKey, ByteSpan());
+    NL_TEST_ASSERT(inSuite, cache.Lookup(deniedKey, fragment));
+    NL_TEST_ASSERT(inSuite, fragment.empty());
+
+    cache.Invalidate();
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(key, fragment));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(deniedKey, fragment));
+}
+
+void TestEvictionAndStats(nlTestSuite * inSuite, void * inContext)
+{
+    TestCache cache;
+    TestCache::Key key1(ConcreteAttributePath(1, 6, 0), 1, true, true);
+    TestCache::Key key2(ConcreteAttributePath(1, 6, 1), 1, true, true);
+    TestCache::Key key3(ConcreteAttributePath(1, 6, 2), 1, true, true);
+    ByteSpan fragment;
+
+    Insert(cache, key1, 1, 1);
+    Insert(cache, key2, 2, 2);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(key1, fragment));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(key2, fragment));
+
+    // The oldest fragment makes room for the new one.
+    Insert(cache, key3, 3, 3);
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(key1, fragment));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(key2, fragment));
+    NL_TEST_ASSERT(inSuite, fragment.size() == 2 && fragment.data()[0] == 2);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(key3, fragment));
+    NL_TEST_ASSERT(inSuite, fragment.size() == 3 && fragment.data()[0] == 3);
+
+    // A path marked as too large takes an entry too, and its fragments are never found.
+    ConcreteAttributePath oversizedPath(1, 6, 3);
+    NL_TEST_ASSERT(inSuite, !cache.IsOversized(oversizedPath));
+    cache.MarkOversized(oversizedPath);
+    NL_TEST_ASSERT(inSuite, cache.IsOversized(oversizedPath));
+    NL_TEST_ASSERT(inSuite, !cache.IsOversized(ConcreteAttributePath(1, 6, 2)));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(key2, fragment));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(key3, fragment));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(TestCache::Key(oversizedPath, kUndefinedFabricIndex, false, false), fragment));
+
+    const TestCache::Stats & stats = cache.GetStats();
+    NL_TEST_ASSERT(inSuite, stats.mHits == 5);
+    NL_TEST_ASSERT(inSuite, stats.mMisses == 3);
+    NL_TEST_ASSERT(inSuite, stats.mInsertions == 3);
+    NL_TEST_ASSERT(inSuite, stats.mEvictions == 2);
+    NL_TEST_ASSERT(inSuite, stats.mUncacheable == 1);
+    NL_TEST_ASSERT(inSuite, stats.HitRatePercent() == 62);
+
+    cache.Invalidate();
+    NL_TEST_ASSERT(inSuite, !cache.IsOversized(oversizedPath));
+
+    cache.ResetStats();
+    NL_TEST_ASSERT(inSuite, cache.GetStats().mHits == 0);
+    NL_TEST_ASSERT(inSuite, cache.GetStats().HitRatePercent() == 0);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Fragments are looked up by their full key", TestLookupAndKeys),
+    NL_TEST_DEF("Oldest fragments are evicted first and counted", TestEvictionAndStats),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestEncodedReportCache()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Test for the encoded report cache",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestEncodedReportCache)
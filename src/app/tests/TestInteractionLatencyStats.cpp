@@ -0,0 +1,184 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/InteractionLatencyStats.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <system/SystemClock.h>
+
+#include <memory>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+using Operation = InteractionLatencyStats::Operation;
+
+constexpr ClusterId kOnOffCluster = 0x0006;
+constexpr ClusterId kLevelCluster = 0x0008;
+
+void TestBuckets(nlTestSuite * inSuite, void * inContext)
+{
+    // Every duration falls in a bucket whose upper bound is at most 1/kSubBucketCount above it.
+    size_t lastIndex = 0;
+    for (uint64_t durationUs = 0; durationUs < 100000; durationUs++)
+    {
+        size_t index = InteractionLatencyStats::BucketIndex(durationUs);
+        NL_TEST_ASSERT(inSuite, index == lastIndex || index == lastIndex + 1);
+        NL_TEST_ASSERT(inSuite, InteractionLatencyStats::BucketUpperBound(index) >= durationUs);
+        NL_TEST_ASSERT(inSuite,
+                       InteractionLatencyStats::BucketUpperBound(index) <=
+                           durationUs + durationUs / InteractionLatencyStats::kSubBucketCount);
+        lastIndex = index;
+    }
+
+    NL_TEST_ASSERT(inSuite, InteractionLatencyStats::BucketIndex(UINT32_MAX) == InteractionLatencyStats::kBucketCount - 1);
+    NL_TEST_ASSERT(inSuite, InteractionLatencyStats::BucketIndex(UINT64_MAX) == InteractionLatencyStats::kBucketCount - 1);
+}
+
+void TestRecord(nlTestSuite * inSuite, void * inContext)
+{
+    auto stats = std::make_unique<InteractionLatencyStats>();
+
+    // 90 fast reads of the OnOff cluster, and 10 slow ones.
+    for (uint32_t i = 0; i < 90; i++)
+    {
+        stats->Record(Operation::kAttributeRead, kOnOffCluster, System::Clock::Microseconds64(100), 10);
+    }
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        stats->Record(Operation::kAttributeRead, kOnOffCluster, System::Clock::Microseconds64(20000), 10);
+    }
+    stats->Record(Operation::kAttributeWrite, kOnOffCluster, System::Clock::Microseconds64(5), 0);
+
+    NL_TEST_ASSERT(inSuite, stats->GetHistogramCount() == 2);
+    NL_TEST_ASSERT(inSuite, stats->Find(Operation::kAttributeRead, kLevelCluster) == nullptr);
+
+    const InteractionLatencyStats::Histogram * reads = stats->Find(Operation::kAttributeRead, kOnOffCluster);
+    NL_TEST_ASSERT(inSuite, reads != nullptr);
+    VerifyOrReturn(reads != nullptr);
+    NL_TEST_ASSERT(inSuite, reads->mCount == 100);
+    NL_TEST_ASSERT(inSuite, reads->mMinUs == 100);
+    NL_TEST_ASSERT(inSuite, reads->mMaxUs == 20000);
+    NL_TEST_ASSERT(inSuite, reads->mTotalUs == 90 * 100 + 10 * 20000);
+    NL_TEST_ASSERT(inSuite, reads->mTotalBytes == 1000);
+
+    NL_TEST_ASSERT(inSuite, reads->GetPercentileUs(0) >= 100 && reads->GetPercentileUs(0) < 125);
+    NL_TEST_ASSERT(inSuite, reads->GetPercentileUs(50) >= 100 && reads->GetPercentileUs(50) < 125);
+    NL_TEST_ASSERT(inSuite, reads->GetPercentileUs(90) >= 100 && reads->GetPercentileUs(90) < 125);
+    NL_TEST_ASSERT(inSuite, reads->GetPercentileUs(91) == 20000);
+    NL_TEST_ASSERT(inSuite, reads->GetPercentileUs(100) == 20000);
+
+    stats->Reset();
+    NL_TEST_ASSERT(inSuite, stats->GetHistogramCount() == 0);
+    NL_TEST_ASSERT(inSuite, stats->Find(Operation::kAttributeRead, kOnOffCluster) == nullptr);
+}
+
+void TestCapacity(nlTestSuite * inSuite, void * inContext)
+{
+    auto stats = std::make_unique<InteractionLatencyStats>();
+
+    for (ClusterId cluster = 0; cluster < InteractionLatencyStats::kMaxHistogramCount; cluster++)
+    {
+        stats->Record(Operation::kCommand, cluster, System::Clock::Microseconds64(1), 0);
+    }
+    NL_TEST_ASSERT(inSuite, stats->GetDroppedCount() == 0);
+
+    // Tracked pairs are still recorded, new ones are dropped.
+    stats->Record(Operation::kCommand, 0, System::Clock::Microseconds64(1), 0);
+    stats->Record(Operation::kInvoke, kInvalidClusterId, System::Clock::Microseconds64(1), 0);
+    NL_TEST_ASSERT(inSuite, stats->GetHistogramCount() == InteractionLatencyStats::kMaxHistogramCount);
+    NL_TEST_ASSERT(inSuite, stats->Find(Operation::kCommand, 0)->mCount == 2);
+    NL_TEST_ASSERT(inSuite, stats->GetDroppedCount() == 1);
+}
+
+void TestScope(nlTestSuite * inSuite, void * inContext)
+{
+    auto stats = std::make_unique<InteractionLatencyStats>();
+
+    System::Clock::Internal::MockClock clock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&clock);
+
+    uint8_t buffer[32];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    NL_TEST_ASSERT(inSuite, writer.Put(TLV::AnonymousTag(), static_cast<uint8_t>(1)) == CHIP_NO_ERROR);
+
+    {
+        InteractionLatencyStats::Scope scope(*stats, Operation::kReport, kInvalidClusterId);
+        scope.TrackWriter(writer);
+        scope.AddBytes(5);
+        clock.AdvanceMonotonic(1500_ms64);
+        NL_TEST_ASSERT(inSuite, writer.Put(TLV::AnonymousTag(), static_cast<uint8_t>(2)) == CHIP_NO_ERROR);
+    }
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+
+    const InteractionLatencyStats::Histogram * reports = stats->Find(Operation::kReport, kInvalidClusterId);
+    NL_TEST_ASSERT(inSuite, reports != nullptr);
+    VerifyOrReturn(reports != nullptr);
+    NL_TEST_ASSERT(inSuite, reports->mCount == 1);
+    NL_TEST_ASSERT(inSuite, reports->mMaxUs == 1500000);
+    NL_TEST_ASSERT(inSuite, reports->mTotalBytes == 5 + 2);
+}
+
+void TestEventTrigger(nlTestSuite * inSuite, void * inContext)
+{
+    auto stats = std::make_unique<InteractionLatencyStats>();
+    InteractionLatencyStatsTestEventTriggerHandler handler(*stats);
+
+    stats->Record(Operation::kRead, kInvalidClusterId, System::Clock::Microseconds64(300), 40);
+    NL_TEST_ASSERT(inSuite,
+                   handler.HandleEventTrigger(InteractionLatencyStatsTestEventTriggerHandler::kLogStatsTrigger) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, stats->GetHistogramCount() == 1);
+
+    NL_TEST_ASSERT(inSuite,
+                   handler.HandleEventTrigger(InteractionLatencyStatsTestEventTriggerHandler::kResetStatsTrigger) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, stats->GetHistogramCount() == 0);
+
+    NL_TEST_ASSERT(inSuite, handler.HandleEventTrigger(0) == CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Durations map to log-linear buckets", TestBuckets),
+    NL_TEST_DEF("Durations are recorded per cluster and operation", TestRecord),
+    NL_TEST_DEF("New pairs are dropped once all histograms are used", TestCapacity),
+    NL_TEST_DEF("Scope records its duration and bytes", TestScope),
+    NL_TEST_DEF("Test event triggers log and reset the statistics", TestEventTrigger),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestInteractionLatencyStats()
+{
+    nlTestSuite theSuite = { "TestInteractionLatencyStats", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestInteractionLatencyStats)
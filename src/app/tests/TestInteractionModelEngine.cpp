@@ -49,6 +49,9 @@ class TestInteractionModelEngine
 public:
     static void TestAttributePathParamsPushRelease(nlTestSuite * apSuite, void * apContext);
     static void TestRemoveDuplicateConcreteAttribute(nlTestSuite * apSuite, void * apContext);
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+    static void TestRemoveDuplicateConcreteAttributeInArena(nlTestSuite * apSuite, void * apContext);
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     static void TestSubscriptionResumptionTimer(nlTestSuite * apSuite, void * apContext);
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
@@ -229,6 +232,60 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 }
 
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttributeInArena(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    err               = InteractionModelEngine::GetInstance()->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable(),
+                                                                    app::reporting::GetDefaultReportScheduler());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // clang-format off
+    const AttributePathParams paths[] = {
+        AttributePathParams(),
+        AttributePathParams(Test::kMockEndpoint3, kInvalidClusterId, kInvalidAttributeId),
+        AttributePathParams(kInvalidEndpointId, kInvalidClusterId, Test::MockAttributeId(3)),
+        AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), kInvalidAttributeId),
+        AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(1)),
+        AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(3)),
+        AttributePathParams(Test::kMockEndpoint2, Test::MockClusterId(2), Test::MockAttributeId(2)),
+        AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(10)),
+    };
+    // clang-format on
+
+    // The sorted lookup must remove exactly the paths that the pairwise comparison removes, for any mix of paths.
+    for (uint32_t subset = 0; subset < (1u << ArraySize(paths)); subset++)
+    {
+        PathListArena arena;
+        SingleLinkedListNode<AttributePathParams> * arenaList = nullptr;
+        SingleLinkedListNode<AttributePathParams> * poolList  = nullptr;
+        for (size_t i = 0; i < ArraySize(paths); i++)
+        {
+            if (subset & (1u << i))
+            {
+                AttributePathParams path = paths[i];
+                NL_TEST_ASSERT(apSuite, arena.PushFront(arenaList, path) == CHIP_NO_ERROR);
+                InteractionModelEngine::GetInstance()->PushFrontAttributePathList(poolList, path);
+            }
+        }
+
+        size_t blocks = arena.GetBlockCount();
+        InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(arenaList, arena);
+        InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(poolList);
+
+        // The scratch memory of the lookup was given back to the arena.
+        NL_TEST_ASSERT(apSuite, arena.GetBlockCount() == blocks);
+        NL_TEST_ASSERT(apSuite, GetAttributePathListLength(arenaList) == GetAttributePathListLength(poolList));
+        for (auto *a = arenaList, *b = poolList; a != nullptr && b != nullptr; a = a->mpNext, b = b->mpNext)
+        {
+            NL_TEST_ASSERT(apSuite, a->mValue == b->mValue);
+        }
+        InteractionModelEngine::GetInstance()->ReleaseAttributePathList(poolList);
+    }
+}
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
+
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 void TestInteractionModelEngine::TestSubscriptionResumptionTimer(nlTestSuite * apSuite, void * apContext)
 {
@@ -271,6 +328,9 @@ const nlTest sTests[] =
         {
                 NL_TEST_DEF("TestAttributePathParamsPushRelease", chip::app::TestInteractionModelEngine::TestAttributePathParamsPushRelease),
                 NL_TEST_DEF("TestRemoveDuplicateConcreteAttribute", chip::app::TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute),
+#if CHIP_CONFIG_IM_PATH_LIST_ARENA
+                NL_TEST_DEF("TestRemoveDuplicateConcreteAttributeInArena", chip::app::TestInteractionModelEngine::TestRemoveDuplicateConcreteAttributeInArena),
+#endif // CHIP_CONFIG_IM_PATH_LIST_ARENA
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
                 NL_TEST_DEF("TestSubscriptionResumptionTimer", chip::app::TestInteractionModelEngine::TestSubscriptionResumptionTimer),
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
@@ -0,0 +1,168 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/DataVersionFilter.h>
+#include <app/PathListArena.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+void TestPushFront(nlTestSuite * inSuite, void * inContext)
+{
+    PathListArena arena;
+    SingleLinkedListNode<AttributePathParams> * list = nullptr;
+    NL_TEST_ASSERT(inSuite, arena.GetBlockCount() == 0);
+
+    for (AttributeId id = 0; id < 3; id++)
+    {
+        NL_TEST_ASSERT(inSuite, arena.PushFront(list, AttributePathParams(1, 6, id)) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, arena.GetBlockCount() == 1);
+
+    // Lists are built from the front, and nodes pushed one after the other are next to each other.
+    AttributeId expected = 2;
+    for (auto * node = list; node != nullptr; node = node->mpNext)
+    {
+        NL_TEST_ASSERT(inSuite, node->mValue.mAttributeId == expected);
+        if (node->mpNext != nullptr)
+        {
+            NL_TEST_ASSERT(inSuite, node->mpNext + 1 == node);
+        }
+        expected--;
+    }
+
+    // Lists of different types share the arena.
+    SingleLinkedListNode<DataVersionFilter> * filters = nullptr;
+    NL_TEST_ASSERT(inSuite, arena.PushFront(filters, DataVersionFilter(1, 6, 42)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, filters != nullptr && filters->mpNext == nullptr);
+    NL_TEST_ASSERT(inSuite, filters->mValue.mDataVersion.Value() == 42);
+    NL_TEST_ASSERT(inSuite, list->mValue.mAttributeId == 2);
+
+    arena.Release();
+    NL_TEST_ASSERT(inSuite, arena.GetBlockCount() == 0);
+}
+
+void TestGrowth(nlTestSuite * inSuite, void * inContext)
+{
+    PathListArena arena;
+    SingleLinkedListNode<AttributePathParams> * list = nullptr;
+
+    constexpr size_t kNodeCount = CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE / sizeof(SingleLinkedListNode<AttributePathParams>) * 3;
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, arena.PushFront(list, AttributePathParams(1, 6, static_cast<AttributeId>(i))) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, arena.GetBlockCount() >= 3);
+
+    size_t count = 0;
+    for (auto * node = list; node != nullptr; node = node->mpNext)
+    {
+        NL_TEST_ASSERT(inSuite, node->mValue.mAttributeId == kNodeCount - 1 - count);
+        count++;
+    }
+    NL_TEST_ASSERT(inSuite, count == kNodeCount);
+
+    // Allocations larger than a block get a block of their own.
+    size_t blocks    = arena.GetBlockCount();
+    uint32_t * array = arena.AllocateArray<uint32_t>(CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE);
+    NL_TEST_ASSERT(inSuite, array != nullptr);
+    NL_TEST_ASSERT(inSuite, arena.GetBlockCount() == blocks + 1);
+    array[CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE - 1] = 1;
+
+    NL_TEST_ASSERT(inSuite, arena.AllocateArray<uint64_t>(SIZE_MAX / 4) == nullptr);
+}
+
+void TestCheckpoint(nlTestSuite * inSuite, void * inContext)
+{
+    PathListArena arena;
+    SingleLinkedListNode<AttributePathParams> * list = nullptr;
+
+    // A checkpoint of an empty arena rewinds to an empty arena.
+    PathListArena::Checkpoint empty = arena.GetCheckpoint();
+    NL_TEST_ASSERT(inSuite, arena.PushFront(list, AttributePathParams(1, 6, 0)) == CHIP_NO_ERROR);
+    arena.Rewind(empty);
+    NL_TEST_ASSERT(inSuite, arena.GetBlockCount() == 0);
+
+    list = nullptr;
+    NL_TEST_ASSERT(inSuite, arena.PushFront(list, AttributePathParams(1, 6, 0)) == CHIP_NO_ERROR);
+    PathListArena::Checkpoint checkpoint = arena.GetCheckpoint();
+
+    // Temporary allocations, spanning several blocks, are freed by Rewind() without touching the list.
+    for (int i = 0; i < 4; i++)
+    {
+        NL_TEST_ASSERT(inSuite, arena.AllocateArray<uint8_t>(CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE / 2) != nullptr);
+    }
+    NL_TEST_ASSERT(inSuite, arena.GetBlockCount() > 1);
+    arena.Rewind(checkpoint);
+    NL_TEST_ASSERT(inSuite, arena.GetBlockCount() == 1);
+    NL_TEST_ASSERT(inSuite, list->mValue.mAttributeId == 0);
+
+    // The rewound space is used again.
+    NL_TEST_ASSERT(inSuite, arena.PushFront(list, AttributePathParams(1, 6, 1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, list->mpNext + 1 == list);
+    NL_TEST_ASSERT(inSuite, arena.GetBlockCount() == 1);
+}
+
+int TestSetup(void * inContext)
+{
+    VerifyOrReturnError(CHIP_NO_ERROR == chip::Platform::MemoryInit(), FAILURE);
+    return SUCCESS;
+}
+
+int TestTeardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Nodes are pushed to the front, next to each other", TestPushFront),
+    NL_TEST_DEF("The arena grows one block at a time", TestGrowth),
+    NL_TEST_DEF("Rewind frees what was allocated after a checkpoint", TestCheckpoint),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestPathListArena()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Test for the path list arena",
+        &sTests[0],
+        TestSetup,
+        TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPathListArena)
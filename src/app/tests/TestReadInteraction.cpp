@@ -74,6 +74,10 @@ static chip::System::Clock::Internal::MockClock gMockClock;
 static chip::System::Clock::ClockBase * gRealClock;
 static chip::app::reporting::ReportSchedulerImpl * gReportScheduler;
 static bool sUsingSubSync = false;
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+// Number of attribute reads made with the outcome of an access check already made by the reporting engine.
+static uint32_t sNumReadsWithAccessOutcome = 0;
+#endif
 
 class TestContext : public chip::Test::AppContext
 {
@@ -210,6 +214,7 @@ public:
         if (status.mStatus == chip::Protocols::InteractionModel::Status::Success)
         {
             mReceivedAttributePaths.push_back(aPath);
+            mLastDataVersion = aPath.mDataVersion;
             mNumAttributeResponse++;
             mGotReport = true;
 
@@ -271,6 +276,7 @@ public:
     chip::app::StatusIB mLastStatusReceived;
     CHIP_ERROR mError = CHIP_NO_ERROR;
     std::vector<chip::app::ConcreteAttributePath> mReceivedAttributePaths;
+    chip::Optional<chip::DataVersion> mLastDataVersion;
 };
 
 //
@@ -303,8 +309,15 @@ namespace app {
 
 CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                                  const ConcreteReadAttributePath & aPath, AttributeReportIBs::Builder & aAttributeReports,
-                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState)
+                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState, Optional<bool> aAccessAllowed)
 {
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    if (aAccessAllowed.HasValue())
+    {
+        sNumReadsWithAccessOutcome++;
+    }
+#endif
+
     if (aPath.mClusterId >= Test::kMockEndpointMin)
     {
         return Test::ReadSingleMockClusterData(aSubjectDescriptor.fabricIndex, aPath, aAttributeReports, apEncoderState);
@@ -388,6 +401,12 @@ public:
     static void TestSubscribeWildcard(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribePartialOverlap(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeSetDirtyFullyOverlap(nlTestSuite * apSuite, void * apContext);
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    static void TestSubscribeSharesEncodedReports(nlTestSuite * apSuite, void * apContext);
+#endif
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+    static void TestSubscribeOverdueReportsFirst(nlTestSuite * apSuite, void * apContext);
+#endif
     static void TestSubscribeEarlyShutdown(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeInvalidAttributePathRoundtrip(nlTestSuite * apSuite, void * apContext);
     static void TestReadInvalidAttributePathRoundtrip(nlTestSuite * apSuite, void * apContext);
@@ -2891,6 +2910,199 @@ void TestReadInteraction::TestSubscribeSetDirtyFullyOverlap(nlTestSuite * apSuit
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+// Two subscriptions to (E2, C3, A1): on each SetDirty, the attribute is encoded for the first read handler and copied from the
+// report cache for the second one, and SetDirty drops what was cached before. The encoding reuses the access check of the lookup.
+void TestReadInteraction::TestSubscribeSharesEncodedReports(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate1;
+    MockInteractionModelApp delegate2;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable(), gReportScheduler);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = Test::kMockEndpoint2;
+    attributePathParams[0].mClusterId   = Test::MockClusterId(3);
+    attributePathParams[0].mAttributeId = Test::MockAttributeId(1);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 0;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 10;
+    readPrepareParams.mKeepSubscriptions           = true;
+
+    {
+        app::ReadClient readClient1(engine, &ctx.GetExchangeManager(), delegate1,
+                                    chip::app::ReadClient::InteractionType::Subscribe);
+        app::ReadClient readClient2(engine, &ctx.GetExchangeManager(), delegate2,
+                                    chip::app::ReadClient::InteractionType::Subscribe);
+
+        err = readClient1.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = readClient2.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 2);
+        NL_TEST_ASSERT(apSuite, delegate1.mNumAttributeResponse == 1);
+        NL_TEST_ASSERT(apSuite, delegate2.mNumAttributeResponse == 1);
+
+        AttributePathParams dirtyPath;
+        dirtyPath.mEndpointId  = Test::kMockEndpoint2;
+        dirtyPath.mClusterId   = Test::MockClusterId(3);
+        dirtyPath.mAttributeId = Test::MockAttributeId(1);
+
+        for (uint32_t round = 1; round <= 2; round++)
+        {
+            engine->GetReportingEngine().ResetReportCacheStats();
+            sNumReadsWithAccessOutcome      = 0;
+            delegate1.mNumAttributeResponse = 0;
+            delegate2.mNumAttributeResponse = 0;
+
+            // The new version is only seen by both subscribers if the fragment cached by the previous round was dropped.
+            Test::BumpVersion();
+            err = engine->GetReportingEngine().SetDirty(dirtyPath);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+            ctx.DrainAndServiceIO();
+
+            NL_TEST_ASSERT(apSuite, delegate1.mNumAttributeResponse == 1);
+            NL_TEST_ASSERT(apSuite, delegate2.mNumAttributeResponse == 1);
+            NL_TEST_ASSERT(apSuite, delegate1.mLastDataVersion == MakeOptional(Test::GetVersion()));
+            NL_TEST_ASSERT(apSuite, delegate2.mLastDataVersion == MakeOptional(Test::GetVersion()));
+
+            const auto & stats = engine->GetReportingEngine().GetReportCacheStats();
+            NL_TEST_ASSERT(apSuite, stats.mMisses == 1);
+            NL_TEST_ASSERT(apSuite, stats.mInsertions == 1);
+            NL_TEST_ASSERT(apSuite, stats.mHits == 1);
+            NL_TEST_ASSERT(apSuite, stats.mUncacheable == 0);
+
+            // The attribute was only encoded on the miss, with the access check made before looking it up.
+            NL_TEST_ASSERT(apSuite, sNumReadsWithAccessOutcome == 1);
+        }
+    }
+
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+// One subscription to (E2, C3, A1) with a long max interval and one to (E3, C2, A1) with a 1s max interval. Once the second one
+// reaches its max interval and the first one is dirty, the engine, with room for a single report in flight, sends the overdue
+// keepalive first and the dirty report on the next run.
+void TestReadInteraction::TestSubscribeOverdueReportsFirst(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp dirtyDelegate;
+    MockInteractionModelApp keepAliveDelegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable(), reporting::GetPriorityReportScheduler());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reporting::Engine & reportingEngine = engine->GetReportingEngine();
+
+    chip::app::AttributePathParams dirtyPathParams[1];
+    dirtyPathParams[0].mEndpointId  = Test::kMockEndpoint2;
+    dirtyPathParams[0].mClusterId   = Test::MockClusterId(3);
+    dirtyPathParams[0].mAttributeId = Test::MockAttributeId(1);
+
+    chip::app::AttributePathParams keepAlivePathParams[1];
+    keepAlivePathParams[0].mEndpointId  = Test::kMockEndpoint3;
+    keepAlivePathParams[0].mClusterId   = Test::MockClusterId(2);
+    keepAlivePathParams[0].mAttributeId = Test::MockAttributeId(1);
+
+    ReadPrepareParams dirtyPrepareParams(ctx.GetSessionBobToAlice());
+    dirtyPrepareParams.mpAttributePathParamsList    = dirtyPathParams;
+    dirtyPrepareParams.mAttributePathParamsListSize = 1;
+    dirtyPrepareParams.mMinIntervalFloorSeconds     = 0;
+    dirtyPrepareParams.mMaxIntervalCeilingSeconds   = 60;
+    dirtyPrepareParams.mKeepSubscriptions           = true;
+
+    ReadPrepareParams keepAlivePrepareParams(ctx.GetSessionBobToAlice());
+    keepAlivePrepareParams.mpAttributePathParamsList    = keepAlivePathParams;
+    keepAlivePrepareParams.mAttributePathParamsListSize = 1;
+    keepAlivePrepareParams.mMinIntervalFloorSeconds     = 0;
+    keepAlivePrepareParams.mMaxIntervalCeilingSeconds   = 1;
+    keepAlivePrepareParams.mKeepSubscriptions           = true;
+
+    {
+        app::ReadClient dirtyClient(engine, &ctx.GetExchangeManager(), dirtyDelegate,
+                                    chip::app::ReadClient::InteractionType::Subscribe);
+        app::ReadClient keepAliveClient(engine, &ctx.GetExchangeManager(), keepAliveDelegate,
+                                        chip::app::ReadClient::InteractionType::Subscribe);
+
+        err = dirtyClient.SendRequest(dirtyPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = keepAliveClient.SendRequest(keepAlivePrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 2);
+
+        ReadHandler * dirtyHandler     = nullptr;
+        ReadHandler * keepAliveHandler = nullptr;
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            ReadHandler * readHandler = engine->ActiveHandlerAt(i);
+            uint16_t minInterval, maxInterval;
+            readHandler->GetReportingIntervals(minInterval, maxInterval);
+            (maxInterval == 1 ? keepAliveHandler : dirtyHandler) = readHandler;
+        }
+        NL_TEST_ASSERT(apSuite, dirtyHandler != nullptr && keepAliveHandler != nullptr);
+
+        gMockClock.AdvanceMonotonic(System::Clock::Seconds16(1));
+
+        AttributePathParams dirtyPath;
+        dirtyPath.mEndpointId  = Test::kMockEndpoint2;
+        dirtyPath.mClusterId   = Test::MockClusterId(3);
+        dirtyPath.mAttributeId = Test::MockAttributeId(1);
+        err                    = reportingEngine.SetDirty(dirtyPath);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        dirtyDelegate.mNumAttributeResponse     = 0;
+        keepAliveDelegate.mNumAttributeResponse = 0;
+
+        // Leave room for a single report in flight.
+        reportingEngine.mNumReportsInFlight = CHIP_IM_MAX_REPORTS_IN_FLIGHT - 1;
+        reportingEngine.Run();
+
+        NL_TEST_ASSERT(apSuite, keepAliveHandler->IsAwaitingReportResponse());
+        NL_TEST_ASSERT(apSuite, !dirtyHandler->IsAwaitingReportResponse());
+        NL_TEST_ASSERT(apSuite, dirtyHandler->IsDirty());
+
+        // Only the keepalive report is actually in flight.
+        reportingEngine.mNumReportsInFlight = 1;
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, dirtyDelegate.mNumAttributeResponse == 1);
+        NL_TEST_ASSERT(apSuite, !dirtyHandler->IsDirty());
+        NL_TEST_ASSERT(apSuite, reportingEngine.GetNumReportsInFlight() == 0);
+    }
+
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+#endif // CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+
 // Verify that subscription can be shut down just after receiving SUBSCRIBE RESPONSE,
 // before receiving any subsequent REPORT DATA.
 void TestReadInteraction::TestSubscribeEarlyShutdown(nlTestSuite * apSuite, void * apContext)
@@ -5126,6 +5338,12 @@ const nlTest sTests[] = {
     NL_TEST_DEF("TestSubscribeWildcard", chip::app::TestReadInteraction::TestSubscribeWildcard),
     NL_TEST_DEF("TestSubscribePartialOverlap", chip::app::TestReadInteraction::TestSubscribePartialOverlap),
     NL_TEST_DEF("TestSubscribeSetDirtyFullyOverlap", chip::app::TestReadInteraction::TestSubscribeSetDirtyFullyOverlap),
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    NL_TEST_DEF("TestSubscribeSharesEncodedReports", chip::app::TestReadInteraction::TestSubscribeSharesEncodedReports),
+#endif
+#if CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+    NL_TEST_DEF("TestSubscribeOverdueReportsFirst", chip::app::TestReadInteraction::TestSubscribeOverdueReportsFirst),
+#endif
     NL_TEST_DEF("TestSubscribeEarlyShutdown", chip::app::TestReadInteraction::TestSubscribeEarlyShutdown),
     NL_TEST_DEF("TestSubscribeInvalidAttributePathRoundtrip",
                 chip::app::TestReadInteraction::TestSubscribeInvalidAttributePathRoundtrip),
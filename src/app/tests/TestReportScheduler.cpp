@@ -17,6 +17,7 @@
  */
 
 #include <app/InteractionModelEngine.h>
+#include <app/reporting/PriorityReportSchedulerImpl.h>
 #include <app/reporting/ReportSchedulerImpl.h>
 #include <app/reporting/SynchronizedReportSchedulerImpl.h>
 #include <app/tests/AppTestContext.h>
@@ -217,6 +218,9 @@ ReportSchedulerImpl sScheduler(&sTestTimerDelegate);
 TestTimerSynchronizedDelegate sTestTimerSynchronizedDelegate;
 SynchronizedReportSchedulerImpl syncScheduler(&sTestTimerSynchronizedDelegate);
 
+TestTimerDelegate sTestPriorityTimerDelegate;
+PriorityReportSchedulerImpl sPriorityScheduler(&sTestPriorityTimerDelegate);
+
 class TestReportScheduler
 {
 public:
@@ -798,6 +802,117 @@ public:
         exchangeCtx->Close();
         NL_TEST_ASSERT(aSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
     }
+
+    static void MarkDirty(ReadHandler * readHandler, ReportScheduler * scheduler, uint64_t generation)
+    {
+        readHandler->mDirtyGeneration = generation;
+        scheduler->OnBecameReportable(readHandler);
+    }
+
+    static void MockReportSent(ReadHandler * readHandler, ReportScheduler * scheduler)
+    {
+        readHandler->mPreviousReportsBeginGeneration = readHandler->mDirtyGeneration;
+        readHandler->ClearForceDirtyFlag();
+        scheduler->OnSubscriptionReportSent(readHandler);
+    }
+
+    static void TestPrioritySchedulerOrdering(nlTestSuite * aSuite, void * aContext)
+    {
+        TestContext & ctx = *static_cast<TestContext *>(aContext);
+        NullReadHandlerCallback nullCallback;
+        Messaging::ExchangeContext * exchangeCtx1 = ctx.NewExchangeToAlice(nullptr, false);
+        Messaging::ExchangeContext * exchangeCtx2 = ctx.NewExchangeToBob(nullptr, false);
+        const FabricIndex fabric1                 = ctx.GetBobFabricIndex();
+        const FabricIndex fabric2                 = ctx.GetAliceFabricIndex();
+
+        ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+        sTestPriorityTimerDelegate.SetMockSystemTimestamp(Milliseconds64(0));
+        sPriorityScheduler.RefillFabricCredits();
+
+        // Dirty handler whose min interval expires last
+        ReadHandler * lateDirtyHandler =
+            readHandlerPool.CreateObject(nullCallback, exchangeCtx1, ReadHandler::InteractionType::Subscribe, &sPriorityScheduler);
+        NL_TEST_ASSERT(aSuite,
+                       CHIP_NO_ERROR == MockReadHandlerSubscriptionTransaction(lateDirtyHandler, &sPriorityScheduler, 2, 10));
+        // Clean handler that will reach its max interval
+        ReadHandler * keepAliveHandler =
+            readHandlerPool.CreateObject(nullCallback, exchangeCtx1, ReadHandler::InteractionType::Subscribe, &sPriorityScheduler);
+        NL_TEST_ASSERT(aSuite,
+                       CHIP_NO_ERROR == MockReadHandlerSubscriptionTransaction(keepAliveHandler, &sPriorityScheduler, 0, 3));
+        // Dirty handler whose min interval expires first
+        ReadHandler * earlyDirtyHandler =
+            readHandlerPool.CreateObject(nullCallback, exchangeCtx1, ReadHandler::InteractionType::Subscribe, &sPriorityScheduler);
+        NL_TEST_ASSERT(aSuite,
+                       CHIP_NO_ERROR == MockReadHandlerSubscriptionTransaction(earlyDirtyHandler, &sPriorityScheduler, 1, 10));
+        // Handler with an urgent event to report
+        ReadHandler * urgentHandler =
+            readHandlerPool.CreateObject(nullCallback, exchangeCtx1, ReadHandler::InteractionType::Subscribe, &sPriorityScheduler);
+        NL_TEST_ASSERT(aSuite, CHIP_NO_ERROR == MockReadHandlerSubscriptionTransaction(urgentHandler, &sPriorityScheduler, 0, 10));
+        // Dirty handler on another fabric
+        ReadHandler * otherFabricHandler =
+            readHandlerPool.CreateObject(nullCallback, exchangeCtx2, ReadHandler::InteractionType::Subscribe, &sPriorityScheduler);
+        NL_TEST_ASSERT(aSuite,
+                       CHIP_NO_ERROR == MockReadHandlerSubscriptionTransaction(otherFabricHandler, &sPriorityScheduler, 2, 10));
+
+        MarkDirty(lateDirtyHandler, &sPriorityScheduler, 1);
+        MarkDirty(earlyDirtyHandler, &sPriorityScheduler, 1);
+        MarkDirty(otherFabricHandler, &sPriorityScheduler, 1);
+        urgentHandler->ForceDirtyState();
+        sTestPriorityTimerDelegate.IncrementMockTimestamp(Milliseconds64(3000));
+
+        ReadHandler * handlers[] = { keepAliveHandler, lateDirtyHandler, otherFabricHandler, earlyDirtyHandler, urgentHandler };
+        for (auto * handler : handlers)
+        {
+            NL_TEST_ASSERT(aSuite, sPriorityScheduler.IsReportableNow(handler));
+        }
+
+        // Urgent first, then handlers at their max interval, then dirty handlers by min interval expiry, with handlers that were
+        // registered first ahead on ties.
+        sPriorityScheduler.OrderReportableHandlers(Span<ReadHandler *>(handlers));
+        NL_TEST_ASSERT(aSuite, handlers[0] == urgentHandler);
+        NL_TEST_ASSERT(aSuite, handlers[1] == keepAliveHandler);
+        NL_TEST_ASSERT(aSuite, handlers[2] == earlyDirtyHandler);
+        NL_TEST_ASSERT(aSuite, handlers[3] == lateDirtyHandler);
+        NL_TEST_ASSERT(aSuite, handlers[4] == otherFabricHandler);
+
+        // Once the first fabric has used up its credit, the other fabric is served first, except for urgent events.
+        for (uint8_t i = 0; i < CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS; i++)
+        {
+            MockReportSent(earlyDirtyHandler, &sPriorityScheduler);
+        }
+        NL_TEST_ASSERT(aSuite, sPriorityScheduler.GetFabricCredits(fabric1) == 0);
+        NL_TEST_ASSERT(aSuite, sPriorityScheduler.GetFabricCredits(fabric2) == CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS);
+
+        ReadHandler * reordered[] = { lateDirtyHandler, otherFabricHandler, urgentHandler };
+        sPriorityScheduler.OrderReportableHandlers(Span<ReadHandler *>(reordered));
+        NL_TEST_ASSERT(aSuite, reordered[0] == urgentHandler);
+        NL_TEST_ASSERT(aSuite, reordered[1] == otherFabricHandler);
+        NL_TEST_ASSERT(aSuite, reordered[2] == lateDirtyHandler);
+
+        // When no reportable handler has credit left, every fabric gets its credit back.
+        ReadHandler * withoutCredit[] = { lateDirtyHandler };
+        sPriorityScheduler.OrderReportableHandlers(Span<ReadHandler *>(withoutCredit));
+        NL_TEST_ASSERT(aSuite, sPriorityScheduler.GetFabricCredits(fabric1) == CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS);
+
+        // Handlers at their max interval stay ahead of dirty handlers whatever their credit, so that a steady flow of dirty
+        // reports cannot starve keepalives.
+        for (uint8_t i = 0; i < CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS; i++)
+        {
+            MockReportSent(keepAliveHandler, &sPriorityScheduler);
+        }
+        sTestPriorityTimerDelegate.IncrementMockTimestamp(Milliseconds64(3000));
+        ReadHandler * overdue[] = { otherFabricHandler, keepAliveHandler };
+        sPriorityScheduler.OrderReportableHandlers(Span<ReadHandler *>(overdue));
+        NL_TEST_ASSERT(aSuite, sPriorityScheduler.GetFabricCredits(fabric1) == 0);
+        NL_TEST_ASSERT(aSuite, overdue[0] == keepAliveHandler);
+        NL_TEST_ASSERT(aSuite, overdue[1] == otherFabricHandler);
+
+        sPriorityScheduler.UnregisterAllHandlers();
+        readHandlerPool.ReleaseAll();
+        exchangeCtx1->Close();
+        exchangeCtx2->Close();
+        NL_TEST_ASSERT(aSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+    }
 };
 
 } // namespace reporting
@@ -815,6 +930,7 @@ static nlTest sTests[] = {
     NL_TEST_DEF("TestReportTiming", chip::app::reporting::TestReportScheduler::TestReportTiming),
     NL_TEST_DEF("TestObserverCallbacks", chip::app::reporting::TestReportScheduler::TestObserverCallbacks),
     NL_TEST_DEF("TestSynchronizedScheduler", chip::app::reporting::TestReportScheduler::TestSynchronizedScheduler),
+    NL_TEST_DEF("TestPrioritySchedulerOrdering", chip::app::reporting::TestReportScheduler::TestPrioritySchedulerOrdering),
     NL_TEST_SENTINEL(),
 };
 
@@ -0,0 +1,244 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/WriteBehindAttributePersistenceProvider.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <system/SystemClock.h>
+
+#include <map>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+const ConcreteAttributePath kLevelPath(1, 0x0008, 0x0000);
+const ConcreteAttributePath kOnOffPath(1, 0x0006, 0x0000);
+
+constexpr System::Clock::Milliseconds32 kIdleDelay = 1000_ms32;
+constexpr System::Clock::Milliseconds32 kMaxDelay  = 5000_ms32;
+
+// Records the values written to it, and the batches they were written in.
+class RecordingPersister : public AttributePersistenceProvider, public WriteBehindAttributePersistenceProvider::StorageBatch
+{
+public:
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override
+    {
+        mValues[aPath].assign(aValue.begin(), aValue.end());
+        mWriteCount++;
+        mWritesOutsideBatch += mInBatch ? 0 : 1;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override
+    {
+        auto it = mValues.find(aPath);
+        VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        return CopySpanToMutableSpan(ByteSpan(it->second.data(), it->second.size()), aValue);
+    }
+
+    void BeginBatch() override { mInBatch = true; }
+    CHIP_ERROR EndBatch() override
+    {
+        mInBatch = false;
+        mBatchCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    bool HasValue(const ConcreteAttributePath & aPath, uint8_t aValue)
+    {
+        auto it = mValues.find(aPath);
+        return it != mValues.end() && it->second.size() == 1 && it->second[0] == aValue;
+    }
+
+    std::map<ConcreteAttributePath, std::vector<uint8_t>> mValues;
+    size_t mWriteCount         = 0;
+    size_t mWritesOutsideBatch = 0;
+    size_t mBatchCount         = 0;
+    bool mInBatch              = false;
+};
+
+class TestContext : public chip::Test::AppContext
+{
+public:
+    CHIP_ERROR SetUpTestSuite() override
+    {
+        ReturnErrorOnFailure(chip::Test::AppContext::SetUpTestSuite());
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+        return CHIP_NO_ERROR;
+    }
+
+    void TearDownTestSuite() override
+    {
+        System::Clock::Internal::SetSystemClockForTesting(mRealClock);
+        chip::Test::AppContext::TearDownTestSuite();
+    }
+
+    void AdvanceClockAndRunEventLoop(System::Clock::Milliseconds64 aTime)
+    {
+        mMockClock.AdvanceMonotonic(aTime);
+        GetIOContext().DriveIO();
+    }
+
+    System::Clock::Internal::MockClock mMockClock;
+
+private:
+    System::Clock::ClockBase * mRealClock;
+};
+
+CHIP_ERROR WriteByte(AttributePersistenceProvider & aProvider, const ConcreteAttributePath & aPath, uint8_t aValue)
+{
+    return aProvider.WriteValue(aPath, ByteSpan(&aValue, 1));
+}
+
+void TestCoalescing(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(inContext);
+    RecordingPersister persister;
+    WriteBehindAttributePersistenceProvider provider(persister, kIdleDelay, kMaxDelay, &persister);
+    NL_TEST_ASSERT(inSuite, provider.Init(&ctx.GetSystemLayer()) == CHIP_NO_ERROR);
+
+    // A level sweep, one step every 100ms, is kept in memory.
+    for (uint8_t level = 0; level < 20; level++)
+    {
+        NL_TEST_ASSERT(inSuite, WriteByte(provider, kLevelPath, level) == CHIP_NO_ERROR);
+        ctx.AdvanceClockAndRunEventLoop(100_ms64);
+    }
+    NL_TEST_ASSERT(inSuite, WriteByte(provider, kOnOffPath, 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, persister.mWriteCount == 0);
+    NL_TEST_ASSERT(inSuite, provider.GetPendingCount() == 2);
+
+    // The pending value is read back.
+    uint8_t buffer[4];
+    MutableByteSpan value(buffer);
+    NL_TEST_ASSERT(inSuite, provider.ReadValue(kLevelPath, nullptr, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, value.size() == 1 && value[0] == 19);
+
+    // Once idle, only the last value of each attribute is written, in one batch.
+    ctx.AdvanceClockAndRunEventLoop(kIdleDelay - 1_ms32);
+    NL_TEST_ASSERT(inSuite, persister.mWriteCount == 0);
+    ctx.AdvanceClockAndRunEventLoop(1_ms64);
+    NL_TEST_ASSERT(inSuite, persister.mWriteCount == 2);
+    NL_TEST_ASSERT(inSuite, persister.mBatchCount == 1);
+    NL_TEST_ASSERT(inSuite, persister.mWritesOutsideBatch == 0);
+    NL_TEST_ASSERT(inSuite, persister.HasValue(kLevelPath, 19));
+    NL_TEST_ASSERT(inSuite, persister.HasValue(kOnOffPath, 1));
+    NL_TEST_ASSERT(inSuite, provider.GetPendingCount() == 0);
+
+    provider.Shutdown();
+    NL_TEST_ASSERT(inSuite, persister.mBatchCount == 1);
+}
+
+void TestMaxDelay(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(inContext);
+    RecordingPersister persister;
+    WriteBehindAttributePersistenceProvider provider(persister, kIdleDelay, kMaxDelay, &persister);
+    NL_TEST_ASSERT(inSuite, provider.Init(&ctx.GetSystemLayer()) == CHIP_NO_ERROR);
+
+    // An attribute that never stops changing is still written once the oldest change has waited for the maximum delay.
+    uint8_t level = 0;
+    for (System::Clock::Milliseconds64 elapsed = 0_ms64; elapsed < kMaxDelay; elapsed += 500_ms64)
+    {
+        NL_TEST_ASSERT(inSuite, persister.mWriteCount == 0);
+        NL_TEST_ASSERT(inSuite, WriteByte(provider, kLevelPath, level++) == CHIP_NO_ERROR);
+        ctx.AdvanceClockAndRunEventLoop(500_ms64);
+    }
+    NL_TEST_ASSERT(inSuite, persister.mWriteCount == 1);
+    NL_TEST_ASSERT(inSuite, persister.HasValue(kLevelPath, static_cast<uint8_t>(level - 1)));
+
+    // The bound starts over with the next change.
+    NL_TEST_ASSERT(inSuite, WriteByte(provider, kLevelPath, level) == CHIP_NO_ERROR);
+    ctx.AdvanceClockAndRunEventLoop(kIdleDelay);
+    NL_TEST_ASSERT(inSuite, persister.mWriteCount == 2);
+    NL_TEST_ASSERT(inSuite, persister.mBatchCount == 2);
+
+    provider.Shutdown();
+}
+
+void TestShutdown(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(inContext);
+    RecordingPersister persister;
+    WriteBehindAttributePersistenceProvider provider(persister, kIdleDelay, kMaxDelay);
+
+    // Writes are not deferred before Init().
+    NL_TEST_ASSERT(inSuite, WriteByte(provider, kOnOffPath, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, persister.mWriteCount == 1);
+
+    NL_TEST_ASSERT(inSuite, provider.Init(&ctx.GetSystemLayer()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, WriteByte(provider, kOnOffPath, 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, provider.WriteValue(kLevelPath, ByteSpan()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, provider.GetPendingCount() == 2);
+
+    // Empty values are pending too.
+    uint8_t buffer[4];
+    MutableByteSpan value(buffer);
+    NL_TEST_ASSERT(inSuite, provider.ReadValue(kLevelPath, nullptr, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, value.empty());
+
+    // Shutdown writes the pending values, and later writes go through.
+    provider.Shutdown();
+    NL_TEST_ASSERT(inSuite, persister.mWriteCount == 3);
+    NL_TEST_ASSERT(inSuite, persister.HasValue(kOnOffPath, 1));
+    NL_TEST_ASSERT(inSuite, persister.mValues[kLevelPath].empty());
+
+    NL_TEST_ASSERT(inSuite, WriteByte(provider, kOnOffPath, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, persister.HasValue(kOnOffPath, 0));
+
+    // Nothing is flushed after Shutdown().
+    ctx.AdvanceClockAndRunEventLoop(kMaxDelay);
+    NL_TEST_ASSERT(inSuite, persister.mWriteCount == 4);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Writes are coalesced until idle", TestCoalescing),
+    NL_TEST_DEF("Writes are flushed within the maximum delay", TestMaxDelay),
+    NL_TEST_DEF("Shutdown flushes the pending writes", TestShutdown),
+    NL_TEST_SENTINEL()
+};
+
+nlTestSuite sSuite =
+{
+    "TestWriteBehindAttributePersistenceProvider",
+    &sTests[0],
+    TestContext::nlTestSetUpTestSuite,
+    TestContext::nlTestTearDownTestSuite,
+    TestContext::nlTestSetUp,
+    TestContext::nlTestTearDown,
+};
+// clang-format on
+
+} // namespace
+
+int TestWriteBehindAttributePersistenceProvider()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestWriteBehindAttributePersistenceProvider)
@@ -18,6 +18,7 @@
 #include <app/util/attribute-storage.h>
 
 #include <app/AttributeAccessInterfaceCache.h>
+#include <app/AttributePathTable.h>
 #include <app/AttributePersistenceProvider.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/reporting.h>
@@ -141,6 +142,16 @@ DataVersion fixedEndpointDataVersions[ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT];
 AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
 AttributeAccessInterfaceCache gAttributeAccessInterfaceCache;
 
+// Reports deferred while a dynamic endpoint batch is open, by endpoint index.
+enum PendingEndpointReport : uint8_t
+{
+    kPendingEndpointReport  = 0x1, // The endpoint was enabled
+    kPendingPartsListReport = 0x2, // The PartsList of the endpoint changed
+};
+
+uint16_t gDynamicEndpointBatchDepth = 0;
+uint8_t gPendingEndpointReports[MAX_ENDPOINT_COUNT];
+
 // shouldUnregister returns true if the given AttributeAccessInterface should be
 // unregistered.
 template <typename F>
@@ -923,6 +934,62 @@ bool emberAfEndpointIsEnabled(EndpointId endpoint)
     return emberAfEndpointIndexIsEnabled(index);
 }
 
+// Reports a change of the PartsList of the given endpoint, or defers it until the dynamic endpoint batch is committed.
+static void reportPartsListChange(EndpointId endpoint)
+{
+    if (gDynamicEndpointBatchDepth == 0)
+    {
+        MatterReportingAttributeChangeCallback(endpoint, app::Clusters::Descriptor::Id,
+                                               app::Clusters::Descriptor::Attributes::PartsList::Id);
+        return;
+    }
+
+    uint16_t index = findIndexFromEndpoint(endpoint, false /* ignoreDisabledEndpoints */);
+    if (index != kEmberInvalidEndpointIndex)
+    {
+        gPendingEndpointReports[index] |= kPendingPartsListReport;
+    }
+}
+
+void emberAfBeginDynamicEndpointBatch()
+{
+    assertChipStackLockedByCurrentThread();
+
+    gDynamicEndpointBatchDepth++;
+}
+
+void emberAfCommitDynamicEndpointBatch()
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrDie(gDynamicEndpointBatchDepth > 0);
+    gDynamicEndpointBatchDepth--;
+    VerifyOrReturn(gDynamicEndpointBatchDepth == 0);
+
+    for (uint16_t index = 0; index < MAX_ENDPOINT_COUNT; index++)
+    {
+        uint8_t pendingReports         = gPendingEndpointReports[index];
+        gPendingEndpointReports[index] = 0;
+
+        // Nothing is reported for the endpoints that were disabled in the meantime.
+        if (pendingReports == 0 || !emberAfEndpointIndexIsEnabled(index))
+        {
+            continue;
+        }
+
+        EndpointId endpoint = emAfEndpoints[index].endpoint;
+        if (pendingReports & kPendingEndpointReport)
+        {
+            MatterReportingAttributeChangeCallback(endpoint);
+        }
+        if (pendingReports & kPendingPartsListReport)
+        {
+            MatterReportingAttributeChangeCallback(endpoint, app::Clusters::Descriptor::Id,
+                                                   app::Clusters::Descriptor::Attributes::PartsList::Id);
+        }
+    }
+}
+
 bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
 {
     uint16_t index = findIndexFromEndpoint(endpoint, false /* ignoreDisabledEndpoints */);
@@ -942,22 +1009,34 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
 
     if (currentlyEnabled != enable)
     {
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+        app::AttributePathTable::Instance().MarkDirty();
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+
         if (enable)
         {
             initializeEndpoint(&(emAfEndpoints[index]));
-            MatterReportingAttributeChangeCallback(endpoint);
+            if (gDynamicEndpointBatchDepth == 0)
+            {
+                MatterReportingAttributeChangeCallback(endpoint);
+            }
+            else
+            {
+                gPendingEndpointReports[index] |= kPendingEndpointReport;
+            }
         }
         else
         {
             shutdownEndpoint(&(emAfEndpoints[index]));
             emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isEnabled);
+            // Nothing is left to report for this endpoint, and its index may be reused before the batch is committed.
+            gPendingEndpointReports[index] = 0;
         }
 
         EndpointId parentEndpointId = emberAfParentEndpointFromIndex(index);
         while (parentEndpointId != kInvalidEndpointId)
         {
-            MatterReportingAttributeChangeCallback(parentEndpointId, app::Clusters::Descriptor::Id,
-                                                   app::Clusters::Descriptor::Attributes::PartsList::Id);
+            reportPartsListChange(parentEndpointId);
             uint16_t parentIndex = emberAfIndexFromEndpoint(parentEndpointId);
             if (parentIndex == kEmberInvalidEndpointIndex)
             {
@@ -967,8 +1046,7 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
             parentEndpointId = emberAfParentEndpointFromIndex(parentIndex);
         }
 
-        MatterReportingAttributeChangeCallback(/* endpoint = */ 0, app::Clusters::Descriptor::Id,
-                                               app::Clusters::Descriptor::Attributes::PartsList::Id);
+        reportPartsListChange(/* endpoint = */ 0);
     }
 
     return true;
@@ -210,6 +210,17 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, chip::EndpointId id, const
 chip::EndpointId emberAfClearDynamicEndpoint(uint16_t index);
 uint16_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
 
+// Begin a batch of endpoint changes, for instance when a bridge sets up many dynamic endpoints at once.
+//
+// Until the matching emberAfCommitDynamicEndpointBatch() call, enabling or disabling endpoints (which includes
+// emberAfSetDynamicEndpoint and emberAfClearDynamicEndpoint) does not report the changed endpoints and Descriptor
+// PartsList attributes: they are reported once each on commit, for the endpoints that are still enabled then.
+//
+// Batches may be nested, only the outermost commit reports the changes. Both calls must be made with the
+// Matter stack locked.
+void emberAfBeginDynamicEndpointBatch();
+void emberAfCommitDynamicEndpointBatch();
+
 // Get the number of attributes of the specific cluster under the endpoint.
 // Returns 0 if the cluster does not exist.
 uint16_t emberAfGetServerAttributeCount(chip::EndpointId endpoint, chip::ClusterId cluster);
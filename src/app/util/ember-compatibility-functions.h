@@ -22,6 +22,7 @@
 #include <app/ConcreteEventPath.h>
 #include <app/WriteHandler.h>
 #include <app/util/attribute-metadata.h>
+#include <lib/core/Optional.h>
 #include <protocols/interaction_model/StatusCode.h>
 
 namespace chip {
@@ -55,12 +56,15 @@ bool ConcreteAttributePathExists(const ConcreteAttributePath & aPath);
  *  @param[in]    aSubjectDescriptor    The subject descriptor for the read.
  *  @param[in]    aPath                 The concrete path of the data being read.
  *  @param[in]    aAttributeReports      The TLV Builder for Cluter attribute builder.
+ *  @param[in]    aAccessAllowed        The outcome of the access control check the caller already made for aPath, if any, so that
+ *                                      it is not made again.
  *
  *  @retval  CHIP_NO_ERROR on success
  */
 CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                                  const ConcreteReadAttributePath & aPath, AttributeReportIBs::Builder & aAttributeReports,
-                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState);
+                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState,
+                                 Optional<bool> aAccessAllowed = NullOptional);
 
 /**
  * Returns the metadata of the attribute for the given path.
@@ -39,6 +39,7 @@
 #include <app/util/mock/MockNodeConfig.h>
 
 #include <app/AttributeAccessInterface.h>
+#include <app/AttributePathTable.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/EventManagement.h>
 #include <lib/core/CHIPCore.h>
@@ -305,6 +306,22 @@ DataVersion GetVersion()
     return dataVersion;
 }
 
+void SetMockNodeConfig(const MockNodeConfig & config)
+{
+    mockConfig = &config;
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+    AttributePathTable::Instance().MarkDirty();
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+}
+
+void ResetMockNodeConfig()
+{
+    mockConfig = nullptr;
+#if CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+    AttributePathTable::Instance().MarkDirty();
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_PATH_TABLE
+}
+
 CHIP_ERROR ReadSingleMockClusterData(FabricIndex aAccessingFabricIndex, const ConcreteAttributePath & aPath,
                                      AttributeReportIBs::Builder & aAttributeReports,
                                      AttributeValueEncoder::AttributeEncodeState * apEncoderState)
@@ -38,6 +38,7 @@
 
 #include <app/server/Dnssd.h>
 #include <protocols/secure_channel/CASEServer.h>
+#include <protocols/secure_channel/PASEVerifierGenerator.h>
 #include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
 
 using namespace chip::Inet;
@@ -480,6 +481,9 @@ void DeviceControllerSystemState::Shutdown()
 
     Dnssd::Resolver::Instance().Shutdown();
 
+    // Cached PASE verifiers are passcode equivalents: do not keep them past the stack.
+    PASEVerifierGenerator::ClearCache();
+
     // Shut down the interaction model
     app::InteractionModelEngine::GetInstance()->Shutdown();
 
@@ -0,0 +1,301 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningPool.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Controller {
+
+CHIP_ERROR CommissioningPool::Init(System::Layer * systemLayer, Span<DeviceCommissioner * const> commissioners,
+                                   Delegate * delegate)
+{
+    VerifyOrReturnError(mSystemLayer == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(systemLayer != nullptr && delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!commissioners.empty() && commissioners.size() <= kMaxCommissioners, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t i = 0; i < commissioners.size(); i++)
+    {
+        VerifyOrReturnError(commissioners[i] != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    for (size_t i = 0; i < commissioners.size(); i++)
+    {
+        Lane & lane         = mLanes[i];
+        lane.mpPool         = this;
+        lane.mpCommissioner = commissioners[i];
+        lane.mNodeId          = kUndefinedNodeId;
+        lane.mActive          = false;
+        lane.mInBleRendezvous = false;
+        commissioners[i]->RegisterPairingDelegate(&lane);
+    }
+
+    mLaneCount   = commissioners.size();
+    mSystemLayer = systemLayer;
+    mDelegate    = delegate;
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPool::Shutdown()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    mSystemLayer->CancelTimer(OnStartPending, this);
+
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane & lane = mLanes[i];
+        if (lane.mActive)
+        {
+            // Mark the lane inactive first, so that the callbacks made while stopping are ignored.
+            lane.mActive          = false;
+            lane.mInBleRendezvous = false;
+            LogErrorOnFailure(lane.mpCommissioner->StopPairing(lane.mNodeId));
+        }
+        if (lane.mpCommissioner->GetPairingDelegate() == &lane)
+        {
+            lane.mpCommissioner->RegisterPairingDelegate(nullptr);
+        }
+        lane.mpCommissioner = nullptr;
+    }
+    mLaneCount = 0;
+
+    while (mpPendingHead != nullptr)
+    {
+        PendingRequest * next = mpPendingHead->mpNext;
+        Platform::Delete(mpPendingHead);
+        mpPendingHead = next;
+    }
+    mpPendingTail = nullptr;
+    mPendingCount = 0;
+
+    mSystemLayer = nullptr;
+    mDelegate    = nullptr;
+}
+
+CHIP_ERROR CommissioningPool::Commission(NodeId nodeId, const char * setUpCode, const CommissioningParameters & params,
+                                         DiscoveryType discoveryType)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(setUpCode != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    PendingRequest * request = Platform::New<PendingRequest>();
+    VerifyOrReturnError(request != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    const size_t setUpCodeSize = strlen(setUpCode) + 1;
+    if (!request->mSetUpCode.Alloc(setUpCodeSize))
+    {
+        Platform::Delete(request);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    memcpy(request->mSetUpCode.Get(), setUpCode, setUpCodeSize);
+    request->mNodeId        = nodeId;
+    request->mParams        = params;
+    request->mDiscoveryType = discoveryType;
+
+    if (mpPendingTail == nullptr)
+    {
+        mpPendingHead = request;
+    }
+    else
+    {
+        mpPendingTail->mpNext = request;
+    }
+    mpPendingTail = request;
+    mPendingCount++;
+
+    ScheduleStart();
+    return CHIP_NO_ERROR;
+}
+
+size_t CommissioningPool::GetActiveCount() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        count += mLanes[i].mActive ? 1 : 0;
+    }
+    return count;
+}
+
+void CommissioningPool::ScheduleStart()
+{
+    // Requests are always started from the event loop, so that a commissioner is never asked to start a
+    // new flow from within the callbacks of the previous one.
+    CHIP_ERROR err = mSystemLayer->StartTimer(System::Clock::kZero, OnStartPending, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule the pending commissioning requests: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void CommissioningPool::OnStartPending(System::Layer * systemLayer, void * context)
+{
+    static_cast<CommissioningPool *>(context)->StartPending();
+}
+
+void CommissioningPool::StartPending()
+{
+    while (true)
+    {
+        Lane * lane = FindFreeLane();
+        VerifyOrReturn(lane != nullptr);
+
+        PendingRequest * request = TakeNextStartable();
+        VerifyOrReturn(request != nullptr);
+
+        ChipLogProgress(Controller, "Commissioning node 0x" ChipLogFormatX64 " (%u active, %u pending)",
+                        ChipLogValueX64(request->mNodeId), static_cast<unsigned>(GetActiveCount() + 1),
+                        static_cast<unsigned>(mPendingCount));
+
+        lane->mNodeId          = request->mNodeId;
+        lane->mActive          = true;
+        lane->mInBleRendezvous = (request->mDiscoveryType == DiscoveryType::kAll);
+        CHIP_ERROR err         = StartCommissioning(*lane->mpCommissioner, request->mNodeId, request->mSetUpCode.Get(),
+                                            request->mParams, request->mDiscoveryType);
+        Platform::Delete(request);
+
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Failed to start commissioning node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(lane->mNodeId), err.Format());
+            OnLaneComplete(*lane, err);
+            // The delegate may have shut the pool down.
+            VerifyOrReturn(mSystemLayer != nullptr);
+        }
+    }
+}
+
+CommissioningPool::PendingRequest * CommissioningPool::TakeNextStartable()
+{
+    // Requests that may use BLE wait for the current BLE rendezvous, without holding back the others.
+    const bool bleBusy        = IsBleRendezvousActive();
+    PendingRequest * previous = nullptr;
+    for (PendingRequest * request = mpPendingHead; request != nullptr; previous = request, request = request->mpNext)
+    {
+        if (bleBusy && request->mDiscoveryType == DiscoveryType::kAll)
+        {
+            continue;
+        }
+
+        if (previous == nullptr)
+        {
+            mpPendingHead = request->mpNext;
+        }
+        else
+        {
+            previous->mpNext = request->mpNext;
+        }
+        if (mpPendingTail == request)
+        {
+            mpPendingTail = previous;
+        }
+        request->mpNext = nullptr;
+        mPendingCount--;
+        return request;
+    }
+    return nullptr;
+}
+
+bool CommissioningPool::IsBleRendezvousActive() const
+{
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        if (mLanes[i].mActive && mLanes[i].mInBleRendezvous)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CommissioningPool::Lane * CommissioningPool::FindFreeLane()
+{
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        if (!mLanes[i].mActive)
+        {
+            return &mLanes[i];
+        }
+    }
+    return nullptr;
+}
+
+void CommissioningPool::OnLaneComplete(Lane & lane, CHIP_ERROR error)
+{
+    const NodeId nodeId   = lane.mNodeId;
+    lane.mActive          = false;
+    lane.mInBleRendezvous = false;
+    lane.mNodeId          = kUndefinedNodeId;
+
+    Delegate * delegate = mDelegate;
+    delegate->OnCommissioningComplete(nodeId, error);
+
+    // The delegate may have shut the pool down.
+    VerifyOrReturn(mSystemLayer != nullptr);
+    if (mpPendingHead != nullptr)
+    {
+        ScheduleStart();
+    }
+    else if (GetActiveCount() == 0)
+    {
+        delegate->OnAllCommissioningComplete();
+    }
+}
+
+void CommissioningPool::OnBleRendezvousComplete(Lane & lane)
+{
+    VerifyOrReturn(lane.mInBleRendezvous);
+    lane.mInBleRendezvous = false;
+    if (mpPendingHead != nullptr)
+    {
+        ScheduleStart();
+    }
+}
+
+void CommissioningPool::Lane::OnPairingComplete(CHIP_ERROR error)
+{
+    VerifyOrReturn(mActive);
+    if (error == CHIP_NO_ERROR)
+    {
+        // A successful PASE session is followed by OnCommissioningComplete, but frees the BLE scanner.
+        mpPool->OnBleRendezvousComplete(*this);
+        return;
+    }
+    mpPool->OnLaneComplete(*this, error);
+}
+
+void CommissioningPool::Lane::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturn(mActive);
+    mpPool->OnLaneComplete(*this, error);
+}
+
+void CommissioningPool::Lane::OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error)
+{
+    VerifyOrReturn(mActive);
+    mpPool->mDelegate->OnCommissioningStatusUpdate(mNodeId, stageCompleted, error);
+}
+
+} // namespace Controller
+} // namespace chip
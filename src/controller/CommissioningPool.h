@@ -0,0 +1,164 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * Commissions several devices concurrently, one per DeviceCommissioner.
+ *
+ * A DeviceCommissioner runs a single commissioning flow at a time: it has one AutoCommissioner, and one
+ * device in PASE establishment. The pool spreads queued commissioning requests over several
+ * DeviceCommissioner instances, typically all set up on the same fabric with permitMultiControllerFabrics,
+ * so that each flow has its own CommissioneeDeviceProxy and CommissioningDelegate state, while the
+ * operational credentials issuer and the device attestation verifier are shared.
+ *
+ * The pool registers itself as the DevicePairingDelegate of every commissioner given to Init(), and
+ * reports the outcome of each request to its own Delegate.
+ *
+ * Commissioning parameters are copied, but the buffers they point to (network credentials, CSR nonce,
+ * ...) must remain valid until the request completes.
+ *
+ * Requests default to on-network discovery. The commissioners share a single BLE scanner, so requests
+ * that may discover the device over BLE (DiscoveryType::kAll) establish PASE one at a time: such a
+ * request waits while another one is in its rendezvous, and on-network requests queued after it are
+ * started in the meantime.
+ *
+ * The pool only runs the flows concurrently: each flow still verifies its device attestation and gets its
+ * NOC signed on its own, through the shared verifier and issuer, as a single DeviceCommissioner would.
+ */
+class CommissioningPool
+{
+public:
+    static constexpr size_t kMaxCommissioners = CHIP_CONFIG_CONTROLLER_MAX_PARALLEL_COMMISSIONING;
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Called when a request completes, successfully or not. Failures to establish PASE, or to start
+         * the commissioning at all, are reported here as well.
+         */
+        virtual void OnCommissioningComplete(NodeId nodeId, CHIP_ERROR error) = 0;
+
+        virtual void OnCommissioningStatusUpdate(NodeId nodeId, CommissioningStage stageCompleted, CHIP_ERROR error) {}
+
+        /**
+         * Called when the last request completes and no other request is queued.
+         */
+        virtual void OnAllCommissioningComplete() {}
+    };
+
+    CommissioningPool() = default;
+    virtual ~CommissioningPool() { Shutdown(); }
+
+    CommissioningPool(const CommissioningPool &)             = delete;
+    CommissioningPool & operator=(const CommissioningPool &) = delete;
+
+    /**
+     * @param[in] systemLayer    The system layer the commissioners run on.
+     * @param[in] commissioners  Initialized commissioners, at most kMaxCommissioners. They must not be used
+     *                           for anything else until Shutdown().
+     * @param[in] delegate       Receives the outcome of every request.
+     */
+    CHIP_ERROR Init(System::Layer * systemLayer, Span<DeviceCommissioner * const> commissioners, Delegate * delegate);
+
+    /**
+     * Stop the active flows, drop the queued requests, and unregister from the commissioners. No
+     * Delegate callback is made for the requests that did not complete.
+     */
+    void Shutdown();
+
+    /**
+     * Queue a request to commission `nodeId` with the given setup code. Requests are started in order,
+     * from the event loop, as soon as a commissioner is free.
+     */
+    CHIP_ERROR Commission(NodeId nodeId, const char * setUpCode, const CommissioningParameters & params,
+                          DiscoveryType discoveryType = DiscoveryType::kDiscoveryNetworkOnly);
+
+    size_t GetActiveCount() const;
+    size_t GetPendingCount() const { return mPendingCount; }
+
+protected:
+    /**
+     * Start a single commissioning flow. Overridden by tests.
+     */
+    virtual CHIP_ERROR StartCommissioning(DeviceCommissioner & commissioner, NodeId nodeId, const char * setUpCode,
+                                          const CommissioningParameters & params, DiscoveryType discoveryType)
+    {
+        return commissioner.PairDevice(nodeId, setUpCode, params, discoveryType);
+    }
+
+private:
+    class Lane : public DevicePairingDelegate
+    {
+    public:
+        void OnPairingComplete(CHIP_ERROR error) override;
+        void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+        void OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error) override;
+
+        CommissioningPool * mpPool          = nullptr;
+        DeviceCommissioner * mpCommissioner = nullptr;
+        NodeId mNodeId                      = kUndefinedNodeId;
+        bool mActive                        = false;
+        bool mInBleRendezvous               = false; // The flow may use BLE, and has not established PASE yet.
+    };
+
+    struct PendingRequest
+    {
+        NodeId mNodeId;
+        Platform::ScopedMemoryBuffer<char> mSetUpCode;
+        CommissioningParameters mParams;
+        DiscoveryType mDiscoveryType;
+        PendingRequest * mpNext = nullptr;
+    };
+
+    void ScheduleStart();
+    void StartPending();
+    Lane * FindFreeLane();
+    bool IsBleRendezvousActive() const;
+    PendingRequest * TakeNextStartable();
+    void OnBleRendezvousComplete(Lane & lane);
+    void OnLaneComplete(Lane & lane, CHIP_ERROR error);
+    static void OnStartPending(System::Layer * systemLayer, void * context);
+
+    System::Layer * mSystemLayer = nullptr;
+    Delegate * mDelegate         = nullptr;
+    Lane mLanes[kMaxCommissioners];
+    size_t mLaneCount = 0;
+
+    PendingRequest * mpPendingHead = nullptr;
+    PendingRequest * mpPendingTail = nullptr;
+    size_t mPendingCount           = 0;
+};
+
+} // namespace Controller
+} // namespace chip
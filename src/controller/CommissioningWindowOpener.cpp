@@ -105,9 +105,12 @@ CHIP_ERROR CommissioningWindowOpener::OpenCommissioningWindow(NodeId deviceId, S
     mCommissioningWindowTimeout       = timeout;
     mPBKDFIterations                  = iteration;
 
+    // PBKDF2 runs in the background while the device is being connected to; the PIN is known right away.
     bool randomSetupPIN = !setupPIN.HasValue();
+    mVerifierStatus     = CHIP_ERROR_INCORRECT_STATE;
+    mWaitingForVerifier = false;
     ReturnErrorOnFailure(
-        PASESession::GeneratePASEVerifier(mVerifier, mPBKDFIterations, mPBKDFSalt, randomSetupPIN, mSetupPayload.setUpPINCode));
+        mVerifierGenerator.Generate(mPBKDFIterations, mPBKDFSalt, randomSetupPIN, mSetupPayload.setUpPINCode, this));
 
     payload = mSetupPayload;
 
@@ -120,7 +123,36 @@ CHIP_ERROR CommissioningWindowOpener::OpenCommissioningWindow(NodeId deviceId, S
         mNextStep = Step::kOpenCommissioningWindow;
     }
 
-    return mController->GetConnectedDevice(mNodeId, &mDeviceConnected, &mDeviceConnectionFailure);
+    CHIP_ERROR err = mController->GetConnectedDevice(mNodeId, &mDeviceConnected, &mDeviceConnectionFailure);
+    if (err != CHIP_NO_ERROR)
+    {
+        mVerifierGenerator.Cancel();
+    }
+    return err;
+}
+
+void CommissioningWindowOpener::OnPASEVerifierGenerated(CHIP_ERROR status, const Spake2pVerifier & verifier)
+{
+    mVerifierStatus = status;
+    if (status == CHIP_NO_ERROR)
+    {
+        mVerifier = verifier;
+    }
+
+    VerifyOrReturn(mWaitingForVerifier);
+    mWaitingForVerifier = false;
+
+    // The device got connected first: get the session again to open the commissioning window.
+    CHIP_ERROR err = status;
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mController->GetConnectedDevice(mNodeId, &mDeviceConnected, &mDeviceConnectionFailure);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Could not resume opening the commissioning window: %" CHIP_ERROR_FORMAT, err.Format());
+        OnOpenCommissioningWindowFailure(this, err);
+    }
 }
 
 CHIP_ERROR CommissioningWindowOpener::OpenCommissioningWindowInternal(Messaging::ExchangeManager & exchangeMgr,
@@ -246,6 +278,8 @@ void CommissioningWindowOpener::OnOpenCommissioningWindowFailure(void * context,
     ChipLogError(Controller, "Failed to open pairing window on the device. Status %" CHIP_ERROR_FORMAT, error.Format());
     auto * self     = static_cast<CommissioningWindowOpener *>(context);
     self->mNextStep = Step::kAcceptCommissioningStart;
+    self->mVerifierGenerator.Cancel();
+    self->mWaitingForVerifier = false;
     if (self->mCommissioningWindowCallback != nullptr)
     {
         self->mCommissioningWindowCallback->mCall(self->mCommissioningWindowCallback->mContext, self->mNodeId, error,
@@ -288,6 +322,23 @@ void CommissioningWindowOpener::OnDeviceConnectedCallback(void * context, Messag
         break;
     }
     case Step::kOpenCommissioningWindow: {
+        if (self->mCommissioningWindowOption != CommissioningWindowOption::kOriginalSetupCode)
+        {
+            if (self->mVerifierGenerator.IsGenerating())
+            {
+                // Resumed by OnPASEVerifierGenerated
+                self->mWaitingForVerifier = true;
+                break;
+            }
+            err = self->mVerifierStatus;
+            if (err != CHIP_NO_ERROR)
+            {
+#if CHIP_ERROR_LOGGING
+                messageIfError = "Could not generate PASE verifier";
+#endif // CHIP_ERROR_LOGGING
+                break;
+            }
+        }
         err = self->OpenCommissioningWindowInternal(exchangeMgr, sessionHandle);
 #if CHIP_ERROR_LOGGING
         messageIfError = "Could not connect to open commissioning window";
@@ -25,6 +25,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/NodeId.h>
 #include <lib/core/Optional.h>
+#include <protocols/secure_channel/PASEVerifierGenerator.h>
 #include <setup_payload/SetupPayload.h>
 #include <system/SystemClock.h>
 
@@ -39,7 +40,7 @@ typedef void (*OnOpenBasicCommissioningWindow)(void * context, NodeId deviceId,
 /**
  * A helper class to open a commissioning window given some parameters.
  */
-class CommissioningWindowOpener
+class CommissioningWindowOpener : private PASEVerifierGenerator::Delegate
 {
 public:
     CommissioningWindowOpener(DeviceController * controller) :
@@ -130,6 +131,9 @@ private:
                                           const SessionHandle & sessionHandle);
     static void OnDeviceConnectionFailureCallback(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
 
+    // PASEVerifierGenerator::Delegate
+    void OnPASEVerifierGenerated(CHIP_ERROR status, const Spake2pVerifier & verifier) override;
+
     DeviceController * const mController = nullptr;
     Step mNextStep                       = Step::kAcceptCommissioningStart;
 
@@ -140,6 +144,10 @@ private:
     System::Clock::Seconds16 mCommissioningWindowTimeout = System::Clock::kZero;
     CommissioningWindowOption mCommissioningWindowOption = CommissioningWindowOption::kOriginalSetupCode;
     Spake2pVerifier mVerifier; // Used for non-basic commissioning.
+    // The verifier is generated in the background while the device is being connected to.
+    PASEVerifierGenerator mVerifierGenerator;
+    CHIP_ERROR mVerifierStatus = CHIP_ERROR_INCORRECT_STATE;
+    bool mWaitingForVerifier   = false;
     // Parameters needed for non-basic commissioning.
     uint32_t mPBKDFIterations = 0;
     uint8_t mPBKDFSaltBuffer[kSpake2p_Max_PBKDF_Salt_Length];
@@ -875,8 +875,31 @@ class AsyncWriteTransaction:
         self._event_loop.call_soon_threadsafe(self._handleDone)
 
 
+class _PyAttributeReportEntry(ctypes.Structure):
+    ''' Attribute report entry that has c++ counterpart for CFFI.
+
+    The attribute data of a report is handed over from C++ in a single call, as an array of the following
+    struct along with one buffer holding the TLV of every entry:
+
+    ```c
+    struct PyAttributeReportEntry
+    {
+        chip::EndpointId endpointId;
+        chip::ClusterId clusterId;
+        chip::AttributeId attributeId;
+        chip::DataVersion dataVersion;
+        uint32_t dataOffset;
+        uint32_t dataLength;
+        uint8_t imstatus;
+    };
+    ```
+    '''
+    _fields_ = [('endpointId', c_uint16), ('clusterId', c_uint32), ('attributeId', c_uint32), ('dataVersion', c_uint32),
+                ('dataOffset', c_uint32), ('dataLength', c_uint32), ('imstatus', c_uint8)]
+
+
 _OnReadAttributeDataCallbackFunct = CFUNCTYPE(
-    None, py_object, c_uint32, c_uint16, c_uint32, c_uint32, c_uint8, c_void_p, c_size_t)
+    None, py_object, POINTER(_PyAttributeReportEntry), c_size_t, c_void_p, c_size_t)
 _OnSubscriptionEstablishedCallbackFunct = CFUNCTYPE(None, py_object, c_uint32)
 _OnResubscriptionAttemptedCallbackFunct = CFUNCTYPE(None, py_object, PyChipError, c_uint32)
 _OnReadEventDataCallbackFunct = CFUNCTYPE(
@@ -892,10 +915,13 @@ _OnReportEndCallbackFunct = CFUNCTYPE(
 
 
 @_OnReadAttributeDataCallbackFunct
-def _OnReadAttributeDataCallback(closure, dataVersion: int, endpoint: int, cluster: int, attribute: int, status, data, len):
+def _OnReadAttributeDataCallback(closure, entries, entryCount: int, data, len):
+    # The entries and their data are only valid during this call, copy the data out once for all of them.
     dataBytes = ctypes.string_at(data, len)
-    closure.handleAttributeData(AttributePath(
-        EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute), dataVersion, status, dataBytes[:])
+    for entry in entries[:entryCount]:
+        closure.handleAttributeData(AttributePath(
+            EndpointId=entry.endpointId, ClusterId=entry.clusterId, AttributeId=entry.attributeId), entry.dataVersion,
+            entry.imstatus, dataBytes[entry.dataOffset:entry.dataOffset + entry.dataLength])
 
 
 @_OnReadEventDataCallbackFunct
@@ -19,6 +19,7 @@
 #include <cstdarg>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include <app/BufferedReadCallback.h>
 #include <app/ChunkedWriteCallback.h>
@@ -68,10 +69,22 @@ struct __attribute__((packed)) DataVersionFilter
     chip::DataVersion dataVersion;
 };
 
-using OnReadAttributeDataCallback       = void (*)(PyObject * appContext, chip::DataVersion version, chip::EndpointId endpointId,
-                                             chip::ClusterId clusterId, chip::AttributeId attributeId,
-                                             std::underlying_type_t<Protocols::InteractionModel::Status> imstatus, uint8_t * data,
-                                             uint32_t dataLen);
+// This needs to match the python definition that uses the same name.
+struct PyAttributeReportEntry
+{
+    chip::EndpointId endpointId;
+    chip::ClusterId clusterId;
+    chip::AttributeId attributeId;
+    chip::DataVersion dataVersion;
+    // Location of the attribute TLV in the data buffer of the batch.
+    uint32_t dataOffset;
+    uint32_t dataLength;
+    std::underlying_type_t<Protocols::InteractionModel::Status> imstatus;
+};
+
+// The attribute data of a report is handed over in one call: entries index into a single buffer holding their TLV.
+using OnReadAttributeDataCallback       = void (*)(PyObject * appContext, const PyAttributeReportEntry * entries, size_t entryCount,
+                                             const uint8_t * data, size_t dataLen);
 using OnReadEventDataCallback           = void (*)(PyObject * appContext, chip::EndpointId endpointId, chip::ClusterId clusterId,
                                          chip::EventId eventId, chip::EventNumber eventNumber, uint8_t priority, uint64_t timestamp,
                                          uint8_t timestampType, uint8_t * data, uint32_t dataLen,
@@ -112,35 +125,39 @@ public:
         // callback. If we do, that's a bug.
         //
         VerifyOrDie(!aPath.IsListItemOperation());
-        size_t bufferLen                  = (apData == nullptr ? 0 : apData->GetRemainingLength() + apData->GetLengthRead());
-        std::unique_ptr<uint8_t[]> buffer = std::unique_ptr<uint8_t[]>(apData == nullptr ? nullptr : new uint8_t[bufferLen]);
-        uint32_t size                     = 0;
+
+        PyAttributeReportEntry entry;
+        entry.endpointId  = aPath.mEndpointId;
+        entry.clusterId   = aPath.mClusterId;
+        entry.attributeId = aPath.mAttributeId;
+        entry.dataVersion = aPath.mDataVersion.ValueOr(0);
+        entry.dataOffset  = static_cast<uint32_t>(mReportData.size());
+        entry.dataLength  = 0;
+        entry.imstatus    = to_underlying(aStatus.mStatus);
+
         // When the apData is nullptr, means we did not receive a valid attribute data from server, status will be some error
         // status.
         if (apData != nullptr)
         {
+            size_t bufferLen = apData->GetRemainingLength() + apData->GetLengthRead();
+            mReportData.resize(entry.dataOffset + bufferLen);
+
             // The TLVReader's read head is not pointing to the first element in the container instead of the container itself, use
             // a TLVWriter to get a TLV with a normalized TLV buffer (Wrapped with a anonymous tag, no extra "end of container" tag
             // at the end.)
             TLV::TLVWriter writer;
-            writer.Init(buffer.get(), bufferLen);
+            writer.Init(mReportData.data() + entry.dataOffset, bufferLen);
             CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), *apData);
+            mReportData.resize(entry.dataOffset + writer.GetLengthWritten());
             if (err != CHIP_NO_ERROR)
             {
                 this->OnError(err);
                 return;
             }
-            size = writer.GetLengthWritten();
+            entry.dataLength = writer.GetLengthWritten();
         }
 
-        DataVersion version = 0;
-        if (aPath.mDataVersion.HasValue())
-        {
-            version = aPath.mDataVersion.Value();
-        }
-
-        gOnReadAttributeDataCallback(mAppContext, version, aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId,
-                                     to_underlying(aStatus.mStatus), buffer.get(), size);
+        mReportEntries.push_back(entry);
     }
 
     void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override
@@ -165,6 +182,9 @@ public:
 
     void OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus) override
     {
+        // Attributes that came earlier in the report must reach Python before this event does.
+        FlushAttributeData();
+
         uint8_t buffer[CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE];
         uint32_t size  = 0;
         CHIP_ERROR err = CHIP_NO_ERROR;
@@ -202,7 +222,11 @@ public:
             to_underlying(apStatus == nullptr ? Protocols::InteractionModel::Status::Success : apStatus->mStatus));
     }
 
-    void OnError(CHIP_ERROR aError) override { gOnReadErrorCallback(mAppContext, ToPyChipError(aError)); }
+    void OnError(CHIP_ERROR aError) override
+    {
+        FlushAttributeData();
+        gOnReadErrorCallback(mAppContext, ToPyChipError(aError));
+    }
 
     void OnReportBegin() override { gOnReportBeginCallback(mAppContext); }
     void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override
@@ -223,10 +247,15 @@ public:
         }
     }
 
-    void OnReportEnd() override { gOnReportEndCallback(mAppContext); }
+    void OnReportEnd() override
+    {
+        FlushAttributeData();
+        gOnReportEndCallback(mAppContext);
+    }
 
     void OnDone(ReadClient *) override
     {
+        FlushAttributeData();
         gOnReadDoneCallback(mAppContext);
 
         delete this;
@@ -237,10 +266,30 @@ public:
     void SetAutoResubscribe(bool autoResubscribe) { mAutoResubscribe = autoResubscribe; }
 
 private:
+    /**
+     * Hands the attribute data accumulated since the last flush over to Python. Crossing into Python is costly, so
+     * this is done once per report instead of once per attribute; events, errors and the end of a report flush first
+     * so that Python still sees everything in the order it was received.
+     */
+    void FlushAttributeData()
+    {
+        VerifyOrReturn(!mReportEntries.empty());
+
+        gOnReadAttributeDataCallback(mAppContext, mReportEntries.data(), mReportEntries.size(), mReportData.data(),
+                                     mReportData.size());
+
+        // Keep the capacity around for the next reports of a subscription.
+        mReportEntries.clear();
+        mReportData.clear();
+    }
+
     BufferedReadCallback mBufferedReadCallback;
 
     PyObject * mAppContext;
 
+    std::vector<PyAttributeReportEntry> mReportEntries;
+    std::vector<uint8_t> mReportData;
+
     std::unique_ptr<ReadClient> mReadClient;
     bool mAutoResubscribe = true;
 };
@@ -0,0 +1,341 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/tests/AppTestContext.h>
+#include <controller/CommissioningPool.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using TestContext = chip::Test::AppContext;
+using namespace chip;
+using namespace chip::Controller;
+
+namespace {
+
+constexpr size_t kCommissionerCount = 3;
+constexpr size_t kDeviceCount       = 10;
+
+// Records the flows started on each commissioner instead of pairing.
+class RecordingCommissioningPool : public CommissioningPool
+{
+public:
+    struct Flow
+    {
+        DeviceCommissioner * commissioner;
+        NodeId nodeId;
+        std::string setUpCode;
+        DiscoveryType discoveryType;
+    };
+
+    std::vector<Flow> mStarted;
+    NodeId mFailToStart = kUndefinedNodeId;
+
+protected:
+    CHIP_ERROR StartCommissioning(DeviceCommissioner & commissioner, NodeId nodeId, const char * setUpCode,
+                                  const CommissioningParameters & params, DiscoveryType discoveryType) override
+    {
+        VerifyOrReturnError(nodeId != mFailToStart, CHIP_ERROR_NO_MEMORY);
+        mStarted.push_back({ &commissioner, nodeId, setUpCode, discoveryType });
+        return CHIP_NO_ERROR;
+    }
+};
+
+class TestDelegate : public CommissioningPool::Delegate
+{
+public:
+    void OnCommissioningComplete(NodeId nodeId, CHIP_ERROR error) override { mCompleted.push_back({ nodeId, error }); }
+    void OnCommissioningStatusUpdate(NodeId nodeId, CommissioningStage stageCompleted, CHIP_ERROR error) override
+    {
+        mStatusUpdates.push_back({ nodeId, stageCompleted });
+    }
+    void OnAllCommissioningComplete() override { mAllCompleteCount++; }
+
+    std::vector<std::pair<NodeId, CHIP_ERROR>> mCompleted;
+    std::vector<std::pair<NodeId, CommissioningStage>> mStatusUpdates;
+    size_t mAllCompleteCount = 0;
+};
+
+struct Commissioners
+{
+    Commissioners()
+    {
+        for (auto & commissioner : mStorage)
+        {
+            commissioner = std::make_unique<DeviceCommissioner>();
+            mPointers.push_back(commissioner.get());
+        }
+    }
+
+    Span<DeviceCommissioner * const> Get() { return Span<DeviceCommissioner * const>(mPointers.data(), mPointers.size()); }
+
+    std::unique_ptr<DeviceCommissioner> mStorage[kCommissionerCount];
+    std::vector<DeviceCommissioner *> mPointers;
+};
+
+// Simulate what a DeviceCommissioner reports at the end of a flow.
+void CompleteFlow(const RecordingCommissioningPool::Flow & flow, CHIP_ERROR error)
+{
+    flow.commissioner->GetPairingDelegate()->OnCommissioningComplete(flow.nodeId, error);
+}
+
+void TestConcurrentFlows(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(inContext);
+    Commissioners commissioners;
+    TestDelegate delegate;
+    RecordingCommissioningPool pool;
+    CommissioningParameters params;
+
+    NL_TEST_ASSERT(inSuite, pool.Init(&ctx.GetSystemLayer(), commissioners.Get(), &delegate) == CHIP_NO_ERROR);
+
+    for (NodeId nodeId = 1; nodeId <= kDeviceCount; nodeId++)
+    {
+        std::string setUpCode = "MT:" + std::to_string(nodeId);
+        NL_TEST_ASSERT(inSuite, pool.Commission(nodeId, setUpCode.c_str(), params) == CHIP_NO_ERROR);
+    }
+
+    // Requests only start from the event loop, one per commissioner.
+    NL_TEST_ASSERT(inSuite, pool.mStarted.empty());
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == kCommissionerCount);
+    NL_TEST_ASSERT(inSuite, pool.GetActiveCount() == kCommissionerCount);
+    NL_TEST_ASSERT(inSuite, pool.GetPendingCount() == kDeviceCount - kCommissionerCount);
+    for (size_t i = 0; i < kCommissionerCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, pool.mStarted[i].commissioner == commissioners.mPointers[i]);
+        NL_TEST_ASSERT(inSuite, pool.mStarted[i].nodeId == i + 1);
+        NL_TEST_ASSERT(inSuite, pool.mStarted[i].setUpCode == "MT:" + std::to_string(i + 1));
+        NL_TEST_ASSERT(inSuite, pool.mStarted[i].discoveryType == DiscoveryType::kDiscoveryNetworkOnly);
+    }
+
+    // The flows progress independently: interleaved status updates are reported with the node of their commissioner.
+    const CommissioningStage stages[] = { CommissioningStage::kArmFailsafe, CommissioningStage::kSendPAICertificateRequest,
+                                          CommissioningStage::kSendNOC };
+    for (CommissioningStage stage : stages)
+    {
+        for (size_t i = kCommissionerCount; i > 0; i--)
+        {
+            commissioners.mPointers[i - 1]->GetPairingDelegate()->OnCommissioningStatusUpdate(PeerId(), stage, CHIP_NO_ERROR);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, delegate.mStatusUpdates.size() == ArraySize(stages) * kCommissionerCount);
+    for (size_t i = 0; i < delegate.mStatusUpdates.size(); i++)
+    {
+        const NodeId expectedNodeId = kCommissionerCount - i % kCommissionerCount;
+        NL_TEST_ASSERT(inSuite, delegate.mStatusUpdates[i].first == expectedNodeId);
+        NL_TEST_ASSERT(inSuite, delegate.mStatusUpdates[i].second == stages[i / kCommissionerCount]);
+    }
+
+    // Complete the oldest flow first: each completion frees its commissioner for the next request.
+    std::vector<bool> done(kDeviceCount + 1, false);
+    while (delegate.mCompleted.size() < kDeviceCount)
+    {
+        size_t index = 0;
+        while (done[static_cast<size_t>(pool.mStarted[index].nodeId)])
+        {
+            index++;
+        }
+        const RecordingCommissioningPool::Flow flow = pool.mStarted[index];
+        const size_t startedCount                   = pool.mStarted.size();
+
+        CompleteFlow(flow, CHIP_NO_ERROR);
+        done[static_cast<size_t>(flow.nodeId)] = true;
+        NL_TEST_ASSERT(inSuite, delegate.mCompleted.back().first == flow.nodeId);
+
+        ctx.DrainAndServiceIO();
+        if (pool.mStarted.size() > startedCount)
+        {
+            NL_TEST_ASSERT(inSuite, pool.mStarted.size() == startedCount + 1);
+            NL_TEST_ASSERT(inSuite, pool.mStarted.back().commissioner == flow.commissioner);
+            NL_TEST_ASSERT(inSuite, pool.mStarted.back().nodeId == startedCount + 1);
+        }
+        // All the commissioners stay busy as long as requests are queued.
+        const size_t remaining = kDeviceCount - delegate.mCompleted.size();
+        NL_TEST_ASSERT(inSuite, pool.GetActiveCount() == chip::min(kCommissionerCount, remaining));
+    }
+
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == kDeviceCount);
+    for (NodeId nodeId = 1; nodeId <= kDeviceCount; nodeId++)
+    {
+        NL_TEST_ASSERT(inSuite, done[static_cast<size_t>(nodeId)]);
+    }
+
+    // The requests were spread evenly over the commissioners.
+    constexpr size_t kFairShare = kDeviceCount / kCommissionerCount;
+    for (auto * commissioner : commissioners.mPointers)
+    {
+        size_t flowCount = 0;
+        for (const auto & flow : pool.mStarted)
+        {
+            flowCount += (flow.commissioner == commissioner) ? 1 : 0;
+        }
+        NL_TEST_ASSERT(inSuite, flowCount == kFairShare || flowCount == kFairShare + 1);
+    }
+    NL_TEST_ASSERT(inSuite, delegate.mAllCompleteCount == 1);
+    NL_TEST_ASSERT(inSuite, pool.GetActiveCount() == 0);
+
+    pool.Shutdown();
+    for (auto * commissioner : commissioners.mPointers)
+    {
+        NL_TEST_ASSERT(inSuite, commissioner->GetPairingDelegate() == nullptr);
+    }
+}
+
+void TestFailures(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(inContext);
+    Commissioners commissioners;
+    TestDelegate delegate;
+    RecordingCommissioningPool pool;
+    CommissioningParameters params;
+
+    NL_TEST_ASSERT(inSuite, pool.Init(&ctx.GetSystemLayer(), commissioners.Get().SubSpan(0, 1), &delegate) == CHIP_NO_ERROR);
+
+    // A request that fails to start is completed, and the next one takes its commissioner.
+    pool.mFailToStart = 1;
+    NL_TEST_ASSERT(inSuite, pool.Commission(1, "MT:1", params) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.Commission(2, "MT:2", params) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.Commission(3, "MT:3", params) == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, delegate.mCompleted.size() == 1);
+    NL_TEST_ASSERT(inSuite, delegate.mCompleted[0].first == 1 && delegate.mCompleted[0].second == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == 1 && pool.mStarted[0].nodeId == 2);
+
+    // A successful PASE session does not complete the flow, a failed one does.
+    DevicePairingDelegate * lane = commissioners.mPointers[0]->GetPairingDelegate();
+    lane->OnPairingComplete(CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.GetActiveCount() == 1);
+    lane->OnPairingComplete(CHIP_ERROR_TIMEOUT);
+    NL_TEST_ASSERT(inSuite, delegate.mCompleted.size() == 2);
+    NL_TEST_ASSERT(inSuite, delegate.mCompleted[1].first == 2 && delegate.mCompleted[1].second == CHIP_ERROR_TIMEOUT);
+
+    // Late callbacks for a completed flow are ignored.
+    lane->OnCommissioningComplete(2, CHIP_ERROR_TIMEOUT);
+    NL_TEST_ASSERT(inSuite, delegate.mCompleted.size() == 2);
+
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == 2 && pool.mStarted[1].nodeId == 3);
+    NL_TEST_ASSERT(inSuite, delegate.mAllCompleteCount == 0);
+
+    // Shutdown drops the pending requests without completing them.
+    NL_TEST_ASSERT(inSuite, pool.Commission(4, "MT:4", params) == CHIP_NO_ERROR);
+    pool.Shutdown();
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == 2);
+    NL_TEST_ASSERT(inSuite, delegate.mCompleted.size() == 2);
+    NL_TEST_ASSERT(inSuite, pool.Commission(5, "MT:5", params) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void TestBleRendezvous(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(inContext);
+    Commissioners commissioners;
+    TestDelegate delegate;
+    RecordingCommissioningPool pool;
+    CommissioningParameters params;
+
+    NL_TEST_ASSERT(inSuite, pool.Init(&ctx.GetSystemLayer(), commissioners.Get().SubSpan(0, 2), &delegate) == CHIP_NO_ERROR);
+    DevicePairingDelegate * lane0 = commissioners.mPointers[0]->GetPairingDelegate();
+    DevicePairingDelegate * lane1 = commissioners.mPointers[1]->GetPairingDelegate();
+
+    // The second request that may use BLE waits for the first rendezvous, the on-network request after it does not.
+    NL_TEST_ASSERT(inSuite, pool.Commission(1, "MT:1", params, DiscoveryType::kAll) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.Commission(2, "MT:2", params, DiscoveryType::kAll) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.Commission(3, "MT:3", params) == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == 2);
+    NL_TEST_ASSERT(inSuite, pool.mStarted[0].nodeId == 1 && pool.mStarted[1].nodeId == 3);
+    NL_TEST_ASSERT(inSuite, pool.GetPendingCount() == 1);
+
+    // Establishing PASE ends the rendezvous, the request then only waits for a free commissioner.
+    lane0->OnPairingComplete(CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == 2);
+    lane1->OnCommissioningComplete(3, CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == 3);
+    NL_TEST_ASSERT(inSuite, pool.mStarted[2].nodeId == 2 && pool.mStarted[2].commissioner == commissioners.mPointers[1]);
+
+    // A free commissioner is not enough while another rendezvous is in progress.
+    NL_TEST_ASSERT(inSuite, pool.Commission(4, "MT:4", params, DiscoveryType::kAll) == CHIP_NO_ERROR);
+    lane0->OnCommissioningComplete(1, CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == 3);
+    NL_TEST_ASSERT(inSuite, pool.GetActiveCount() == 1);
+
+    // A failed rendezvous ends it as well.
+    lane1->OnPairingComplete(CHIP_ERROR_TIMEOUT);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, pool.mStarted.size() == 4 && pool.mStarted[3].nodeId == 4);
+    NL_TEST_ASSERT(inSuite, pool.mStarted[3].discoveryType == DiscoveryType::kAll);
+    NL_TEST_ASSERT(inSuite, pool.GetPendingCount() == 0);
+
+    pool.Shutdown();
+}
+
+void TestInitErrors(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(inContext);
+    Commissioners commissioners;
+    TestDelegate delegate;
+    RecordingCommissioningPool pool;
+
+    NL_TEST_ASSERT(inSuite, pool.Init(nullptr, commissioners.Get(), &delegate) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, pool.Init(&ctx.GetSystemLayer(), commissioners.Get(), nullptr) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   pool.Init(&ctx.GetSystemLayer(), Span<DeviceCommissioner * const>(), &delegate) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+
+    NL_TEST_ASSERT(inSuite, pool.Init(&ctx.GetSystemLayer(), commissioners.Get(), &delegate) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.Init(&ctx.GetSystemLayer(), commissioners.Get(), &delegate) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Flows run concurrently, one per commissioner", TestConcurrentFlows),
+    NL_TEST_DEF("Failed flows free their commissioner", TestFailures),
+    NL_TEST_DEF("BLE rendezvous run one at a time", TestBleRendezvous),
+    NL_TEST_DEF("Init validates its arguments", TestInitErrors),
+    NL_TEST_SENTINEL()
+};
+
+nlTestSuite sSuite =
+{
+    "TestCommissioningPool",
+    &sTests[0],
+    TestContext::nlTestSetUpTestSuite,
+    TestContext::nlTestTearDownTestSuite,
+    TestContext::nlTestSetUp,
+    TestContext::nlTestTearDown,
+};
+// clang-format on
+
+} // namespace
+
+int TestCommissioningPool()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCommissioningPool)
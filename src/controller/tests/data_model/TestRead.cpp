@@ -89,7 +89,7 @@ namespace chip {
 namespace app {
 CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                                  const ConcreteReadAttributePath & aPath, AttributeReportIBs::Builder & aAttributeReports,
-                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState)
+                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState, Optional<bool> aAccessAllowed)
 {
     if (aPath.mEndpointId >= chip::Test::kMockEndpointMin)
     {
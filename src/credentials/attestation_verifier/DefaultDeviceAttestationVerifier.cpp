@@ -320,6 +320,7 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     AttestationCertVidPid dacVidPid;
     AttestationCertVidPid paiVidPid;
     AttestationCertVidPid paaVidPid;
+    VerifiedPaiEntry * verifiedPai = nullptr;
 
     VerifyOrExit(!info.attestationElementsBuffer.empty() && !info.attestationChallengeBuffer.empty() &&
                      !info.attestationSignatureBuffer.empty() && !info.dacDerBuffer.empty() &&
@@ -332,9 +333,13 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     // Ensure PAI is present
     VerifyOrExit(!info.paiDerBuffer.empty(), attestationError = AttestationVerificationResult::kPaiMissing);
 
+    // A PAI that was part of a previous successful attestation is known to be well formed and to chain to a trusted PAA.
+    verifiedPai = FindVerifiedPai(info.paiDerBuffer);
+
     // Validate Proper Certificate Format
     {
-        VerifyOrExit(VerifyAttestationCertificateFormat(info.paiDerBuffer, AttestationCertType::kPAI) == CHIP_NO_ERROR,
+        VerifyOrExit(verifiedPai != nullptr ||
+                         VerifyAttestationCertificateFormat(info.paiDerBuffer, AttestationCertType::kPAI) == CHIP_NO_ERROR,
                      attestationError = AttestationVerificationResult::kPaiFormatInvalid);
         VerifyOrExit(VerifyAttestationCertificateFormat(info.dacDerBuffer, AttestationCertType::kDAC) == CHIP_NO_ERROR,
                      attestationError = AttestationVerificationResult::kDacFormatInvalid);
@@ -344,8 +349,15 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     {
         VerifyOrExit(ExtractVIDPIDFromX509Cert(info.dacDerBuffer, dacVidPid) == CHIP_NO_ERROR,
                      attestationError = AttestationVerificationResult::kDacFormatInvalid);
-        VerifyOrExit(ExtractVIDPIDFromX509Cert(info.paiDerBuffer, paiVidPid) == CHIP_NO_ERROR,
-                     attestationError = AttestationVerificationResult::kPaiFormatInvalid);
+        if (verifiedPai != nullptr)
+        {
+            paiVidPid = verifiedPai->mPaiVidPid;
+        }
+        else
+        {
+            VerifyOrExit(ExtractVIDPIDFromX509Cert(info.paiDerBuffer, paiVidPid) == CHIP_NO_ERROR,
+                         attestationError = AttestationVerificationResult::kPaiFormatInvalid);
+        }
         VerifyOrExit(paiVidPid.mVendorId.HasValue() && paiVidPid.mVendorId == dacVidPid.mVendorId,
                      attestationError = AttestationVerificationResult::kDacVendorIdMismatch);
         VerifyOrExit(dacVidPid.mProductId.HasValue(), attestationError = AttestationVerificationResult::kDacProductIdMismatch);
@@ -373,6 +385,12 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
                      attestationError = AttestationVerificationResult::kAttestationSignatureInvalid);
     }
 
+    if (verifiedPai != nullptr)
+    {
+        paaDerBuffer = MutableByteSpan(verifiedPai->mPaaDer, verifiedPai->mPaaDerLength);
+        paaVidPid    = verifiedPai->mPaaVidPid;
+    }
+    else
     {
         uint8_t akidBuf[Crypto::kAuthorityKeyIdentifierLength];
         MutableByteSpan akid(akidBuf);
@@ -436,11 +454,18 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
             .paaVendorId  = paaVidPid.mVendorId.ValueOr(VendorId::NotSpecified),
         };
 
-        MutableByteSpan paaSKID(deviceInfo.paaSKID);
-        VerifyOrExit(ExtractSKIDFromX509Cert(paaDerBuffer, paaSKID) == CHIP_NO_ERROR,
-                     attestationError = AttestationVerificationResult::kPaaFormatInvalid);
-        VerifyOrExit(paaSKID.size() == sizeof(deviceInfo.paaSKID),
-                     attestationError = AttestationVerificationResult::kPaaFormatInvalid);
+        if (verifiedPai != nullptr)
+        {
+            memcpy(deviceInfo.paaSKID, verifiedPai->mPaaSkid, sizeof(deviceInfo.paaSKID));
+        }
+        else
+        {
+            MutableByteSpan paaSKID(deviceInfo.paaSKID);
+            VerifyOrExit(ExtractSKIDFromX509Cert(paaDerBuffer, paaSKID) == CHIP_NO_ERROR,
+                         attestationError = AttestationVerificationResult::kPaaFormatInvalid);
+            VerifyOrExit(paaSKID.size() == sizeof(deviceInfo.paaSKID),
+                         attestationError = AttestationVerificationResult::kPaaFormatInvalid);
+        }
 
         VerifyOrExit(DeconstructAttestationElements(info.attestationElementsBuffer, certificationDeclarationSpan,
                                                     attestationNonceSpan, timestampDeconstructed, firmwareInfoSpan,
@@ -456,12 +481,79 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
 
         attestationError = ValidateCertificateDeclarationPayload(certificationDeclarationPayload, firmwareInfoSpan, deviceInfo);
         VerifyOrExit(attestationError == AttestationVerificationResult::kSuccess, attestationError = attestationError);
+
+        if (verifiedPai == nullptr)
+        {
+            AddVerifiedPai(info.paiDerBuffer, paaDerBuffer, paiVidPid, paaVidPid, deviceInfo.paaSKID);
+        }
     }
 
 exit:
     onCompletion->mCall(onCompletion->mContext, info, attestationError);
 }
 
+void DefaultDACVerifier::ClearVerifiedPaiCache()
+{
+    for (auto & entry : mVerifiedPaiCache)
+    {
+        entry.mPaiDerLength = 0;
+    }
+}
+
+size_t DefaultDACVerifier::GetVerifiedPaiCount() const
+{
+    size_t count = 0;
+    for (const auto & entry : mVerifiedPaiCache)
+    {
+        count += entry.IsEmpty() ? 0 : 1;
+    }
+    return count;
+}
+
+DefaultDACVerifier::VerifiedPaiEntry * DefaultDACVerifier::FindVerifiedPai(const ByteSpan & paiDer)
+{
+    for (auto & entry : mVerifiedPaiCache)
+    {
+        if (!entry.IsEmpty() && paiDer.data_equal(ByteSpan(entry.mPaiDer, entry.mPaiDerLength)))
+        {
+            entry.mLastUsed = ++mVerifiedPaiUseCounter;
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void DefaultDACVerifier::AddVerifiedPai(const ByteSpan & paiDer, const ByteSpan & paaDer, const AttestationCertVidPid & paiVidPid,
+                                        const AttestationCertVidPid & paaVidPid, const uint8_t * paaSkid)
+{
+    VerifyOrReturn(paiDer.size() <= kMaxDERCertLength && paaDer.size() <= kMaxDERCertLength);
+
+    // Replace an empty entry, or else the least recently used one.
+    VerifiedPaiEntry * entry = nullptr;
+    for (auto & candidate : mVerifiedPaiCache)
+    {
+        if (candidate.IsEmpty())
+        {
+            entry = &candidate;
+            break;
+        }
+        if (entry == nullptr || candidate.mLastUsed < entry->mLastUsed)
+        {
+            entry = &candidate;
+        }
+    }
+    VerifyOrReturn(entry != nullptr);
+
+    memcpy(entry->mPaiDer, paiDer.data(), paiDer.size());
+    entry->mPaiDerLength = paiDer.size();
+    memcpy(entry->mPaaDer, paaDer.data(), paaDer.size());
+    entry->mPaaDerLength = paaDer.size();
+    entry->mPaiVidPid    = paiVidPid;
+    entry->mPaaVidPid    = paaVidPid;
+    memcpy(entry->mPaaSkid, paaSkid, sizeof(entry->mPaaSkid));
+    entry->mLastUsed = ++mVerifiedPaiUseCounter;
+}
+
 AttestationVerificationResult DefaultDACVerifier::ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
                                                                                             ByteSpan & certDeclBuffer)
 {
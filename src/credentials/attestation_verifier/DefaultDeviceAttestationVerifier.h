@@ -17,6 +17,7 @@
 #pragma once
 
 #include <array>
+#include <credentials/CHIPCert.h>
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CHIPConfig.h>
@@ -76,11 +77,47 @@ public:
 
     CsaCdKeysTrustStore * GetCertificationDeclarationTrustStore() override { return &mCdKeysTrustStore; }
 
+    /**
+     * @brief Forget the PAI certificates remembered from previous successful attestations.
+     *
+     * Must be called if the PAA trust store changes, e.g. when a PAA is removed.
+     */
+    void ClearVerifiedPaiCache();
+
+    size_t GetVerifiedPaiCount() const;
+
 protected:
     DefaultDACVerifier() {}
 
+    /**
+     * A PAI certificate that was part of a successful attestation, along with the PAA it chains to and the values
+     * extracted from both. Devices presenting the same PAI skip the PAI format checks and the PAA lookup; the
+     * DAC is still validated against the full chain.
+     */
+    struct VerifiedPaiEntry
+    {
+        uint8_t mPaiDer[kMaxDERCertLength];
+        size_t mPaiDerLength = 0;
+        uint8_t mPaaDer[kMaxDERCertLength];
+        size_t mPaaDerLength = 0;
+        Crypto::AttestationCertVidPid mPaiVidPid;
+        Crypto::AttestationCertVidPid mPaaVidPid;
+        uint8_t mPaaSkid[Crypto::kSubjectKeyIdentifierLength];
+        uint32_t mLastUsed = 0;
+
+        bool IsEmpty() const { return mPaiDerLength == 0; }
+    };
+
+    VerifiedPaiEntry * FindVerifiedPai(const ByteSpan & paiDer);
+    void AddVerifiedPai(const ByteSpan & paiDer, const ByteSpan & paaDer, const Crypto::AttestationCertVidPid & paiVidPid,
+                        const Crypto::AttestationCertVidPid & paaVidPid, const uint8_t * paaSkid);
+
     CsaCdKeysTrustStore mCdKeysTrustStore;
     const AttestationTrustStore * mAttestationTrustStore;
+
+    static constexpr size_t kVerifiedPaiCacheSize = CHIP_CONFIG_DAC_VERIFIER_PAI_CACHE_SIZE;
+    std::array<VerifiedPaiEntry, kVerifiedPaiCacheSize> mVerifiedPaiCache;
+    uint32_t mVerifiedPaiUseCounter = 0;
 };
 
 /**
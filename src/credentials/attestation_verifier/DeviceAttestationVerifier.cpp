@@ -98,6 +98,15 @@ CHIP_ERROR DeviceAttestationVerifier::ValidateAttestationSignature(const P256Pub
     return CHIP_NO_ERROR;
 }
 
+void DeviceAttestationVerifier::VerifyAttestationInformationBatch(
+    const Span<const AttestationInfo> & infos, Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    for (const AttestationInfo & info : infos)
+    {
+        VerifyAttestationInformation(info, onCompletion);
+    }
+}
+
 DeviceAttestationVerifier * GetDeviceAttestationVerifier()
 {
     return gDacVerifier;
@@ -342,6 +342,19 @@ public:
     virtual void VerifyAttestationInformation(const AttestationInfo & info,
                                               Callback::Callback<OnAttestationInformationVerification> * onCompletion) = 0;
 
+    /**
+     * @brief Verify the attestation information of several devices, e.g. devices onboarded together.
+     *
+     * The result for each entry is provided through onCompletion, in order. The default implementation verifies
+     * the entries one at a time; verifiers that cache the PAI checks let devices sharing a PAI pay for them once.
+     *
+     * @param[in] infos        The attestation information of each device. The spans must remain valid until the
+     *                         result for the entry has been provided.
+     * @param[in] onCompletion Callback handler called once per entry of infos.
+     */
+    virtual void VerifyAttestationInformationBatch(const Span<const AttestationInfo> & infos,
+                                                   Callback::Callback<OnAttestationInformationVerification> * onCompletion);
+
     /**
      * @brief Verify a CMS Signed Data signature against the CSA certificate of Subject Key Identifier that matches
      *        the subjectKeyIdentifier field of cmsEnvelopeBuffer.
@@ -17,6 +17,7 @@
 #include "FileAttestationTrustStore.h"
 
 #include <crypto/CHIPCryptoPAL.h>
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <string>
@@ -48,6 +49,7 @@ FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStoreP
     {
         mPAADerCerts = LoadAllX509DerCerts(paaTrustStorePath);
         VerifyOrReturn(paaCount());
+        IndexPAACerts();
     }
 
     mIsInitialized = true;
@@ -138,9 +140,34 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
     Cleanup();
 }
 
+void FileAttestationTrustStore::IndexPAACerts()
+{
+    mPAAIndex.clear();
+    mPAAIndex.reserve(mPAADerCerts.size());
+
+    for (size_t i = 0; i < mPAADerCerts.size(); i++)
+    {
+        PAAIndexEntry entry;
+        MutableByteSpan skidSpan{ entry.skid };
+        ByteSpan certSpan{ mPAADerCerts[i].data(), mPAADerCerts[i].size() };
+        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(certSpan, skidSpan) || skidSpan.size() != entry.skid.size())
+        {
+            continue;
+        }
+        entry.certIndex = i;
+        mPAAIndex.push_back(entry);
+    }
+
+    // Stable, so that the first of several certificates with the same SKID is still the one found.
+    std::stable_sort(mPAAIndex.begin(), mPAAIndex.end(), [](const PAAIndexEntry & a, const PAAIndexEntry & b) {
+        return memcmp(a.skid.data(), b.skid.data(), a.skid.size()) < 0;
+    });
+}
+
 void FileAttestationTrustStore::Cleanup()
 {
     mPAADerCerts.clear();
+    mPAAIndex.clear();
     mIsInitialized = false;
 }
 
@@ -158,23 +185,13 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
-    {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
-        {
-            continue;
-        }
-
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
-    }
+    auto match = std::lower_bound(mPAAIndex.begin(), mPAAIndex.end(), skid, [](const PAAIndexEntry & entry, const ByteSpan & key) {
+        return memcmp(entry.skid.data(), key.data(), entry.skid.size()) < 0;
+    });
+    VerifyOrReturnError(match != mPAAIndex.end() && skid.data_equal(ByteSpan{ match->skid }), CHIP_ERROR_CA_CERT_NOT_FOUND);
 
-    return CHIP_ERROR_CA_CERT_NOT_FOUND;
+    const std::vector<uint8_t> & candidate = mPAADerCerts[match->certIndex];
+    return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
 }
 
 } // namespace Credentials
@@ -61,11 +61,25 @@ public:
     size_t paaCount() const { return mPAADerCerts.size(); };
 
 protected:
+    /**
+     * Index the PAA certificates by SKID. Must be called again after modifying mPAADerCerts.
+     */
+    void IndexPAACerts();
+
     std::vector<std::vector<uint8_t>> mPAADerCerts;
 
 private:
+    struct PAAIndexEntry
+    {
+        std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength> skid;
+        size_t certIndex;
+    };
+
     bool mIsInitialized = false;
 
+    // Sorted by SKID, so that a lookup does not have to parse every PAA certificate.
+    std::vector<PAAIndexEntry> mPAAIndex;
+
     void Cleanup();
 };
 
@@ -0,0 +1,63 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <inet/EndPointStateSockets.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS
+#include <sys/uio.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS
+
+#if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_SOCKETS
+#include <zephyr/net/socket.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_ZEPHYR_SOCKETS
+
+#include <algorithm>
+
+namespace chip {
+namespace Inet {
+
+size_t EndPointStateSockets::FillIOVecs(const System::PacketBufferHandle & buffers, struct iovec * iovs,
+                                        System::PacketBufferHandle * retained, size_t maxCount, size_t maxLength,
+                                        size_t & length)
+{
+    size_t count = 0;
+    length       = 0;
+
+    for (System::PacketBufferHandle buf = buffers.Retain(); !buf.IsNull() && count < maxCount && length < maxLength;
+         buf.Advance())
+    {
+        const size_t bufLen = std::min<size_t>(buf->DataLength(), maxLength - length);
+        if (bufLen == 0)
+        {
+            continue;
+        }
+
+        iovs[count].iov_base = buf->Start();
+        iovs[count].iov_len  = bufLen;
+        if (retained != nullptr)
+        {
+            retained[count] = buf.Retain();
+        }
+        count++;
+        length += bufLen;
+    }
+
+    return count;
+}
+
+} // namespace Inet
+} // namespace chip
@@ -26,6 +26,11 @@
 
 #include <inet/IPAddress.h>
 #include <system/SocketEvents.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <stddef.h>
+
+struct iovec;
 
 namespace chip {
 namespace Inet {
@@ -38,6 +43,22 @@ class DLL_EXPORT EndPointStateSockets
 protected:
     EndPointStateSockets() : mSocket(kInvalidSocketFd) {}
 
+    /**
+     * Describe the data of a packet buffer chain as an iovec array, for sendmsg(), without copying it.
+     *
+     * Empty buffers are skipped. The walk stops once `maxCount` entries are filled or `maxLength` bytes are
+     * described; the last entry may then cover only the start of its buffer.
+     *
+     * @param[in]  buffers    The chain to describe.
+     * @param[out] iovs       Array of at least `maxCount` entries.
+     * @param[out] retained   Optional array of at least `maxCount` handles, set to the buffer of each entry.
+     * @param[out] length     The number of bytes described.
+     *
+     * @return The number of entries filled.
+     */
+    static size_t FillIOVecs(const System::PacketBufferHandle & buffers, struct iovec * iovs,
+                             System::PacketBufferHandle * retained, size_t maxCount, size_t maxLength, size_t & length);
+
     static constexpr int kInvalidSocketFd = -1;
     int mSocket;                     /**< Encapsulated socket descriptor. */
     IPAddressType mAddrType;         /**< Protocol family, i.e. IPv4 or IPv6. */
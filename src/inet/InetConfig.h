@@ -232,6 +232,41 @@
 #define INET_CONFIG_DEFAULT_TCP_USER_TIMEOUT_MSEC          (5 * 60 * 1000)
 #endif // INET_CONFIG_DEFAULT_TCP_USER_TIMEOUT_MSEC
 
+/**
+ *  @def INET_CONFIG_SEND_IOV_MAX
+ *
+ *  @brief
+ *    The maximum number of packet buffers from a chain that the
+ *    sockets endpoints hand to a single sendmsg() call.
+ *
+ *  @details
+ *    The iovec array is allocated on the stack of the sending
+ *    function. A TCP send queue longer than this is sent over
+ *    several calls; a UDP message that is chained over more
+ *    buffers than this is rejected.
+ */
+#ifndef INET_CONFIG_SEND_IOV_MAX
+#define INET_CONFIG_SEND_IOV_MAX                           16
+#endif // INET_CONFIG_SEND_IOV_MAX
+
+/**
+ *  @def INET_CONFIG_TCP_ZEROCOPY_LINGER_TIMEOUT_MSEC
+ *
+ *  @brief
+ *    How long, in milliseconds, a gracefully closed TCP endpoint
+ *    waits for the completions of its zero-copy writes.
+ *
+ *  @details
+ *    The kernel may still transmit from the packet buffers of a
+ *    zero-copy write after the endpoint is closed, so the socket
+ *    is kept open, and the buffers held, until the completions
+ *    arrive. After this timeout, the connection is reset so that
+ *    the kernel drops the data before the buffers are released.
+ */
+#ifndef INET_CONFIG_TCP_ZEROCOPY_LINGER_TIMEOUT_MSEC
+#define INET_CONFIG_TCP_ZEROCOPY_LINGER_TIMEOUT_MSEC       5000
+#endif // INET_CONFIG_TCP_ZEROCOPY_LINGER_TIMEOUT_MSEC
+
 /**
  *  @def INET_CONFIG_IP_MULTICAST_HOP_LIMIT
  *
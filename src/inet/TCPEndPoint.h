@@ -260,6 +260,32 @@ public:
      */
     virtual CHIP_ERROR DisableKeepAlive() = 0;
 
+    /**
+     * @brief   Send large writes without copying them into the kernel.
+     *
+     * @param[in] minSendLength
+     *    Writes of at least this many bytes use zero-copy transmission; smaller ones are copied as usual.
+     *    Zero-copy only pays off for writes of about 10 KB and more.
+     *
+     * @retval  CHIP_NO_ERROR               success.
+     * @retval  CHIP_ERROR_INCORRECT_STATE  TCP connection not established.
+     * @retval  CHIP_ERROR_NOT_IMPLEMENTED  not supported by the platform.
+     *
+     * @retval  other                   another system or platform error
+     *
+     * @details
+     *  On Linux this uses MSG_ZEROCOPY: the packet buffers of a write are held until the kernel reports
+     *  that it no longer references them, rather than being freed once the data is queued. The kernel
+     *  falls back to copying when the route does not allow zero-copy (e.g. loopback), in which case the
+     *  endpoint stops using it.
+     *
+     *  When the endpoint is closed gracefully before all the completions have arrived, its socket is
+     *  kept open, and the buffers held, until they do, for at most
+     *  INET_CONFIG_TCP_ZEROCOPY_LINGER_TIMEOUT_MSEC; the connection is then reset. Aborting the
+     *  connection drops the data still queued in the kernel, and releases the buffers right away.
+     */
+    virtual CHIP_ERROR EnableZeroCopySend(uint16_t minSendLength) = 0;
+
     /**
      * @brief   Acknowledge receipt of message text.
      *
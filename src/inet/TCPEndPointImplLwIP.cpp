@@ -318,6 +318,12 @@ CHIP_ERROR TCPEndPointImplLwIP::DisableKeepAlive()
     return res;
 }
 
+CHIP_ERROR TCPEndPointImplLwIP::EnableZeroCopySend(uint16_t minSendLength)
+{
+    VerifyOrReturnError(IsConnected(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
 CHIP_ERROR TCPEndPointImplLwIP::SetUserTimeoutImpl(uint32_t userTimeoutMillis)
 {
     return CHIP_ERROR_NOT_IMPLEMENTED;
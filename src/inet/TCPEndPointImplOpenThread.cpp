@@ -54,6 +54,10 @@ CHIP_ERROR TCPEndPointImplOT::DisableKeepAlive()
 {
     return CHIP_ERROR_NOT_IMPLEMENTED;
 }
+CHIP_ERROR TCPEndPointImplOT::EnableZeroCopySend(uint16_t minSendLength)
+{
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
 CHIP_ERROR TCPEndPointImplOT::AckReceive(uint16_t len)
 {
     return CHIP_ERROR_NOT_IMPLEMENTED;
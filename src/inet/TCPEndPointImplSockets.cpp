@@ -25,11 +25,13 @@
 #include <inet/InetFaultInjection.h>
 #include <inet/arpa-inet-compatibility.h>
 
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <system/SystemFaultInjection.h>
 
+#include <algorithm>
 #include <stdio.h>
 #include <string.h>
 #include <utility>
@@ -41,8 +43,14 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#if INET_TCP_SOCKETS_ZEROCOPY
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#endif // INET_TCP_SOCKETS_ZEROCOPY
+
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
 #ifndef SOCK_CLOEXEC
 #define SOCK_CLOEXEC 0
@@ -67,6 +75,13 @@
 namespace chip {
 namespace Inet {
 
+#if INET_TCP_SOCKETS_ZEROCOPY
+namespace {
+// How often a closed endpoint checks for the completions of its zero-copy writes.
+constexpr System::Clock::Milliseconds32 kZeroCopyLingerPollInterval(50);
+} // namespace
+#endif // INET_TCP_SOCKETS_ZEROCOPY
+
 CHIP_ERROR TCPEndPointImplSockets::BindImpl(IPAddressType addrType, const IPAddress & addr, uint16_t port, bool reuseAddr)
 {
     CHIP_ERROR res = GetSocket(addrType);
@@ -441,6 +456,24 @@ CHIP_ERROR TCPEndPointImplSockets::DisableKeepAlive()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TCPEndPointImplSockets::EnableZeroCopySend(uint16_t minSendLength)
+{
+    VerifyOrReturnError(IsConnected(), CHIP_ERROR_INCORRECT_STATE);
+
+#if INET_TCP_SOCKETS_ZEROCOPY
+    int val = 1;
+    if (setsockopt(mSocket, SOL_SOCKET, SO_ZEROCOPY, &val, sizeof(val)) != 0)
+    {
+        return CHIP_ERROR_POSIX(errno);
+    }
+
+    mZeroCopyMinSendLength = std::max<uint16_t>(minSendLength, 1);
+    return CHIP_NO_ERROR;
+#else  // INET_TCP_SOCKETS_ZEROCOPY
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // INET_TCP_SOCKETS_ZEROCOPY
+}
+
 CHIP_ERROR TCPEndPointImplSockets::AckReceive(uint16_t len)
 {
     VerifyOrReturnError(IsConnected(), CHIP_ERROR_INCORRECT_STATE);
@@ -468,12 +501,6 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-#ifdef MSG_NOSIGNAL
-    const int sendFlags = MSG_NOSIGNAL;
-#else
-    const int sendFlags = 0;
-#endif
-
     // Pretend send() fails in the while loop below
     INET_FAULT_INJECT(FaultInjection::kFault_Send, {
         err = CHIP_ERROR_POSIX(EIO);
@@ -483,46 +510,62 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        uint16_t bufLen = mSendQueue->DataLength();
-
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        // Hand as much of the queue as possible to a single sendmsg(), straight from the packet buffers. The
+        // length is capped so that it can be reported through OnDataSent.
+        struct iovec iovs[INET_CONFIG_SEND_IOV_MAX];
+        System::PacketBufferHandle * retained = nullptr;
+#if INET_TCP_SOCKETS_ZEROCOPY
+        // Only the buffers of a zero-copy write are held past the sendmsg() call.
+        System::PacketBufferHandle zeroCopyBuffers[INET_CONFIG_SEND_IOV_MAX];
+        if (mZeroCopyMinSendLength != 0 && mSendQueue->TotalLength() >= mZeroCopyMinSendLength)
+        {
+            retained = zeroCopyBuffers;
+        }
+#endif // INET_TCP_SOCKETS_ZEROCOPY
+        size_t sendLength     = 0;
+        const size_t iovCount = FillIOVecs(mSendQueue, iovs, retained, INET_CONFIG_SEND_IOV_MAX, UINT16_MAX, sendLength);
 
-        if (lenSentRaw == -1)
+        uint16_t lenSent = 0;
+        if (sendLength > 0)
         {
-            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            ssize_t lenSentRaw = SendIOVecs(iovs, iovCount, sendLength, retained);
+
+            if (lenSentRaw == -1)
             {
-                err = (errno == EPIPE) ? INET_ERROR_PEER_DISCONNECTED : CHIP_ERROR_POSIX(errno);
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    err = (errno == EPIPE) ? INET_ERROR_PEER_DISCONNECTED : CHIP_ERROR_POSIX(errno);
+                }
+                break;
             }
-            break;
-        }
 
-        if (lenSentRaw < 0 || lenSentRaw > bufLen)
-        {
-            err = CHIP_ERROR_INCORRECT_STATE;
-            break;
-        }
+            if (lenSentRaw < 0 || static_cast<size_t>(lenSentRaw) > sendLength)
+            {
+                err = CHIP_ERROR_INCORRECT_STATE;
+                break;
+            }
 
-        // Cast is safe because bufLen is uint16_t.
-        uint16_t lenSent = static_cast<uint16_t>(lenSentRaw);
+            // Cast is safe because sendLength is at most UINT16_MAX.
+            lenSent = static_cast<uint16_t>(lenSentRaw);
 
-        // Mark the connection as being active.
-        MarkActive();
+            // Mark the connection as being active.
+            MarkActive();
 
-        if (lenSent < bufLen)
-        {
-            mSendQueue->ConsumeHead(lenSent);
+            mSendQueue.Consume(lenSent);
         }
         else
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            // Only empty buffers are left.
+            mSendQueue = nullptr;
+        }
+
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
@@ -558,7 +601,7 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         }
 #endif // INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
 
-        if (lenSent < bufLen)
+        if (lenSent < sendLength)
         {
             break;
         }
@@ -579,6 +622,59 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
     return err;
 }
 
+ssize_t TCPEndPointImplSockets::SendIOVecs(struct iovec * iovs, size_t iovCount, size_t length,
+                                           System::PacketBufferHandle * retained)
+{
+#ifdef MSG_NOSIGNAL
+    const int sendFlags = MSG_NOSIGNAL;
+#else
+    const int sendFlags = 0;
+#endif
+
+    struct msghdr msgHeader;
+    memset(&msgHeader, 0, sizeof(msgHeader));
+    msgHeader.msg_iov    = iovs;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
+
+#if INET_TCP_SOCKETS_ZEROCOPY
+    if (retained != nullptr && mZeroCopyMinSendLength != 0 && length >= mZeroCopyMinSendLength)
+    {
+        // Drain the completions first, so that the buffers they hold can be reused right away.
+        ReapZeroCopyCompletions();
+
+        // The record is allocated up front: once the kernel has taken the pages, the buffers must be held.
+        ZeroCopySend * zeroCopySend = Platform::New<ZeroCopySend>();
+        if (zeroCopySend != nullptr)
+        {
+            ssize_t lenSent = sendmsg(mSocket, &msgHeader, sendFlags | MSG_ZEROCOPY);
+            if (lenSent > 0)
+            {
+                zeroCopySend->mId = mZeroCopyNextId++;
+                for (size_t i = 0; i < iovCount; i++)
+                {
+                    zeroCopySend->mBuffers[i] = std::move(retained[i]);
+                }
+                zeroCopySend->mpNext = mpZeroCopySends;
+                mpZeroCopySends      = zeroCopySend;
+                return lenSent;
+            }
+
+            const int sendErrno = errno;
+            Platform::Delete(zeroCopySend);
+
+            // ENOBUFS means the socket is out of option memory for the notifications; copy instead.
+            if (lenSent == 0 || sendErrno != ENOBUFS)
+            {
+                errno = sendErrno;
+                return lenSent;
+            }
+        }
+    }
+#endif // INET_TCP_SOCKETS_ZEROCOPY
+
+    return sendmsg(mSocket, &msgHeader, sendFlags);
+}
+
 void TCPEndPointImplSockets::HandleConnectCompleteImpl()
 {
     // Wait for ability to read or write on this endpoint.
@@ -598,6 +694,11 @@ void TCPEndPointImplSockets::DoCloseImpl(CHIP_ERROR err, State oldState)
 {
     struct linger lingerStruct;
 
+#if INET_TCP_SOCKETS_ZEROCOPY
+    // The socket is only kept open until the zero-copy writes complete.
+    VerifyOrReturn(mZeroCopyLingerDeadline == System::Clock::kZero);
+#endif // INET_TCP_SOCKETS_ZEROCOPY
+
     // If the socket hasn't been closed already...
     if (mSocket != kInvalidSocketFd)
     {
@@ -606,8 +707,10 @@ void TCPEndPointImplSockets::DoCloseImpl(CHIP_ERROR err, State oldState)
         // THEN close the socket.
         if (mState == State::kClosed || (mState == State::kClosing && mSendQueue.IsNull()))
         {
+            const bool aborting = IsConnected(oldState) && err != CHIP_NO_ERROR;
+
             // If aborting the connection, ensure we send a TCP RST.
-            if (IsConnected(oldState) && err != CHIP_NO_ERROR)
+            if (aborting)
             {
                 lingerStruct.l_onoff  = 1;
                 lingerStruct.l_linger = 0;
@@ -619,12 +722,159 @@ void TCPEndPointImplSockets::DoCloseImpl(CHIP_ERROR err, State oldState)
             }
 
             static_cast<System::LayerSockets &>(GetSystemLayer()).StopWatchingSocket(&mWatch);
+
+#if INET_TCP_SOCKETS_ZEROCOPY
+            // A reset drops the data queued in the kernel. Otherwise the kernel keeps transmitting from the buffers of
+            // the zero-copy writes that have not completed, so they must outlive the endpoint.
+            if (!aborting && StartZeroCopyLinger())
+            {
+                return;
+            }
+#endif // INET_TCP_SOCKETS_ZEROCOPY
+
             close(mSocket);
             mSocket = kInvalidSocketFd;
+
+#if INET_TCP_SOCKETS_ZEROCOPY
+            ReleaseAllZeroCopySends();
+#endif // INET_TCP_SOCKETS_ZEROCOPY
         }
     }
 }
 
+#if INET_TCP_SOCKETS_ZEROCOPY
+void TCPEndPointImplSockets::ReapZeroCopyCompletions()
+{
+    while (mpZeroCopySends != nullptr)
+    {
+        uint8_t controlData[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_in6))];
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_control    = controlData;
+        msgHeader.msg_controllen = sizeof(controlData);
+
+        // Fails with EAGAIN once the error queue is empty.
+        if (recvmsg(mSocket, &msgHeader, MSG_ERRQUEUE) == -1)
+        {
+            break;
+        }
+
+        for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+             controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+        {
+            if (!(controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_RECVERR) &&
+                !(controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_RECVERR))
+            {
+                continue;
+            }
+
+            struct sock_extended_err extendedErr;
+            memcpy(&extendedErr, CMSG_DATA(controlHdr), sizeof(extendedErr));
+            if (extendedErr.ee_errno != 0 || extendedErr.ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+            {
+                continue;
+            }
+
+            if ((extendedErr.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0 && mZeroCopyMinSendLength != 0)
+            {
+                // The kernel copied the data anyway, e.g. over loopback; only the bookkeeping is left.
+                ChipLogDetail(Inet, "Zero-copy send not supported on this route, disabling it");
+                mZeroCopyMinSendLength = 0;
+            }
+
+            // Notifications cover the inclusive range of write ids [ee_info, ee_data].
+            ReleaseZeroCopySends(extendedErr.ee_info, extendedErr.ee_data);
+        }
+    }
+}
+
+void TCPEndPointImplSockets::ReleaseZeroCopySends(uint32_t firstId, uint32_t lastId)
+{
+    ZeroCopySend ** link = &mpZeroCopySends;
+    while (*link != nullptr)
+    {
+        ZeroCopySend * zeroCopySend = *link;
+        // Ids wrap around, so compare offsets from the start of the range.
+        if (static_cast<uint32_t>(zeroCopySend->mId - firstId) <= static_cast<uint32_t>(lastId - firstId))
+        {
+            *link = zeroCopySend->mpNext;
+            Platform::Delete(zeroCopySend);
+        }
+        else
+        {
+            link = &zeroCopySend->mpNext;
+        }
+    }
+}
+
+bool TCPEndPointImplSockets::StartZeroCopyLinger()
+{
+    ReapZeroCopyCompletions();
+    VerifyOrReturnValue(mpZeroCopySends != nullptr, false);
+
+    // Keep the socket open, and the endpoint alive, until the completions arrive, and send the FIN that close()
+    // would have sent.
+    CHIP_ERROR err = GetSystemLayer().StartTimer(kZeroCopyLingerPollInterval, HandleZeroCopyLingerTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to wait for the zero-copy sends: %" CHIP_ERROR_FORMAT, err.Format());
+        return false;
+    }
+    shutdown(mSocket, SHUT_WR);
+    mZeroCopyLingerDeadline =
+        System::SystemClock().GetMonotonicTimestamp() + System::Clock::Milliseconds32(INET_CONFIG_TCP_ZEROCOPY_LINGER_TIMEOUT_MSEC);
+    Retain();
+    return true;
+}
+
+void TCPEndPointImplSockets::HandleZeroCopyLingerTimer(System::Layer * systemLayer, void * appState)
+{
+    static_cast<TCPEndPointImplSockets *>(appState)->ContinueZeroCopyLinger();
+}
+
+void TCPEndPointImplSockets::ContinueZeroCopyLinger()
+{
+    ReapZeroCopyCompletions();
+
+    if (mpZeroCopySends != nullptr)
+    {
+        if (System::SystemClock().GetMonotonicTimestamp() < mZeroCopyLingerDeadline &&
+            GetSystemLayer().StartTimer(kZeroCopyLingerPollInterval, HandleZeroCopyLingerTimer, this) == CHIP_NO_ERROR)
+        {
+            return;
+        }
+
+        // Reset the connection, so that the kernel drops the data before the buffers are released.
+        ChipLogError(Inet, "Zero-copy sends did not complete, resetting the connection");
+        struct linger lingerStruct;
+        lingerStruct.l_onoff  = 1;
+        lingerStruct.l_linger = 0;
+        if (setsockopt(mSocket, SOL_SOCKET, SO_LINGER, &lingerStruct, sizeof(lingerStruct)) != 0)
+        {
+            ChipLogError(Inet, "SO_LINGER: %d", errno);
+        }
+    }
+
+    close(mSocket);
+    mSocket = kInvalidSocketFd;
+    ReleaseAllZeroCopySends();
+    Release();
+}
+
+void TCPEndPointImplSockets::ReleaseAllZeroCopySends()
+{
+    while (mpZeroCopySends != nullptr)
+    {
+        ZeroCopySend * next = mpZeroCopySends->mpNext;
+        Platform::Delete(mpZeroCopySends);
+        mpZeroCopySends = next;
+    }
+    mZeroCopyMinSendLength  = 0;
+    mZeroCopyNextId         = 0;
+    mZeroCopyLingerDeadline = System::Clock::kZero;
+}
+#endif // INET_TCP_SOCKETS_ZEROCOPY
+
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
 void TCPEndPointImplSockets::TCPUserTimeoutHandler()
 {
@@ -781,6 +1031,14 @@ void TCPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
     // Prevent the end point from being freed while in the middle of a callback.
     Retain();
 
+#if INET_TCP_SOCKETS_ZEROCOPY
+    // Zero-copy completions make the socket readable and writable, whatever the endpoint is waiting for.
+    if (mpZeroCopySends != nullptr)
+    {
+        ReapZeroCopyCompletions();
+    }
+#endif // INET_TCP_SOCKETS_ZEROCOPY
+
     // If in the Listening state, and the app is ready to receive a connection, and there is a connection
     // ready to be received on the socket, process the incoming connection.
     if (mState == State::kListening)
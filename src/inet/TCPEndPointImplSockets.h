@@ -25,6 +25,19 @@
 #include <inet/EndPointStateSockets.h>
 #include <inet/TCPEndPoint.h>
 
+#if CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS && defined(__linux__)
+#include <sys/socket.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS && defined(__linux__)
+
+#include <sys/types.h>
+
+// Zero-copy transmission, with completion notifications on the socket error queue (Linux 4.14 and later).
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+#define INET_TCP_SOCKETS_ZEROCOPY 1
+#else
+#define INET_TCP_SOCKETS_ZEROCOPY 0
+#endif
+
 namespace chip {
 namespace Inet {
 
@@ -46,6 +59,7 @@ public:
     CHIP_ERROR EnableNoDelay() override;
     CHIP_ERROR EnableKeepAlive(uint16_t interval, uint16_t timeoutCount) override;
     CHIP_ERROR DisableKeepAlive() override;
+    CHIP_ERROR EnableZeroCopySend(uint16_t minSendLength) override;
     CHIP_ERROR AckReceive(uint16_t len) override;
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
     void TCPUserTimeoutHandler() override;
@@ -69,6 +83,32 @@ private:
     void HandleIncomingConnection();
     CHIP_ERROR BindSrcAddrFromIntf(IPAddressType addrType, InterfaceId intfId);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
+    // `retained` holds the buffers of the write if it may use zero-copy, and is null otherwise.
+    ssize_t SendIOVecs(struct iovec * iovs, size_t iovCount, size_t length, System::PacketBufferHandle * retained);
+
+#if INET_TCP_SOCKETS_ZEROCOPY
+    /// The buffers of a zero-copy write, held until the kernel reports its completion.
+    struct ZeroCopySend
+    {
+        uint32_t mId;
+        System::PacketBufferHandle mBuffers[INET_CONFIG_SEND_IOV_MAX];
+        ZeroCopySend * mpNext = nullptr;
+    };
+
+    void ReapZeroCopyCompletions();
+    void ReleaseZeroCopySends(uint32_t firstId, uint32_t lastId);
+    void ReleaseAllZeroCopySends();
+    bool StartZeroCopyLinger();
+    void ContinueZeroCopyLinger();
+    static void HandleZeroCopyLingerTimer(System::Layer * systemLayer, void * appState);
+
+    uint16_t mZeroCopyMinSendLength = 0;       ///< Minimum length of a zero-copy write; 0 if zero-copy is disabled.
+    uint32_t mZeroCopyNextId        = 0;       ///< Id the kernel assigns to the next zero-copy write.
+    ZeroCopySend * mpZeroCopySends  = nullptr; ///< Zero-copy writes waiting for their completion.
+
+    /// When a closed endpoint stops waiting for the completions of its zero-copy writes; zero unless it is waiting.
+    System::Clock::Timestamp mZeroCopyLingerDeadline = System::Clock::kZero;
+#endif // INET_TCP_SOCKETS_ZEROCOPY
 
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
     /// This counts the number of bytes written on the TCP socket since thelast probe into the TCP outqueue was made.
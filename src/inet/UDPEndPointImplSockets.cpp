@@ -290,12 +290,11 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
-
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
+    // Send the buffers of a chained message as they are, with one iovec each.
+    struct iovec msgIOVs[INET_CONFIG_SEND_IOV_MAX];
+    size_t msgLength      = 0;
+    const size_t iovCount = FillIOVecs(msg, msgIOVs, nullptr, INET_CONFIG_SEND_IOV_MAX, msg->TotalLength(), msgLength);
+    VerifyOrReturnError(msgLength == msg->TotalLength(), CHIP_ERROR_MESSAGE_TOO_LONG);
 
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
     uint8_t controlData[256];
@@ -304,8 +303,8 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
 
     struct msghdr msgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    msgHeader.msg_iov    = msgIOVs;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
     SockAddr peerSockAddr;
@@ -416,7 +415,7 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     {
         return CHIP_ERROR_POSIX(errno);
     }
-    if (lenSent != msg->DataLength())
+    if (static_cast<size_t>(lenSent) != msgLength)
     {
         return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     }
@@ -326,6 +326,8 @@ static void TestInetEndPointInternal(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
     err = testTCPEP1->DisableKeepAlive();
     NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
+    err = testTCPEP1->EnableZeroCopySend(16 * 1024);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
     err = testTCPEP1->AckReceive(10);
     NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
     NL_TEST_ASSERT(inSuite, !testTCPEP1->PendingReceiveLength());
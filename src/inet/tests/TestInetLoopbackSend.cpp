@@ -0,0 +1,494 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *     This file implements a unit test suite for sending chained packet buffers
+ *     over loopback sockets.
+ *
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+#include <inet/IPAddress.h>
+#include <inet/InetError.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <system/SystemClock.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <nlunit-test.h>
+
+#include "TestInetCommon.h"
+
+using namespace chip;
+using namespace chip::Inet;
+using namespace chip::System;
+
+namespace {
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+// Every message is a chain of kChainLength buffers, so that the sends walk buffer chains.
+constexpr size_t kChainLength     = 4;
+constexpr uint16_t kBufferSize    = 1024;
+constexpr uint16_t kUDPBufferSize = 256;
+
+// Amount of data sent over TCP, and bound on the data queued in the endpoint: pool buffers are few, so that
+// the receiver must be left some.
+constexpr uint32_t kTransferSize  = 64 * 1024;
+constexpr uint32_t kMaxQueuedSize = kChainLength * kBufferSize;
+
+// Every chain is large enough for zero-copy, where the platform supports it.
+constexpr uint16_t kMinZeroCopyLength = kBufferSize;
+
+constexpr System::Clock::Milliseconds32 kTimeout = System::Clock::Seconds32(5);
+
+// Socket buffer sizes that make the kernel queue the data the receiver does not read on the sending side, and the
+// amount of data that fills the receive window.
+constexpr int kStalledReceiveBufferSize = 4096;
+constexpr int kStalledSendBufferSize    = 256 * 1024;
+constexpr uint32_t kStallSize           = 64 * 1024;
+
+// How long a closed endpoint is watched for releasing its zero-copy buffers too early: several linger polls.
+constexpr System::Clock::Milliseconds32 kLingerCheckTime(250);
+
+// Ask the kernel for a TCP port that is free on the IPv6 loopback, so that the tests do not rely on a fixed one.
+uint16_t GetFreeTCPPort()
+{
+    uint16_t port = 0;
+    int fd        = socket(AF_INET6, SOCK_STREAM, 0);
+    VerifyOrReturnValue(fd >= 0, 0);
+
+    struct sockaddr_in6 addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin6_family = AF_INET6;
+    addr.sin6_addr   = in6addr_loopback;
+    socklen_t len    = sizeof(addr);
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0 &&
+        getsockname(fd, reinterpret_cast<struct sockaddr *>(&addr), &len) == 0)
+    {
+        port = ntohs(addr.sin6_port);
+    }
+    close(fd);
+    return port;
+}
+
+// The endpoints do not expose their sockets, so find the TCP socket with the given local and peer ports. A zero local
+// port matches any, and a zero peer port only matches sockets that are not connected.
+int FindTCPSocket(uint16_t localPort, uint16_t peerPort)
+{
+    for (int fd = 0; fd < FD_SETSIZE; fd++)
+    {
+        struct sockaddr_in6 addr;
+        socklen_t len = sizeof(addr);
+        if (getsockname(fd, reinterpret_cast<struct sockaddr *>(&addr), &len) != 0 || addr.sin6_family != AF_INET6 ||
+            (localPort != 0 && ntohs(addr.sin6_port) != localPort))
+        {
+            continue;
+        }
+
+        len                 = sizeof(addr);
+        const bool hasPeer = getpeername(fd, reinterpret_cast<struct sockaddr *>(&addr), &len) == 0;
+        if ((peerPort == 0 && !hasPeer) || (peerPort != 0 && hasPeer && ntohs(addr.sin6_port) == peerPort))
+        {
+            int type = 0;
+            len      = sizeof(type);
+            if (getsockopt(fd, SOL_SOCKET, SO_TYPE, &type, &len) == 0 && type == SOCK_STREAM)
+            {
+                return fd;
+            }
+        }
+    }
+    return -1;
+}
+
+// Fill a chain of kChainLength buffers with the bytes of the stream starting at `offset`.
+PacketBufferHandle NewChain(uint32_t & offset, uint16_t bufferSize)
+{
+    const uint32_t startOffset = offset;
+    PacketBufferHandle chain;
+    for (size_t i = 0; i < kChainLength; i++)
+    {
+        PacketBufferHandle buffer = PacketBufferHandle::New(bufferSize, 0);
+        if (buffer.IsNull())
+        {
+            offset = startOffset;
+            return nullptr;
+        }
+        uint8_t * data = buffer->Start();
+        for (uint16_t j = 0; j < bufferSize; j++)
+        {
+            data[j] = static_cast<uint8_t>(offset++);
+        }
+        buffer->SetDataLength(bufferSize);
+
+        if (chain.IsNull())
+        {
+            chain = std::move(buffer);
+        }
+        else
+        {
+            chain->AddToEnd(std::move(buffer));
+        }
+    }
+    return chain;
+}
+
+bool CheckChain(const PacketBufferHandle & chain, uint32_t & offset)
+{
+    for (PacketBufferHandle buffer = chain.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        const uint8_t * data = buffer->Start();
+        for (uint16_t j = 0; j < buffer->DataLength(); j++)
+        {
+            if (data[j] != static_cast<uint8_t>(offset++))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+struct TransferState
+{
+    TCPEndPoint * mListener = nullptr;
+    TCPEndPoint * mSender   = nullptr;
+    TCPEndPoint * mReceiver = nullptr;
+    bool mConnected         = false;
+    bool mPeerClosed        = false;
+    bool mFailed            = false;
+    uint32_t mSent          = 0;
+    uint32_t mReceived      = 0;
+};
+
+TransferState sTransfer;
+
+void HandleConnectionReceived(TCPEndPoint * listeningEndPoint, TCPEndPoint * endPoint, const IPAddress & peerAddr,
+                              uint16_t peerPort)
+{
+    sTransfer.mReceiver      = endPoint;
+    endPoint->OnDataReceived = [](TCPEndPoint * receiver, PacketBufferHandle && data) -> CHIP_ERROR {
+        // Take the data out of the receive queue.
+        PacketBufferHandle received = std::move(data);
+        if (!CheckChain(received, sTransfer.mReceived))
+        {
+            sTransfer.mFailed = true;
+        }
+        return CHIP_NO_ERROR;
+    };
+    endPoint->OnPeerClose = [](TCPEndPoint * receiver) { sTransfer.mPeerClosed = true; };
+}
+
+void HandleAcceptError(TCPEndPoint * endPoint, CHIP_ERROR err)
+{
+    sTransfer.mFailed = true;
+}
+
+void HandleConnectComplete(TCPEndPoint * endPoint, CHIP_ERROR err)
+{
+    sTransfer.mConnected = (err == CHIP_NO_ERROR);
+    sTransfer.mFailed    = sTransfer.mFailed || (err != CHIP_NO_ERROR);
+}
+
+template <typename Predicate>
+bool ServiceNetworkUntil(Predicate done)
+{
+    const Clock::Timestamp deadline = SystemClock().GetMonotonicTimestamp() + kTimeout;
+    while (!done() && !sTransfer.mFailed && SystemClock().GetMonotonicTimestamp() < deadline)
+    {
+        ServiceNetwork(0);
+    }
+    return done();
+}
+
+void ServiceNetworkFor(Clock::Milliseconds32 duration)
+{
+    const Clock::Timestamp deadline = SystemClock().GetMonotonicTimestamp() + duration;
+    while (SystemClock().GetMonotonicTimestamp() < deadline)
+    {
+        ServiceNetwork(0);
+    }
+}
+
+void CloseTransfer()
+{
+    if (sTransfer.mSender != nullptr)
+    {
+        sTransfer.mSender->Free();
+    }
+    if (sTransfer.mReceiver != nullptr)
+    {
+        sTransfer.mReceiver->Free();
+    }
+    if (sTransfer.mListener != nullptr)
+    {
+        sTransfer.mListener->Free();
+    }
+    sTransfer = TransferState();
+}
+
+// Connect a sender to a receiver over loopback, and return the port of the connection, or 0 on failure. A non-zero
+// receiveBufferSize sets the receive buffer of the receiving socket.
+uint16_t OpenTransfer(nlTestSuite * inSuite, int receiveBufferSize = 0)
+{
+    IPAddress loopback;
+    NL_TEST_ASSERT(inSuite, IPAddress::FromString("::1", loopback));
+
+    sTransfer = TransferState();
+
+    NL_TEST_ASSERT(inSuite, gTCP.NewEndPoint(&sTransfer.mListener) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gTCP.NewEndPoint(&sTransfer.mSender) == CHIP_NO_ERROR);
+    if (sTransfer.mListener == nullptr || sTransfer.mSender == nullptr)
+    {
+        CloseTransfer();
+        return 0;
+    }
+
+    sTransfer.mListener->OnConnectionReceived = HandleConnectionReceived;
+    sTransfer.mListener->OnAcceptError        = HandleAcceptError;
+    const uint16_t port = GetFreeTCPPort();
+    NL_TEST_ASSERT(inSuite, port != 0);
+    NL_TEST_ASSERT(inSuite, sTransfer.mListener->Bind(IPAddressType::kIPv6, loopback, port, true) == CHIP_NO_ERROR);
+    if (receiveBufferSize != 0)
+    {
+        // Accepted sockets inherit the receive buffer of the listening socket, and with it their receive window.
+        const int listenerSocket = FindTCPSocket(port, 0);
+        NL_TEST_ASSERT(inSuite, listenerSocket >= 0);
+        NL_TEST_ASSERT(inSuite,
+                       setsockopt(listenerSocket, SOL_SOCKET, SO_RCVBUF, &receiveBufferSize, sizeof(receiveBufferSize)) == 0);
+    }
+    NL_TEST_ASSERT(inSuite, sTransfer.mListener->Listen(1) == CHIP_NO_ERROR);
+
+    sTransfer.mSender->OnConnectComplete = HandleConnectComplete;
+    NL_TEST_ASSERT(inSuite, sTransfer.mSender->Connect(loopback, port) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ServiceNetworkUntil([] { return sTransfer.mConnected && sTransfer.mReceiver != nullptr; }));
+    if (!sTransfer.mConnected || sTransfer.mReceiver == nullptr)
+    {
+        CloseTransfer();
+        return 0;
+    }
+    return port;
+}
+
+// Send kTransferSize bytes over loopback, then close the sending endpoint gracefully, possibly while zero-copy
+// writes are still in flight: the receiver must get all the data, intact, then the end of the stream.
+void RunTCPTransfer(nlTestSuite * inSuite, bool zeroCopy)
+{
+    VerifyOrReturn(OpenTransfer(inSuite) != 0);
+
+    if (zeroCopy)
+    {
+        CHIP_ERROR err = sTransfer.mSender->EnableZeroCopySend(kMinZeroCopyLength);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR || err == CHIP_ERROR_NOT_IMPLEMENTED);
+    }
+
+    const Clock::Timestamp deadline = SystemClock().GetMonotonicTimestamp() + kTimeout;
+    while (sTransfer.mSent < kTransferSize && !sTransfer.mFailed && SystemClock().GetMonotonicTimestamp() < deadline)
+    {
+        while (sTransfer.mSent < kTransferSize && sTransfer.mSender->PendingSendLength() < kMaxQueuedSize)
+        {
+            PacketBufferHandle chain = NewChain(sTransfer.mSent, kBufferSize);
+            if (chain.IsNull())
+            {
+                break;
+            }
+            if (sTransfer.mSender->Send(std::move(chain), true) != CHIP_NO_ERROR)
+            {
+                sTransfer.mFailed = true;
+                break;
+            }
+        }
+        ServiceNetwork(0);
+    }
+    NL_TEST_ASSERT(inSuite, sTransfer.mSent == kTransferSize);
+
+    // The sender is freed as soon as it is closed.
+    sTransfer.mSender->Free();
+    sTransfer.mSender = nullptr;
+
+    NL_TEST_ASSERT(inSuite, ServiceNetworkUntil([] { return sTransfer.mPeerClosed; }));
+    NL_TEST_ASSERT(inSuite, !sTransfer.mFailed);
+    NL_TEST_ASSERT(inSuite, sTransfer.mReceived == kTransferSize);
+
+    CloseTransfer();
+}
+
+void TestTCPChainedSend(nlTestSuite * inSuite, void * inContext)
+{
+    RunTCPTransfer(inSuite, false);
+}
+
+void TestTCPZeroCopySend(nlTestSuite * inSuite, void * inContext)
+{
+    RunTCPTransfer(inSuite, true);
+}
+
+// Close the sender while the kernel still holds a zero-copy write that it cannot transmit, because the receiver does
+// not read and its receive window is full: the closed endpoint must keep the buffers of the write until its completion
+// arrives, and release them then.
+void TestTCPZeroCopyCloseWithPendingCompletions(nlTestSuite * inSuite, void * inContext)
+{
+    const uint16_t port = OpenTransfer(inSuite, kStalledReceiveBufferSize);
+    VerifyOrReturn(port != 0);
+    sTransfer.mReceiver->DisableReceive();
+
+    // Leave the kernel room to queue all the data on the sending side.
+    const int senderSocket = FindTCPSocket(0, port);
+    NL_TEST_ASSERT(inSuite, senderSocket >= 0);
+    NL_TEST_ASSERT(inSuite,
+                   setsockopt(senderSocket, SOL_SOCKET, SO_SNDBUF, &kStalledSendBufferSize, sizeof(kStalledSendBufferSize)) == 0);
+
+    // Fill the receive window with copied writes first, so that the zero-copy write waits in the kernel behind them.
+    while (sTransfer.mSent < kStallSize && !sTransfer.mFailed)
+    {
+        PacketBufferHandle chain = NewChain(sTransfer.mSent, kBufferSize);
+        NL_TEST_EXIT_ON_FAILED_ASSERT(inSuite, !chain.IsNull());
+        sTransfer.mFailed = sTransfer.mSender->Send(std::move(chain), true) != CHIP_NO_ERROR;
+        ServiceNetwork(0);
+    }
+    NL_TEST_ASSERT(inSuite, ServiceNetworkUntil([] { return sTransfer.mSender->PendingSendLength() == 0; }));
+
+    CHIP_ERROR err = sTransfer.mSender->EnableZeroCopySend(kMinZeroCopyLength);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR || err == CHIP_ERROR_NOT_IMPLEMENTED);
+
+    PacketBufferHandle chain = NewChain(sTransfer.mSent, kBufferSize);
+    NL_TEST_EXIT_ON_FAILED_ASSERT(inSuite, !chain.IsNull());
+    PacketBufferHandle sentBuffer = chain.Retain();
+    NL_TEST_ASSERT(inSuite, sTransfer.mSender->Send(std::move(chain), true) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ServiceNetworkUntil([] { return sTransfer.mSender->PendingSendLength() == 0; }));
+
+    sTransfer.mSender->Free();
+    sTransfer.mSender = nullptr;
+
+    if (err == CHIP_NO_ERROR)
+    {
+        // No completion can arrive while the window is closed, so the closed endpoint still shares the buffer.
+        ServiceNetworkFor(kLingerCheckTime);
+        NL_TEST_ASSERT(inSuite, !sentBuffer.HasSoleOwnership());
+    }
+
+    // Once the receiver reads, the kernel transmits the write and the endpoint releases the buffer when its completion
+    // arrives, before giving up on the completions and resetting the connection.
+    sTransfer.mReceiver->EnableReceive();
+    NL_TEST_ASSERT(inSuite, ServiceNetworkUntil([&sentBuffer] { return sTransfer.mPeerClosed && sentBuffer.HasSoleOwnership(); }));
+    NL_TEST_ASSERT(inSuite, !sTransfer.mFailed);
+    NL_TEST_ASSERT(inSuite, sTransfer.mReceived == sTransfer.mSent);
+
+    sentBuffer = nullptr;
+    CloseTransfer();
+}
+
+uint32_t sUDPReceived = 0;
+bool sUDPMatched      = false;
+
+void TestUDPChainedSend(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress loopback;
+    NL_TEST_ASSERT(inSuite, IPAddress::FromString("::1", loopback));
+
+    UDPEndPoint * endPoint = nullptr;
+    NL_TEST_ASSERT(inSuite, gUDP.NewEndPoint(&endPoint) == CHIP_NO_ERROR);
+    NL_TEST_EXIT_ON_FAILED_ASSERT(inSuite, endPoint != nullptr);
+
+    NL_TEST_ASSERT(inSuite, endPoint->Bind(IPAddressType::kIPv6, loopback, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(
+        inSuite,
+        endPoint->Listen(
+            [](UDPEndPoint *, PacketBufferHandle && msg, const IPPacketInfo *) {
+                uint32_t offset = 0;
+                sUDPMatched     = CheckChain(msg, offset);
+                sUDPReceived    = msg->TotalLength();
+            },
+            nullptr) == CHIP_NO_ERROR);
+
+    // A message chained over several buffers is sent as a single datagram.
+    uint32_t offset          = 0;
+    PacketBufferHandle chain = NewChain(offset, kUDPBufferSize);
+    NL_TEST_ASSERT(inSuite, !chain.IsNull() && chain->HasChainedBuffer());
+    NL_TEST_ASSERT(inSuite, endPoint->SendTo(loopback, endPoint->GetBoundPort(), std::move(chain)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ServiceNetworkUntil([] { return sUDPReceived != 0; }));
+    NL_TEST_ASSERT(inSuite, sUDPReceived == offset);
+    NL_TEST_ASSERT(inSuite, sUDPMatched);
+
+    endPoint->Free();
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("InetLoopback::UDPChainedSend", TestUDPChainedSend),
+                          NL_TEST_DEF("InetLoopback::TCPChainedSend", TestTCPChainedSend),
+                          NL_TEST_DEF("InetLoopback::TCPZeroCopySend", TestTCPZeroCopySend),
+                          NL_TEST_DEF("InetLoopback::TCPZeroCopyCloseWithPendingCompletions",
+                                      TestTCPZeroCopyCloseWithPendingCompletions),
+                          NL_TEST_SENTINEL() };
+
+int TestSetup(void * inContext)
+{
+    if (chip::Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        return FAILURE;
+    }
+    InitSystemLayer();
+    InitNetwork();
+    return SUCCESS;
+}
+
+int TestTeardown(void * inContext)
+{
+    ShutdownNetwork();
+    ShutdownSystemLayer();
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+} // namespace
+
+int TestInetLoopbackSend()
+{
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "inet-loopback-send",
+        &sTests[0],
+        TestSetup,
+        TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+#else  // !CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    return 0;
+#endif // !CHIP_SYSTEM_CONFIG_USE_SOCKETS
+}
+
+CHIP_REGISTER_TEST_SUITE(TestInetLoopbackSend)
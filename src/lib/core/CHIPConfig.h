@@ -812,6 +812,19 @@
 #define CHIP_CONFIG_SLOW_CRYPTO 1
 #endif // CHIP_CONFIG_SLOW_CRYPTO
 
+/**
+ *  @def CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE
+ *
+ *  @brief
+ *   Number of PASE verifiers kept by PASEVerifierGenerator, keyed by an HMAC of passcode, salt
+ *   and PBKDF2 iteration count, so that generating the same verifier again does not re-run PBKDF2.
+ *
+ *   Set to 0 to always run PBKDF2.
+ */
+#ifndef CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE
+#define CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE 4
+#endif // CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE
+
 /**
  * @def CHIP_NON_PRODUCTION_MARKER
  *
@@ -864,6 +877,8 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+ *      * #CHIP_IM_SERVER_REPORT_CACHE_SIZE
+ *      * #CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRY_SIZE
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
@@ -941,6 +956,36 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_REPORT_CACHE_SIZE
+ *
+ * @brief Defines the number of encoded attribute reports the reporting engine keeps to serve other subscribers with the same
+ *        access to the same attributes without reading and encoding them again. Set to 0 to disable the cache.
+ */
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_SIZE
+#define CHIP_IM_SERVER_REPORT_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRY_SIZE
+ *
+ * @brief Defines the size, in bytes, of the largest encoded attribute report kept by the report cache. Larger reports
+ *        are encoded for each subscriber.
+ */
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRY_SIZE
+#define CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRY_SIZE 128
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_LATENCY_STATS_MAX_HISTOGRAMS
+ *
+ * @brief Defines the number of (cluster, operation) pairs for which the Interaction Model server keeps a latency
+ *        histogram, when built with CHIP_CONFIG_IM_LATENCY_STATS. Each histogram takes about 550 bytes.
+ */
+#ifndef CHIP_CONFIG_IM_LATENCY_STATS_MAX_HISTOGRAMS
+#define CHIP_CONFIG_IM_LATENCY_STATS_MAX_HISTOGRAMS 32
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1042,6 +1087,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_CASE_CLIENTS 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_CONTROLLER_MAX_PARALLEL_COMMISSIONING
+ *
+ * @brief Maximum number of commissioners a Controller::CommissioningPool can run commissioning flows on
+ *        concurrently.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_MAX_PARALLEL_COMMISSIONING
+#define CHIP_CONFIG_CONTROLLER_MAX_PARALLEL_COMMISSIONING 8
+#endif
+
 /**
  * @def CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS
  *
@@ -1369,6 +1424,22 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief Number of serialized replies the minmdns responder keeps for
+ *        re-sending when the same set of answers is selected again
+ *        for a query received on the same interface.
+ *
+ *        Cached replies are dropped whenever the advertised data changes,
+ *        and replies with A/AAAA records are built again once the
+ *        interface addresses differ from those they were built with.
+ *        Set to 0 to always build replies from the responders.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
 /**
  * def CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
  *
@@ -1426,6 +1497,17 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_NUM_CD_KEY_SLOTS 5
 #endif // CHIP_CONFIG_NUM_CD_KEY_SLOTS
 
+/**
+ * @def CHIP_CONFIG_DAC_VERIFIER_PAI_CACHE_SIZE
+ *
+ * @brief Number of PAI certificates, with their PAA, that the default DAC verifier remembers once they
+ *        have been part of a successful attestation, so that devices sharing a PAI only pay for the PAI
+ *        and PAA checks once. Each entry holds two DER certificates. Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_DAC_VERIFIER_PAI_CACHE_SIZE
+#define CHIP_CONFIG_DAC_VERIFIER_PAI_CACHE_SIZE 4
+#endif // CHIP_CONFIG_DAC_VERIFIER_PAI_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_MAX_SUBSCRIPTION_RESUMPTION_STORAGE_CONCURRENT_ITERATORS
  *
@@ -1701,6 +1783,54 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED 0
 #endif
 
+/**
+ * @def CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+ *
+ * @brief Controls whether the priority report scheduler is used, and whether the reporting engine lets the report scheduler
+ * choose the order in which reportable subscriptions are served.
+ *
+ * When more subscriptions are reportable than there can be reports in flight, the priority report scheduler serves urgent
+ * events first, then shares the reports in flight between fabrics so that a fabric with many busy subscriptions cannot starve
+ * the others.
+ */
+#ifndef CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED
+#define CHIP_CONFIG_PRIORITIZED_REPORTS_ENABLED 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS
+ *
+ * @brief Number of reports a fabric may send before the priority report scheduler serves the other fabrics first.
+ */
+#ifndef CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS
+#define CHIP_CONFIG_PRIORITIZED_REPORTS_FABRIC_CREDITS CHIP_IM_MAX_REPORTS_IN_FLIGHT
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_PATH_LIST_ARENA
+ *
+ * @brief Controls whether each ReadHandler allocates its attribute path, event path and data version filter lists from its
+ * own PathListArena instead of the path pools of the InteractionModelEngine.
+ *
+ * The nodes of a request are then contiguous in memory and freed at once when the handler is destroyed, and duplicate concrete
+ * attribute paths are found by sorting the wildcard paths of the request instead of comparing every pair of paths.
+ *
+ * The arenas are allocated from the heap, so this requires CHIP_SYSTEM_CONFIG_POOL_USE_HEAP.
+ */
+#ifndef CHIP_CONFIG_IM_PATH_LIST_ARENA
+#define CHIP_CONFIG_IM_PATH_LIST_ARENA 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE
+ *
+ * @brief Size, in bytes, of the blocks a PathListArena allocates from the heap. Allocations that do not fit in a block get a
+ * block of their own.
+ */
+#ifndef CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE
+#define CHIP_CONFIG_IM_PATH_LIST_ARENA_BLOCK_SIZE 256
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS
  *
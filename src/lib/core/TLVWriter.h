@@ -1212,6 +1212,14 @@ public:
      */
     uint32_t GetRemainingFreeLength() const { return mRemainingLen; }
 
+    /**
+     * Returns where the next byte will be written in the current buffer of the writer.
+     *
+     * @return A pointer into the current buffer, which is only valid until the writer moves on to another buffer of its
+     *         backing store.
+     */
+    const uint8_t * GetWritePoint() const { return mWritePoint; }
+
     /**
      * @brief Returns true if this TLVWriter was properly initialized.
      */
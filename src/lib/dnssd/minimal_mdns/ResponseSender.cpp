@@ -19,8 +19,12 @@
 
 #include "QueryReplyFilter.h"
 
+#include <lib/dnssd/minimal_mdns/AddressPolicy.h>
+#include <lib/support/SafeInt.h>
 #include <system/SystemClock.h>
 
+#include <string.h>
+
 namespace mdns {
 namespace Minimal {
 
@@ -37,6 +41,41 @@ constexpr uint16_t kMdnsStandardPort = 5353;
 //    the header.
 constexpr uint16_t kPacketSizeBytes = 512;
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+// FNV-1a digest of the addresses that IPv4Responder and IPv6Responder currently advertise on an interface.
+uint64_t AddressesFingerprint(chip::Inet::InterfaceId interfaceId)
+{
+    uint64_t hash = 14695981039346656037ull;
+    auto addBytes = [&hash](const uint8_t * data, size_t length) {
+        for (size_t i = 0; i < length; i++)
+        {
+            hash = (hash ^ data[i]) * 1099511628211ull;
+        }
+    };
+    auto addAddresses = [&addBytes, interfaceId](chip::Inet::IPAddressType type) {
+        chip::Inet::IPAddress addr;
+        chip::Platform::UniquePtr<IpAddressIterator> ips = GetAddressPolicy()->GetIpAddressesForEndpoint(interfaceId, type);
+        VerifyOrDie(ips);
+
+        const uint8_t typeTag = static_cast<uint8_t>(type);
+        addBytes(&typeTag, sizeof(typeTag));
+        while (ips->Next(addr))
+        {
+            addBytes(reinterpret_cast<const uint8_t *>(addr.Addr), sizeof(addr.Addr));
+        }
+    };
+
+#if INET_CONFIG_ENABLE_IPV4
+    addAddresses(chip::Inet::IPAddressType::kIPv4);
+#endif
+    addAddresses(chip::Inet::IPAddressType::kIPv6);
+
+    return hash;
+}
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 } // namespace
 namespace Internal {
 
@@ -50,6 +89,53 @@ bool ResponseSendingState::IncludeQuery() const
     return (mSource->SrcPort != kMdnsStandardPort);
 }
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+bool ResponseCacheKey::operator==(const ResponseCacheKey & other) const
+{
+    if ((answerCount != other.answerCount) || (interfaceId != other.interfaceId) || (addressType != other.addressType) ||
+        (queryClass != other.queryClass) || (announceBroadcast != other.announceBroadcast))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < answerCount; i++)
+    {
+        if (answers[i] != other.answers[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CachedResponse::Clear()
+{
+    for (size_t i = 0; i < packetCount; i++)
+    {
+        packets[i].Free();
+    }
+    packetCount          = 0;
+    addressesFingerprint = 0;
+    hasAddresses         = false;
+    valid                = false;
+}
+
+CHIP_ERROR CachedResponse::AddPacket(const uint8_t * data, size_t length)
+{
+    VerifyOrReturnError(packetCount < kMaxPackets, CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(chip::CanCastTo<uint16_t>(length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(packets[packetCount].Alloc(length), CHIP_ERROR_NO_MEMORY);
+
+    memcpy(packets[packetCount].Get(), data, length);
+    packetLengths[packetCount] = static_cast<uint16_t>(length);
+    packetCount++;
+
+    return CHIP_NO_ERROR;
+}
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 } // namespace Internal
 
 CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder)
@@ -62,12 +148,14 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
         if (responder == nullptr || responder == queryResponder)
         {
             responder = queryResponder;
+            ClearResponseCache();
             return CHIP_NO_ERROR;
         }
     }
 
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
     mResponders.push_back(queryResponder);
+    ClearResponseCache();
     return CHIP_NO_ERROR;
 #else
     return CHIP_ERROR_NO_MEMORY;
@@ -84,6 +172,7 @@ CHIP_ERROR ResponseSender::RemoveQueryResponder(QueryResponderBase * queryRespon
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
             mResponders.erase(it);
 #endif
+            ClearResponseCache();
             return CHIP_NO_ERROR;
         }
     }
@@ -102,6 +191,17 @@ bool ResponseSender::HasQueryResponders() const
     return false;
 }
 
+void ResponseSender::ClearResponseCache()
+{
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    for (auto & response : mResponseCache)
+    {
+        response.Clear();
+    }
+    mRecordedResponse = nullptr;
+#endif
+}
+
 CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
                                    const ResponseConfiguration & configuration)
 {
@@ -113,6 +213,22 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
         mSendState.MarkWasSent(ResponseItemsSent::kServiceListingData);
     }
 
+    // Answers must have the queried name (except for announcements). Most queries on a busy
+    // network are for names served by other hosts: drop those without going through the records.
+    mMatchQueryName = !query.IsAnnounceBroadcast();
+    mQueryNameHash  = mMatchQueryName ? HashQName(query.GetName()) : 0;
+
+    bool mayAnswer = false;
+    for (auto & responder : mResponders)
+    {
+        if ((responder != nullptr) && MayAnswer(*responder))
+        {
+            mayAnswer = true;
+            break;
+        }
+    }
+    ReturnErrorCodeIf(!mayAnswer, CHIP_NO_ERROR);
+
     // Responder has a stateful 'additional replies required' that is used within the response
     // loop. 'no additionals required' is set at the start and additionals are marked as the query
     // reply is built.
@@ -126,26 +242,42 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
         }
     }
 
-    // send all 'Answer' replies
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    // Replies that contain the query (legacy unicast) or that override TTLs are
+    // rare enough to always be built from scratch.
+    mRecordedResponse = nullptr;
+    if (!mSendState.IncludeQuery() && !configuration.GetTtlSecondsOverride().HasValue())
     {
-        const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+        Internal::ResponseCacheKey key;
+        if (BuildResponseCacheKey(query, kTimeNow, key))
+        {
+            Internal::CachedResponse * cached = FindCachedResponse(key);
+            if (cached != nullptr)
+            {
+                if (!cached->hasAddresses || (cached->addressesFingerprint == AddressesFingerprint(key.interfaceId)))
+                {
+                    return SendCachedResponse(*cached, kTimeNow);
+                }
+                // The interface addresses changed since this reply was built: build it again.
+                cached->Clear();
+            }
+            mRecordedResponse = AllocateCachedResponse(key);
+        }
+    }
+#endif
 
+    // send all 'Answer' replies
+    {
         QueryReplyFilter queryReplyFilter(query);
         QueryResponderRecordFilter responseFilter;
 
-        responseFilter.SetReplyFilter(&queryReplyFilter);
+        SetupAnswerFilter(queryReplyFilter, responseFilter, kTimeNow);
 
-        if (!mSendState.SendUnicast())
-        {
-            // According to https://tools.ietf.org/html/rfc6762#section-6  we should multicast at most 1/sec
-            //
-            // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
-            //       broadcasts on one interface to throttle broadcasts on another interface.
-            responseFilter.SetIncludeOnlyMulticastBeforeMS(kTimeNow - chip::System::Clock::Seconds32(1));
-        }
         for (auto & responder : mResponders)
         {
-            if (responder == nullptr)
+            if ((responder == nullptr) || !MayAnswer(*responder))
             {
                 continue;
             }
@@ -195,7 +327,42 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
         }
     }
 
-    return FlushReply();
+    ReturnErrorOnFailure(FlushReply());
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    if (mRecordedResponse != nullptr)
+    {
+        mRecordedResponse->valid = true;
+        mRecordedResponse        = nullptr;
+    }
+#endif
+
+    return CHIP_NO_ERROR;
+}
+
+void ResponseSender::SetupAnswerFilter(QueryReplyFilter & replyFilter, QueryResponderRecordFilter & responseFilter,
+                                       chip::System::Clock::Timestamp now) const
+{
+    responseFilter.SetReplyFilter(&replyFilter);
+
+    if (!mSendState.SendUnicast())
+    {
+        // According to https://tools.ietf.org/html/rfc6762#section-6  we should multicast at most 1/sec
+        //
+        // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
+        //       broadcasts on one interface to throttle broadcasts on another interface.
+        responseFilter.SetIncludeOnlyMulticastBeforeMS(now - chip::System::Clock::Seconds32(1));
+    }
+
+    if (mMatchQueryName)
+    {
+        responseFilter.SetQNameHash(mQueryNameHash);
+    }
+}
+
+bool ResponseSender::MayAnswer(const QueryResponderBase & responder) const
+{
+    return !mMatchQueryName || responder.MayHaveQName(mQueryNameHash);
 }
 
 CHIP_ERROR ResponseSender::FlushReply()
@@ -204,31 +371,140 @@ CHIP_ERROR ResponseSender::FlushReply()
 
     if (mResponseBuilder.HasResponseRecords())
     {
-        char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
-        VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+        chip::System::PacketBufferHandle packet = mResponseBuilder.ReleasePacket();
 
-        if (mSendState.SendUnicast())
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+        if ((mRecordedResponse != nullptr) &&
+            (mRecordedResponse->AddPacket(packet->Start(), packet->DataLength()) != CHIP_NO_ERROR))
         {
+            // Too large to be cached: keep building this reply, but do not store it.
+            mRecordedResponse->Clear();
+            mRecordedResponse = nullptr;
+        }
+#endif
+
+        ReturnErrorOnFailure(SendReplyPacket(std::move(packet)));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ResponseSender::SendReplyPacket(chip::System::PacketBufferHandle && packet)
+{
+    char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
+    VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+
+    if (mSendState.SendUnicast())
+    {
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString,
-                          mSendState.GetSourcePort());
+        ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString, mSendState.GetSourcePort());
 #endif
-            ReturnErrorOnFailure(mServer->DirectSend(mResponseBuilder.ReleasePacket(), mSendState.GetSourceAddress(),
-                                                     mSendState.GetSourcePort(), mSendState.GetSourceInterfaceId()));
-        }
-        else
-        {
+        return mServer->DirectSend(std::move(packet), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                   mSendState.GetSourceInterfaceId());
+    }
+
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+    ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
 #endif
-            ReturnErrorOnFailure(mServer->BroadcastSend(mResponseBuilder.ReleasePacket(), kMdnsStandardPort,
-                                                        mSendState.GetSourceInterfaceId(), mSendState.GetSourceAddress().Type()));
+    return mServer->BroadcastSend(std::move(packet), kMdnsStandardPort, mSendState.GetSourceInterfaceId(),
+                                  mSendState.GetSourceAddress().Type());
+}
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+bool ResponseSender::BuildResponseCacheKey(const QueryData & query, chip::System::Clock::Timestamp now,
+                                           Internal::ResponseCacheKey & key)
+{
+    // Select answers exactly as Respond does, so that throttled answers are part of the key.
+    QueryReplyFilter queryReplyFilter(query);
+    QueryResponderRecordFilter responseFilter;
+
+    SetupAnswerFilter(queryReplyFilter, responseFilter, now);
+
+    key.answerCount = 0;
+    for (auto & responder : mResponders)
+    {
+        if ((responder == nullptr) || !MayAnswer(*responder))
+        {
+            continue;
+        }
+        for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
+        {
+            VerifyOrReturnValue(key.answerCount < Internal::ResponseCacheKey::kMaxAnswers, false);
+            key.answers[key.answerCount++] = it.GetInternal();
+        }
+    }
+
+    key.interfaceId       = mSendState.GetSourceInterfaceId();
+    key.addressType       = mSendState.GetSourceAddress().Type();
+    key.queryClass        = query.GetClass();
+    key.announceBroadcast = query.IsAnnounceBroadcast();
+
+    // Nothing gets sent without answers, so there is nothing to cache either.
+    return key.answerCount > 0;
+}
+
+Internal::CachedResponse * ResponseSender::FindCachedResponse(const Internal::ResponseCacheKey & key)
+{
+    for (auto & response : mResponseCache)
+    {
+        if (response.valid && (response.key == key))
+        {
+            response.lastUsed = ++mResponseCacheUseCounter;
+            return &response;
+        }
+    }
+    return nullptr;
+}
+
+Internal::CachedResponse * ResponseSender::AllocateCachedResponse(const Internal::ResponseCacheKey & key)
+{
+    Internal::CachedResponse * result = nullptr;
+
+    for (auto & response : mResponseCache)
+    {
+        if (!response.valid)
+        {
+            result = &response;
+            break;
+        }
+        if ((result == nullptr) || (response.lastUsed < result->lastUsed))
+        {
+            result = &response;
+        }
+    }
+
+    result->Clear();
+    result->key      = key;
+    result->lastUsed = ++mResponseCacheUseCounter;
+    return result;
+}
+
+CHIP_ERROR ResponseSender::SendCachedResponse(Internal::CachedResponse & response, chip::System::Clock::Timestamp now)
+{
+    for (size_t i = 0; i < response.packetCount; i++)
+    {
+        chip::System::PacketBufferHandle packet =
+            chip::System::PacketBufferHandle::NewWithData(response.packets[i].Get(), response.packetLengths[i]);
+        ReturnErrorCodeIf(packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        HeaderRef(packet->Start()).SetMessageId(mSendState.GetMessageId());
+        ReturnErrorOnFailure(SendReplyPacket(std::move(packet)));
+    }
+
+    if (!mSendState.SendUnicast())
+    {
+        for (size_t i = 0; i < response.key.answerCount; i++)
+        {
+            response.key.answers[i]->lastMulticastTime = now;
         }
     }
 
     return CHIP_NO_ERROR;
 }
 
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 CHIP_ERROR ResponseSender::PrepareNewReplyPacket()
 {
     chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::New(kPacketSizeBytes);
@@ -288,6 +564,15 @@ void ResponseSender::AddResponse(const ResourceRecord & record)
 {
     ReturnOnFailure(mSendState.GetError());
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    if ((mRecordedResponse != nullptr) && !mRecordedResponse->hasAddresses &&
+        ((record.GetType() == QType::A) || (record.GetType() == QType::AAAA)))
+    {
+        mRecordedResponse->hasAddresses         = true;
+        mRecordedResponse->addressesFingerprint = AddressesFingerprint(mRecordedResponse->key.interfaceId);
+    }
+#endif
+
     if (!mResponseBuilder.HasPacketBuffer())
     {
         mSendState.SetError(PrepareNewReplyPacket());
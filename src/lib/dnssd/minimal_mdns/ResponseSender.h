@@ -23,6 +23,8 @@
 
 #include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
 
+#include <lib/support/ScopedBuffer.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
@@ -45,6 +47,8 @@ using QueryResponderPtrPool = std::array<mdns::Minimal::QueryResponderBase *, CH
 namespace mdns {
 namespace Minimal {
 
+class QueryReplyFilter;
+
 namespace Internal {
 
 // Flags for keeping track of items having been sent as DNSSD responses
@@ -119,6 +123,49 @@ private:
     chip::BitFlags<ResponseItemsSent> mSentItems;
 };
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+/// Identifies the content of a reply: the answers selected for a query (after
+/// throttling) determine the additional records that follow, so two queries
+/// with the same key serialize to the same packets.
+struct ResponseCacheKey
+{
+    static constexpr size_t kMaxAnswers = 16;
+
+    QueryResponderInfo * answers[kMaxAnswers];
+    size_t answerCount = 0;
+    chip::Inet::InterfaceId interfaceId;
+    chip::Inet::IPAddressType addressType = chip::Inet::IPAddressType::kAny;
+    QClass queryClass                     = QClass::ANY;
+    bool announceBroadcast                = false;
+
+    bool operator==(const ResponseCacheKey & other) const;
+};
+
+/// A reply as previously sent by ResponseSender, stored packet by packet.
+///
+/// A and AAAA records are built from the interface addresses at the time of
+/// the reply, which change without the responders being told. Replies that
+/// contain them are only re-sent while those addresses are unchanged.
+struct CachedResponse
+{
+    static constexpr size_t kMaxPackets = 4;
+
+    ResponseCacheKey key;
+    chip::Platform::ScopedMemoryBuffer<uint8_t> packets[kMaxPackets];
+    uint16_t packetLengths[kMaxPackets] = {};
+    size_t packetCount                  = 0;
+    uint32_t lastUsed                   = 0; // for LRU replacement
+    uint64_t addressesFingerprint       = 0; // AddressesFingerprint() of the interface, if hasAddresses
+    bool hasAddresses                   = false;
+    bool valid                          = false;
+
+    void Clear();
+    CHIP_ERROR AddPacket(const uint8_t * data, size_t length);
+};
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 } // namespace Internal
 
 /// Sends responses to mDNS queries.
@@ -145,9 +192,28 @@ public:
 
     void SetServer(ServerBase * server) { mServer = server; }
 
+    /// Drop all cached replies.
+    ///
+    /// Must be called whenever the data served by any of the registered query
+    /// responders changes (records added or removed, names updated, etc.), since
+    /// replies are re-sent as previously serialized while the selected answers match.
+    void ClearResponseCache();
+
 private:
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
+    CHIP_ERROR SendReplyPacket(chip::System::PacketBufferHandle && packet);
+
+    void SetupAnswerFilter(QueryReplyFilter & replyFilter, QueryResponderRecordFilter & responseFilter,
+                           chip::System::Clock::Timestamp now) const;
+    bool MayAnswer(const QueryResponderBase & responder) const;
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    bool BuildResponseCacheKey(const QueryData & query, chip::System::Clock::Timestamp now, Internal::ResponseCacheKey & key);
+    Internal::CachedResponse * FindCachedResponse(const Internal::ResponseCacheKey & key);
+    Internal::CachedResponse * AllocateCachedResponse(const Internal::ResponseCacheKey & key);
+    CHIP_ERROR SendCachedResponse(Internal::CachedResponse & response, chip::System::Clock::Timestamp now);
+#endif
 
     ServerBase * mServer;
     QueryResponderPtrPool mResponders = {};
@@ -155,6 +221,14 @@ private:
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
     Internal::ResponseSendingState mSendState; // sending state
+    bool mMatchQueryName    = false;           // answers must have the queried name
+    uint32_t mQueryNameHash = 0;               // HashQName of the queried name, if mMatchQueryName
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    Internal::CachedResponse mResponseCache[CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE];
+    Internal::CachedResponse * mRecordedResponse = nullptr; // cache entry receiving the reply being built
+    uint32_t mResponseCacheUseCounter            = 0;
+#endif
 };
 
 } // namespace Minimal
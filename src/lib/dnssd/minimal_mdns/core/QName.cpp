@@ -21,6 +21,28 @@
 
 namespace mdns {
 namespace Minimal {
+namespace {
+
+// FNV-1a, over ASCII-lowercased label contents. Each label is terminated by a
+// 0 byte (never part of a label), so that "ab.c" and "a.bc" differ.
+constexpr uint32_t kHashOffsetBasis = 2166136261u;
+constexpr uint32_t kHashPrime       = 16777619u;
+
+uint32_t HashLabel(uint32_t hash, const char * label)
+{
+    for (; *label != '\0'; label++)
+    {
+        char c = *label;
+        if ((c >= 'A') && (c <= 'Z'))
+        {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        hash = (hash ^ static_cast<uint8_t>(c)) * kHashPrime;
+    }
+    return hash * kHashPrime; // (hash ^ 0) * prime
+}
+
+} // namespace
 
 bool SerializedQNameIterator::Next()
 {
@@ -210,5 +232,27 @@ bool FullQName::operator==(const FullQName & other) const
     return true;
 }
 
+uint32_t HashQName(const FullQName & name)
+{
+    uint32_t hash = kHashOffsetBasis;
+    for (size_t i = 0; i < name.nameCount; i++)
+    {
+        hash = HashLabel(hash, name.names[i]);
+    }
+    return hash;
+}
+
+uint32_t HashQName(SerializedQNameIterator name)
+{
+    // Iterates labels the same way as the comparison operators do, so that
+    // names comparing equal hash the same even if followed by invalid data.
+    uint32_t hash = kHashOffsetBasis;
+    while (name.Next())
+    {
+        hash = HashLabel(hash, name.Value());
+    }
+    return hash;
+}
+
 } // namespace Minimal
 } // namespace mdns
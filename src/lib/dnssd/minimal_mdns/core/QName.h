@@ -117,5 +117,12 @@ private:
     bool Next(bool followIndirectPointers);
 };
 
+/// Computes a case-insensitive hash of the labels of a QName.
+///
+/// Names that compare equal (regardless of their FullQName or serialized form)
+/// have the same hash, so differing hashes allow skipping a full comparison.
+uint32_t HashQName(const FullQName & name);
+uint32_t HashQName(SerializedQNameIterator name);
+
 } // namespace Minimal
 } // namespace mdns
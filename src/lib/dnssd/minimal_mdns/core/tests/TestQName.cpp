@@ -301,6 +301,30 @@ void SerializedCompare(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, AsSerializedQName(kThisIs) != thisIsATestPtr);
 }
 
+void Hashing(nlTestSuite * inSuite, void * inContext)
+{
+    static const uint8_t kThisIsATest[] = "\04ThIs\02is\01A\04tESt\00";
+    static const uint8_t kThisIsA[]     = "\04this\02is\01a\00";
+    static const uint8_t kPtrItems[]    = "\03abc\02is\01a\04test\00\04this\xc0\04";
+    SerializedQNameIterator thisIsATestPtr(BytesRange(kPtrItems, kPtrItems + sizeof(kPtrItems)), kPtrItems + 15);
+
+    const QNamePart kThisIsATestName[] = { "this", "is", "a", "test" };
+    const QNamePart kUpperName[]       = { "THIS", "IS", "A", "TEST" };
+    const QNamePart kMergedName[]      = { "thisis", "a", "test" };
+    const QNamePart kOtherName[]       = { "this", "is", "a", "nest" };
+
+    const uint32_t hash = HashQName(FullQName(kThisIsATestName));
+
+    NL_TEST_ASSERT(inSuite, HashQName(FullQName(kUpperName)) == hash);
+    NL_TEST_ASSERT(inSuite, HashQName(AsSerializedQName(kThisIsATest)) == hash);
+    NL_TEST_ASSERT(inSuite, HashQName(thisIsATestPtr) == hash);
+
+    NL_TEST_ASSERT(inSuite, HashQName(FullQName(kMergedName)) != hash);
+    NL_TEST_ASSERT(inSuite, HashQName(FullQName(kOtherName)) != hash);
+    NL_TEST_ASSERT(inSuite, HashQName(AsSerializedQName(kThisIsA)) != hash);
+    NL_TEST_ASSERT(inSuite, HashQName(FullQName()) != hash);
+}
+
 } // namespace
 
 // clang-format off
@@ -313,6 +337,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CaseInsensitiveFullQNameCompare", CaseInsensitiveFullQNameCompare),
     NL_TEST_DEF("SerializedCompare", SerializedCompare),
     NL_TEST_DEF("InvalidReferencing", InvalidReferencing),
+    NL_TEST_DEF("Hashing", Hashing),
 
     NL_TEST_SENTINEL()
 };
@@ -38,10 +38,14 @@ void QueryResponderBase::Init()
         mResponderInfos[i].Clear();
     }
 
+    mQNameHashMask = 0;
+
     if (mResponderInfoSize > 0)
     {
         // reply to queries about services available
         mResponderInfos[0].responder = this;
+        mResponderInfos[0].qnameHash = HashQName(GetQName());
+        mQNameHashMask |= QNameHashBit(mResponderInfos[0].qnameHash);
     }
 
     if (mResponderInfoSize < 2)
@@ -65,6 +69,8 @@ QueryResponderSettings QueryResponderBase::AddResponder(RecordResponder * respon
         {
             mResponderInfos[i].Clear();
             mResponderInfos[i].responder = responder;
+            mResponderInfos[i].qnameHash = HashQName(responder->GetQName());
+            mQNameHashMask |= QNameHashBit(mResponderInfos[i].qnameHash);
 
             return QueryResponderSettings(&mResponderInfos[i]);
         }
@@ -83,7 +89,8 @@ void QueryResponderBase::ResetAdditionals()
 
 size_t QueryResponderBase::MarkAdditional(const FullQName & qname)
 {
-    size_t count = 0;
+    const uint32_t qnameHash = HashQName(qname);
+    size_t count             = 0;
     for (size_t i = 0; i < mResponderInfoSize; i++)
     {
         if (mResponderInfos[i].responder == nullptr)
@@ -96,7 +103,7 @@ size_t QueryResponderBase::MarkAdditional(const FullQName & qname)
             continue; // already marked
         }
 
-        if (mResponderInfos[i].responder->GetQName() == qname)
+        if ((mResponderInfos[i].qnameHash == qnameHash) && (mResponderInfos[i].responder->GetQName() == qname))
         {
             mResponderInfos[i].reportNowAsAdditional = true;
             count++;
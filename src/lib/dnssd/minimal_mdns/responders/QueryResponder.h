@@ -44,12 +44,15 @@ struct QueryResponderInfo : public QueryResponderRecord
     bool alsoReportAdditionalQName = false; // report more data when this record is listed
     FullQName additionalQName;              // if alsoReportAdditionalQName is set, send this extra data
 
+    uint32_t qnameHash = 0; // HashQName of responder->GetQName()
+
     void Clear()
     {
         responder                 = nullptr;
         reportService             = false;
         reportNowAsAdditional     = false;
         alsoReportAdditionalQName = false;
+        qnameHash                 = 0;
     }
 };
 
@@ -128,6 +131,16 @@ public:
         return *this;
     }
 
+    /// Filter out anything whose QName does not have the given HashQName value.
+    ///
+    /// This is a fast pre-check only: the reply filter still decides on actual name matches.
+    QueryResponderRecordFilter & SetQNameHash(uint32_t qnameHash)
+    {
+        mQNameHash    = qnameHash;
+        mHasQNameHash = true;
+        return *this;
+    }
+
     bool Accept(Internal::QueryResponderInfo * record) const
     {
         if (record->responder == nullptr)
@@ -140,6 +153,11 @@ public:
             return false;
         }
 
+        if (mHasQNameHash && (record->qnameHash != mQNameHash))
+        {
+            return false;
+        }
+
         if ((mIncludeOnlyMulticastBefore > chip::System::Clock::kZero) &&
             (record->lastMulticastTime >= mIncludeOnlyMulticastBefore))
         {
@@ -158,6 +176,8 @@ private:
     bool mIncludeAdditionalRepliesOnly                         = false;
     ReplyFilter * mReplyFilter                                 = nullptr;
     chip::System::Clock::Timestamp mIncludeOnlyMulticastBefore = chip::System::Clock::kZero;
+    bool mHasQNameHash                                         = false;
+    uint32_t mQNameHash                                        = 0;
 };
 
 /// Iterates over an array of QueryResponderRecord items, providing only 'valid' ones, where
@@ -264,6 +284,12 @@ public:
     /// Clear any items marked as 'additional'.
     void ResetAdditionals();
 
+    /// Check if any record of this responder may have a QName with the given HashQName value.
+    ///
+    /// Returns false only if none does, allowing queries for unrelated names to be
+    /// dropped without going through the records.
+    bool MayHaveQName(uint32_t qnameHash) const { return (mQNameHashMask & QNameHashBit(qnameHash)) != 0; }
+
     /// Marks queries matching this qname as 'to be additionally reported'
     /// @return the number of items marked new as 'additional data'.
     size_t MarkAdditional(const FullQName & qname);
@@ -276,8 +302,11 @@ public:
     void ClearBroadcastThrottle();
 
 private:
+    static uint64_t QNameHashBit(uint32_t qnameHash) { return uint64_t(1) << (qnameHash % 64); }
+
     Internal::QueryResponderInfo * mResponderInfos;
     size_t mResponderInfoSize;
+    uint64_t mQNameHashMask = 0; // one bit per hash of any record QName, see MayHaveQName
 };
 
 template <size_t kSize>
@@ -0,0 +1,173 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+// Matches the queries of every input packet against the records of a bridge-like
+// advertiser (several operational instances plus commissionable records), both through
+// the QName hash index and through plain QName comparisons, and dies if they disagree.
+//
+// Run over the fuzz-minmdns-packet-parsing corpus with a fixed number of runs, e.g.
+//
+//     fuzz-minmdns-responder-matching -runs=1000000 <corpus dir>
+//
+// the reported exec/s doubles as a benchmark of query-to-responder matching.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/QueryReplyFilter.h>
+#include <lib/dnssd/minimal_mdns/responders/Ptr.h>
+#include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
+#include <lib/dnssd/minimal_mdns/responders/Srv.h>
+#include <lib/dnssd/minimal_mdns/responders/Txt.h>
+#include <lib/support/CodeUtils.h>
+
+namespace {
+
+using namespace chip;
+using namespace mdns::Minimal;
+
+constexpr size_t kOperationalCount = 8;
+
+const QNamePart kOperationalService[]    = { "_matter", "_tcp", "local" };
+const QNamePart kCommissionableService[] = { "_matterc", "_udp", "local" };
+const QNamePart kLongSubtype[]           = { "_L3840", "_sub", "_matterc", "_udp", "local" };
+const QNamePart kCommissionable[]        = { "B5F2C8A1E0D3C4F7", "_matterc", "_udp", "local" };
+const QNamePart kHost[]                  = { "DCA632A1B2C3", "local" };
+const QNamePart kTxtEntries[]            = { "SII=5000", "SAI=300", "T=1" };
+
+const QNamePart kOperationalInstances[kOperationalCount][4] = {
+    { "2906C908D115D362-0000000000000001", "_matter", "_tcp", "local" },
+    { "2906C908D115D362-0000000000000002", "_matter", "_tcp", "local" },
+    { "5A1B0C4D3E2F1A0B-00000000000000A1", "_matter", "_tcp", "local" },
+    { "5A1B0C4D3E2F1A0B-00000000000000A2", "_matter", "_tcp", "local" },
+    { "87E1B004E235A130-8FC7772401CD0696", "_matter", "_tcp", "local" },
+    { "87E1B004E235A130-0000000000000010", "_matter", "_tcp", "local" },
+    { "0123456789ABCDEF-FEDCBA9876543210", "_matter", "_tcp", "local" },
+    { "0123456789ABCDEF-0000000000001234", "_matter", "_tcp", "local" },
+};
+
+struct OperationalRecords
+{
+    OperationalRecords(const FullQName & instance) :
+        ptr(FullQName(kOperationalService), instance), srv(SrvResourceRecord(instance, FullQName(kHost), 5540)),
+        txt(TxtResourceRecord(instance, FullQName(kTxtEntries)))
+    {}
+
+    PtrResponder ptr;
+    SrvResponder srv;
+    TxtResponder txt;
+};
+
+class BridgeResponder
+{
+public:
+    BridgeResponder() :
+        mOperational{ FullQName(kOperationalInstances[0]), FullQName(kOperationalInstances[1]),
+                      FullQName(kOperationalInstances[2]), FullQName(kOperationalInstances[3]),
+                      FullQName(kOperationalInstances[4]), FullQName(kOperationalInstances[5]),
+                      FullQName(kOperationalInstances[6]), FullQName(kOperationalInstances[7]) },
+        mCommissionablePtr(FullQName(kCommissionableService), FullQName(kCommissionable)),
+        mSubtypePtr(FullQName(kLongSubtype), FullQName(kCommissionable)),
+        mCommissionableSrv(SrvResourceRecord(FullQName(kCommissionable), FullQName(kHost), 5540)),
+        mCommissionableTxt(TxtResourceRecord(FullQName(kCommissionable), FullQName(kTxtEntries)))
+    {
+        for (auto & records : mOperational)
+        {
+            mResponder.AddResponder(&records.ptr).SetReportInServiceListing(true);
+            mResponder.AddResponder(&records.srv);
+            mResponder.AddResponder(&records.txt);
+        }
+        mResponder.AddResponder(&mCommissionablePtr).SetReportInServiceListing(true);
+        mResponder.AddResponder(&mSubtypePtr).SetReportInServiceListing(true);
+        mResponder.AddResponder(&mCommissionableSrv);
+        mResponder.AddResponder(&mCommissionableTxt);
+    }
+
+    QueryResponderBase & Get() { return mResponder; }
+
+private:
+    OperationalRecords mOperational[kOperationalCount];
+    PtrResponder mCommissionablePtr;
+    PtrResponder mSubtypePtr;
+    SrvResponder mCommissionableSrv;
+    TxtResponder mCommissionableTxt;
+    QueryResponder<kOperationalCount * 3 + 5> mResponder;
+};
+
+class FuzzDelegate : public ParserDelegate
+{
+public:
+    FuzzDelegate(QueryResponderBase & responder) : mResponder(responder) {}
+    virtual ~FuzzDelegate() {}
+
+    void OnHeader(ConstHeaderRef & header) override {}
+    void OnResource(ResourceType type, const ResourceData & data) override {}
+
+    void OnQuery(const QueryData & data) override
+    {
+        QueryReplyFilter replyFilter(data);
+
+        QueryResponderRecordFilter plainFilter;
+        plainFilter.SetReplyFilter(&replyFilter);
+
+        size_t plainMatches = 0;
+        for (auto it = mResponder.begin(&plainFilter); it != mResponder.end(); it++)
+        {
+            plainMatches++;
+        }
+
+        if (data.IsAnnounceBroadcast())
+        {
+            return; // announcements do not match names, so are not hashed
+        }
+
+        const uint32_t qnameHash = HashQName(data.GetName());
+        if (!mResponder.MayHaveQName(qnameHash))
+        {
+            VerifyOrDie(plainMatches == 0);
+            return;
+        }
+
+        QueryResponderRecordFilter hashedFilter;
+        hashedFilter.SetReplyFilter(&replyFilter).SetQNameHash(qnameHash);
+
+        size_t hashedMatches = 0;
+        for (auto it = mResponder.begin(&hashedFilter); it != mResponder.end(); it++)
+        {
+            hashedMatches++;
+        }
+        VerifyOrDie(hashedMatches == plainMatches);
+    }
+
+private:
+    QueryResponderBase & mResponder;
+};
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t * data, size_t len)
+{
+    static BridgeResponder bridge;
+
+    BytesRange packet(data, data + len);
+    FuzzDelegate delegate(bridge.Get());
+
+    mdns::Minimal::ParsePacket(packet, &delegate);
+
+    return 0;
+}
@@ -19,9 +19,11 @@
 #include <string>
 #include <vector>
 
+#include <lib/dnssd/minimal_mdns/AddressPolicy.h>
 #include <lib/dnssd/minimal_mdns/RecordData.h>
 #include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
 #include <lib/dnssd/minimal_mdns/core/RecordWriter.h>
+#include <lib/dnssd/minimal_mdns/responders/IP.h>
 #include <lib/dnssd/minimal_mdns/responders/Ptr.h>
 #include <lib/dnssd/minimal_mdns/responders/Srv.h>
 #include <lib/dnssd/minimal_mdns/responders/Txt.h>
@@ -344,6 +346,190 @@ void PtrSrvTxtMultipleRespondersToServiceListing(nlTestSuite * inSuite, void * i
     NL_TEST_ASSERT(inSuite, common1->server.GetHeaderFound());
 }
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+class CountingSrvResponder : public SrvResponder
+{
+public:
+    CountingSrvResponder(const SrvResourceRecord & record) : SrvResponder(record) {}
+
+    void AddAllResponses(const Inet::IPPacketInfo * source, ResponderDelegate * delegate,
+                         const ResponseConfiguration & configuration) override
+    {
+        mCallCount++;
+        SrvResponder::AddAllResponses(source, delegate, configuration);
+    }
+
+    size_t GetCallCount() const { return mCallCount; }
+
+private:
+    size_t mCallCount = 0;
+};
+
+void CachedResponseToRepeatedQuery(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    CountingSrvResponder srvResponder(common.srvRecord);
+    ResponseSender responseSender(&common.server);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&srvResponder);
+
+    // Replies to queries from the standard mDNS port do not contain the query, so they can be cached.
+    common.packetInfo.Clear();
+    common.packetInfo.SrcPort = 5353;
+
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::SRV, QClass::IN, true, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration());
+
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+    NL_TEST_ASSERT(inSuite, common.server.GetMessageId() == 1);
+    NL_TEST_ASSERT(inSuite, srvResponder.GetCallCount() == 1);
+
+    // Same query again: the cached reply is sent with the new message id.
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration());
+
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+    NL_TEST_ASSERT(inSuite, common.server.GetMessageId() == 2);
+    NL_TEST_ASSERT(inSuite, srvResponder.GetCallCount() == 1);
+
+    // TTL overrides are never cached.
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    responseSender.Respond(3, queryData, &common.packetInfo, ResponseConfiguration().SetTtlSecondsOverride(0));
+
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, srvResponder.GetCallCount() == 2);
+
+    // Once the advertised data changes, the reply is built again.
+    responseSender.ClearResponseCache();
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    responseSender.Respond(4, queryData, &common.packetInfo, ResponseConfiguration());
+
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+    NL_TEST_ASSERT(inSuite, common.server.GetMessageId() == 4);
+    NL_TEST_ASSERT(inSuite, srvResponder.GetCallCount() == 3);
+}
+
+// Advertises a single IPv6 address, which tests may change, on every interface.
+class SingleAddressPolicy : public AddressPolicy
+{
+public:
+    Platform::UniquePtr<ListenIterator> GetListenEndpoints() override { return nullptr; }
+
+    Platform::UniquePtr<IpAddressIterator> GetIpAddressesForEndpoint(Inet::InterfaceId interfaceId,
+                                                                     Inet::IPAddressType type) override
+    {
+        return Platform::UniquePtr<IpAddressIterator>(
+            Platform::New<Iterator>(type == Inet::IPAddressType::kIPv6 ? &mAddress : nullptr));
+    }
+
+    Inet::IPAddress mAddress;
+
+private:
+    class Iterator : public IpAddressIterator
+    {
+    public:
+        Iterator(const Inet::IPAddress * address) : mAddress(address) {}
+
+        bool Next(Inet::IPAddress & dest) override
+        {
+            VerifyOrReturnValue(mAddress != nullptr, false);
+            dest     = *mAddress;
+            mAddress = nullptr;
+            return true;
+        }
+
+    private:
+        const Inet::IPAddress * mAddress;
+    };
+};
+
+SingleAddressPolicy gSingleAddressPolicy;
+
+// Keeps the address of the AAAA records of the last reply sent.
+class AddressRecordingServer : private chip::PoolImpl<ServerBase::EndpointInfo, 0, chip::ObjectPoolMem::kInline,
+                                                      ServerBase::EndpointInfoPoolType::Interface>,
+                               public ServerBase,
+                               public ParserDelegate
+{
+public:
+    AddressRecordingServer() : ServerBase(*static_cast<ServerBase::EndpointInfoPoolType *>(this)) {}
+
+    CHIP_ERROR DirectSend(chip::System::PacketBufferHandle && data, const chip::Inet::IPAddress & addr, uint16_t port,
+                          chip::Inet::InterfaceId interface) override
+    {
+        mAddressCount = 0;
+        ParsePacket(BytesRange(data->Start(), data->Start() + data->TotalLength()), this);
+        return CHIP_NO_ERROR;
+    }
+
+    void OnHeader(ConstHeaderRef & header) override {}
+    void OnQuery(const QueryData & data) override {}
+    void OnResource(ResourceType type, const ResourceData & data) override
+    {
+        if ((data.GetType() == QType::AAAA) && ParseAAAARecord(data.GetData(), &mAddress))
+        {
+            mAddressCount++;
+        }
+    }
+
+    Inet::IPAddress mAddress;
+    size_t mAddressCount = 0;
+};
+
+void CachedResponseFollowsAddressChanges(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    IPv6Responder ipv6Responder(common.host);
+    AddressRecordingServer server;
+    ResponseSender responseSender(&server);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&ipv6Responder);
+
+    SetAddressPolicy(&gSingleAddressPolicy);
+    Inet::IPAddress firstAddress;
+    Inet::IPAddress secondAddress;
+    NL_TEST_ASSERT(inSuite, Inet::IPAddress::FromString("fe80::1", firstAddress));
+    NL_TEST_ASSERT(inSuite, Inet::IPAddress::FromString("fe80::2", secondAddress));
+    gSingleAddressPolicy.mAddress = firstAddress;
+
+    common.packetInfo.Clear();
+    common.packetInfo.SrcPort = 5353;
+
+    common.recordWriter.WriteQName(common.host);
+    QueryData queryData = QueryData(QType::AAAA, QClass::IN, true, common.requestNameStart, common.requestBytesRange);
+
+    responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration());
+    NL_TEST_ASSERT(inSuite, server.mAddressCount == 1);
+    NL_TEST_ASSERT(inSuite, server.mAddress == firstAddress);
+
+    responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration());
+    NL_TEST_ASSERT(inSuite, server.mAddressCount == 1);
+    NL_TEST_ASSERT(inSuite, server.mAddress == firstAddress);
+
+    // Interface addresses change without the responders being told: the cached reply must not be sent.
+    gSingleAddressPolicy.mAddress = secondAddress;
+
+    responseSender.Respond(3, queryData, &common.packetInfo, ResponseConfiguration());
+    NL_TEST_ASSERT(inSuite, server.mAddressCount == 1);
+    NL_TEST_ASSERT(inSuite, server.mAddress == secondAddress);
+
+    responseSender.Respond(4, queryData, &common.packetInfo, ResponseConfiguration());
+    NL_TEST_ASSERT(inSuite, server.mAddressCount == 1);
+    NL_TEST_ASSERT(inSuite, server.mAddress == secondAddress);
+}
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 const nlTest sTests[] = {
     NL_TEST_DEF("SrvAnyResponseToInstance", SrvAnyResponseToInstance),                                       //
     NL_TEST_DEF("SrvTxtAnyResponseToInstance", SrvTxtAnyResponseToInstance),                                 //
@@ -355,6 +541,10 @@ const nlTest sTests[] = {
     NL_TEST_DEF("AddManyQueryResponders", AddManyQueryResponders),                                           //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToInstance", PtrSrvTxtMultipleRespondersToInstance),             //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToServiceListing", PtrSrvTxtMultipleRespondersToServiceListing), //
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    NL_TEST_DEF("CachedResponseToRepeatedQuery", CachedResponseToRepeatedQuery),             //
+    NL_TEST_DEF("CachedResponseFollowsAddressChanges", CachedResponseFollowsAddressChanges), //
+#endif
 
     NL_TEST_SENTINEL() //
 };
@@ -19,13 +19,18 @@
 
 #include <algorithm>
 #include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <json/json.h>
 #include <lib/support/Base64.h>
 #include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/jsontlv/ElementTypes.h>
 #include <lib/support/jsontlv/JsonToTlv.h>
 
@@ -112,15 +117,20 @@ struct ElementContext
     ElementTypeContext subType;
 };
 
-bool CompareByTag(const ElementContext & a, const ElementContext & b)
+bool IsTagOrderedBefore(TLV::Tag a, TLV::Tag b)
 {
     // If tags are of the same type compare by tag number
-    if (IsContextTag(a.tag) == IsContextTag(b.tag))
+    if (IsContextTag(a) == IsContextTag(b))
     {
-        return TLV::TagNumFromTag(a.tag) < TLV::TagNumFromTag(b.tag);
+        return TLV::TagNumFromTag(a) < TLV::TagNumFromTag(b);
     }
     // Otherwise, compare by tag type: context tags first followed by common profile tags
-    return IsContextTag(a.tag);
+    return IsContextTag(a);
+}
+
+bool CompareByTag(const ElementContext & a, const ElementContext & b)
+{
+    return IsTagOrderedBefore(a.tag, b.tag);
 }
 
 // The profileId parameter is used when encoding a tag for a TLV element to specify the profile that the tag belongs to.
@@ -149,7 +159,7 @@ CHIP_ERROR InternalConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag, const uint3
 }
 
 template <typename T>
-CHIP_ERROR ParseNumericalField(const std::string & decimalString, T & outValue)
+CHIP_ERROR ParseNumericalField(const CharSpan & decimalString, T & outValue)
 {
     const char * start_ptr       = decimalString.data();
     const char * end_ptr         = decimalString.data() + decimalString.size();
@@ -158,6 +168,12 @@ CHIP_ERROR ParseNumericalField(const std::string & decimalString, T & outValue)
     return CHIP_NO_ERROR;
 }
 
+template <typename T>
+CHIP_ERROR ParseNumericalField(const std::string & decimalString, T & outValue)
+{
+    return ParseNumericalField(CharSpan(decimalString.data(), decimalString.size()), outValue);
+}
+
 CHIP_ERROR ParseJsonName(const std::string & name, ElementContext & elementCtx, uint32_t implicitProfileId)
 {
     uint32_t tagNumber                  = 0;
@@ -396,6 +412,539 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     return CHIP_NO_ERROR;
 }
 
+// Bounds the recursion of the streaming conversion.
+constexpr uint8_t kMaxStreamingContainerDepth = 32;
+
+// Long enough for any JSON number that still has a meaningful double representation.
+constexpr size_t kMaxNumberTokenLength = 64;
+
+template <typename T>
+CHIP_ERROR EnsureBufferSize(Platform::ScopedMemoryBuffer<T> & buffer, size_t & bufferSize, size_t size)
+{
+    VerifyOrReturnError(size > bufferSize || buffer.Get() == nullptr, CHIP_NO_ERROR);
+    buffer.Alloc(std::max<size_t>(size, 1));
+    VerifyOrReturnError(buffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    bufferSize = size;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ParseJsonDouble(const CharSpan & token, double & outValue)
+{
+    char buf[kMaxNumberTokenLength + 1];
+    VerifyOrReturnError(!token.empty() && token.size() <= kMaxNumberTokenLength, CHIP_ERROR_INVALID_ARGUMENT);
+    memcpy(buf, token.data(), token.size());
+    buf[token.size()] = '\0';
+
+    char * end = nullptr;
+    outValue   = strtod(buf, &end);
+    VerifyOrReturnError(end == buf + token.size(), CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+/*
+ * Parses a JSON number into a 64-bit integer. Like Json::Value::isUInt64()/isInt64(), integral real numbers
+ * (e.g. 5.0 or 1e3) are accepted as well.
+ */
+template <typename T>
+CHIP_ERROR ParseJsonInteger(const CharSpan & token, T & outValue)
+{
+    static_assert(std::is_same<T, uint64_t>::value || std::is_same<T, int64_t>::value, "Only 64-bit integers are parsed");
+
+    VerifyOrReturnError(ParseNumericalField(token, outValue) != CHIP_NO_ERROR, CHIP_NO_ERROR);
+
+    constexpr double kUpperLimit = std::is_signed<T>::value ? 9223372036854775808.0 : 18446744073709551616.0;
+    constexpr double kLowerLimit = std::is_signed<T>::value ? -kUpperLimit : 0.0;
+
+    double value;
+    ReturnErrorOnFailure(ParseJsonDouble(token, value));
+    VerifyOrReturnError(std::trunc(value) == value && value >= kLowerLimit && value < kUpperLimit, CHIP_ERROR_INVALID_ARGUMENT);
+    outValue = static_cast<T>(value);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ParseHex4(const char *& pos, const char * end, uint32_t & outValue)
+{
+    VerifyOrReturnError(end - pos >= 4, CHIP_ERROR_INVALID_ARGUMENT);
+    outValue = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        const char c = *pos++;
+        uint32_t digit;
+        if (c >= '0' && c <= '9')
+        {
+            digit = static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        outValue = (outValue << 4) | digit;
+    }
+    return CHIP_NO_ERROR;
+}
+
+char * EncodeUtf8(uint32_t codePoint, char * out)
+{
+    if (codePoint < 0x80)
+    {
+        *out++ = static_cast<char>(codePoint);
+    }
+    else if (codePoint < 0x800)
+    {
+        *out++ = static_cast<char>(0xC0 | (codePoint >> 6));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000)
+    {
+        *out++ = static_cast<char>(0xE0 | (codePoint >> 12));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+        *out++ = static_cast<char>(0xF0 | (codePoint >> 18));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    return out;
+}
+
+/*
+ * Tokenizes JSON text and encodes the elements into a TLVWriter as they are parsed (see JsonToTlvStream).
+ *
+ * Strings are referenced in place in the JSON text unless they contain escape sequences, in which case they are
+ * unescaped into a buffer that is reused for the following strings.
+ */
+class JsonToTlvStreamParser
+{
+public:
+    JsonToTlvStreamParser(const std::string & json, TLV::TLVWriter & writer) :
+        mPos(json.data()), mEnd(json.data() + json.size()), mWriter(writer)
+    {}
+
+    CHIP_ERROR Convert()
+    {
+        ReturnErrorOnFailure(EncodeStruct(TLV::AnonymousTag(), 0));
+        SkipWhitespace();
+        VerifyOrReturnError(mPos == mEnd, CHIP_ERROR_INVALID_ARGUMENT);
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    // Skips whitespace and, like Json::Reader, comments.
+    void SkipWhitespace()
+    {
+        while (mPos < mEnd)
+        {
+            const char c = *mPos;
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+            {
+                mPos++;
+            }
+            else if (c == '/' && mEnd - mPos >= 2 && mPos[1] == '/')
+            {
+                const char * eol = static_cast<const char *>(memchr(mPos, '\n', static_cast<size_t>(mEnd - mPos)));
+                mPos             = (eol != nullptr) ? eol + 1 : mEnd;
+            }
+            else if (c == '/' && mEnd - mPos >= 2 && mPos[1] == '*')
+            {
+                const char * p = mPos + 2;
+                while (p + 1 < mEnd && !(p[0] == '*' && p[1] == '/'))
+                {
+                    p++;
+                }
+                // An unterminated comment is left in place, to fail on the next token
+                VerifyOrReturn(p + 1 < mEnd);
+                mPos = p + 2;
+            }
+            else
+            {
+                return;
+            }
+        }
+    }
+
+    bool Consume(char c)
+    {
+        SkipWhitespace();
+        VerifyOrReturnValue(mPos < mEnd && *mPos == c, false);
+        mPos++;
+        return true;
+    }
+
+    bool Peek(char c)
+    {
+        SkipWhitespace();
+        return mPos < mEnd && *mPos == c;
+    }
+
+    CHIP_ERROR ParseLiteral(const char * literal)
+    {
+        const size_t length = strlen(literal);
+        SkipWhitespace();
+        VerifyOrReturnError(static_cast<size_t>(mEnd - mPos) >= length && memcmp(mPos, literal, length) == 0,
+                            CHIP_ERROR_INVALID_ARGUMENT);
+        mPos += length;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ParseNumber(CharSpan & token)
+    {
+        SkipWhitespace();
+        const char * start = mPos;
+        while (mPos < mEnd && ((*mPos >= '0' && *mPos <= '9') || strchr("+-.eE", *mPos) != nullptr))
+        {
+            mPos++;
+        }
+        VerifyOrReturnError(mPos != start, CHIP_ERROR_INVALID_ARGUMENT);
+        token = CharSpan(start, static_cast<size_t>(mPos - start));
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ParseString(CharSpan & value)
+    {
+        VerifyOrReturnError(Consume('"'), CHIP_ERROR_INVALID_ARGUMENT);
+
+        const char * start = mPos;
+        bool hasEscapes    = false;
+        while (mPos < mEnd && *mPos != '"')
+        {
+            if (*mPos == '\\')
+            {
+                hasEscapes = true;
+                if (++mPos == mEnd)
+                {
+                    break;
+                }
+            }
+            mPos++;
+        }
+        VerifyOrReturnError(mPos < mEnd, CHIP_ERROR_INVALID_ARGUMENT);
+
+        const char * end = mPos++;
+        if (!hasEscapes)
+        {
+            value = CharSpan(start, static_cast<size_t>(end - start));
+            return CHIP_NO_ERROR;
+        }
+        return Unescape(start, end, value);
+    }
+
+    // Every escape sequence is at least as long as the UTF-8 text it stands for, so the unescaped string always
+    // fits in a buffer the size of the escaped one.
+    CHIP_ERROR Unescape(const char * pos, const char * end, CharSpan & value)
+    {
+        ReturnErrorOnFailure(EnsureBufferSize(mStringBuffer, mStringBufferSize, static_cast<size_t>(end - pos)));
+
+        char * out = mStringBuffer.Get();
+        while (pos < end)
+        {
+            char c = *pos++;
+            if (c != '\\')
+            {
+                *out++ = c;
+                continue;
+            }
+
+            // ParseString guarantees that an escaped character follows
+            c = *pos++;
+            switch (c)
+            {
+            case '"':
+            case '\\':
+            case '/':
+                *out++ = c;
+                break;
+            case 'b':
+                *out++ = '\b';
+                break;
+            case 'f':
+                *out++ = '\f';
+                break;
+            case 'n':
+                *out++ = '\n';
+                break;
+            case 'r':
+                *out++ = '\r';
+                break;
+            case 't':
+                *out++ = '\t';
+                break;
+            case 'u': {
+                uint32_t codePoint;
+                ReturnErrorOnFailure(ParseHex4(pos, end, codePoint));
+                VerifyOrReturnError(codePoint < 0xDC00 || codePoint > 0xDFFF, CHIP_ERROR_INVALID_ARGUMENT);
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                {
+                    uint32_t lowSurrogate;
+                    VerifyOrReturnError(end - pos >= 2 && pos[0] == '\\' && pos[1] == 'u', CHIP_ERROR_INVALID_ARGUMENT);
+                    pos += 2;
+                    ReturnErrorOnFailure(ParseHex4(pos, end, lowSurrogate));
+                    VerifyOrReturnError(lowSurrogate >= 0xDC00 && lowSurrogate <= 0xDFFF, CHIP_ERROR_INVALID_ARGUMENT);
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                }
+                out = EncodeUtf8(codePoint, out);
+                break;
+            }
+            default:
+                return CHIP_ERROR_INVALID_ARGUMENT;
+            }
+        }
+
+        value = CharSpan(mStringBuffer.Get(), static_cast<size_t>(out - mStringBuffer.Get()));
+        return CHIP_NO_ERROR;
+    }
+
+    // Same as ParseJsonName, on the unescaped JSON name.
+    CHIP_ERROR ParseElementName(const CharSpan & name, ElementContext & elementCtx)
+    {
+        // The element type is the last field, the tag number the one before it.
+        const char * fieldEnds[3];
+        size_t fieldCount = 0;
+        for (const char * p = name.data(); p < name.data() + name.size(); p++)
+        {
+            if (*p == ':')
+            {
+                VerifyOrReturnError(fieldCount < 2, CHIP_ERROR_INVALID_ARGUMENT);
+                fieldEnds[fieldCount++] = p;
+            }
+        }
+        VerifyOrReturnError(fieldCount >= 1, CHIP_ERROR_INVALID_ARGUMENT);
+        fieldEnds[fieldCount] = name.data() + name.size();
+
+        const char * tagStart = (fieldCount == 1) ? name.data() : fieldEnds[0] + 1;
+        const char * tagEnd   = fieldEnds[fieldCount - 1];
+        const char * typeEnd  = fieldEnds[fieldCount];
+
+        uint32_t tagNumber = 0;
+        ReturnErrorOnFailure(ParseNumericalField(CharSpan(tagStart, static_cast<size_t>(tagEnd - tagStart)), tagNumber));
+        ReturnErrorOnFailure(InternalConvertTlvTag(tagNumber, elementCtx.tag, mWriter.ImplicitProfileId));
+
+        char elementType[16];
+        const size_t typeLength = static_cast<size_t>(typeEnd - tagEnd - 1);
+        VerifyOrReturnError(typeLength < sizeof(elementType), CHIP_ERROR_INVALID_ARGUMENT);
+        memcpy(elementType, tagEnd + 1, typeLength);
+        elementType[typeLength] = '\0';
+
+        elementCtx.type    = ElementTypeContext();
+        elementCtx.subType = ElementTypeContext();
+        ReturnErrorOnFailure(JsonTypeStrToTlvType(elementType, elementCtx.type));
+
+        if (elementCtx.type.tlvType == TLV::kTLVType_Array)
+        {
+            char * separator = strchr(elementType, '-');
+            VerifyOrReturnError(separator != nullptr && strchr(separator + 1, '-') == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+            if (strcmp(separator + 1, kElementTypeEmpty) == 0)
+            {
+                elementCtx.subType.tlvType = TLV::kTLVType_NotSpecified;
+            }
+            else
+            {
+                ReturnErrorOnFailure(JsonTypeStrToTlvType(separator + 1, elementCtx.subType));
+            }
+        }
+
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR EncodeStruct(TLV::Tag tag, uint8_t depth)
+    {
+        TLV::TLVType containerType;
+        VerifyOrReturnError(depth < kMaxStreamingContainerDepth, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(Consume('{'), CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(mWriter.StartContainer(tag, TLV::kTLVType_Structure, containerType));
+
+        if (!Consume('}'))
+        {
+            ElementContext elementCtx;
+            TLV::Tag previousTag = TLV::AnonymousTag();
+            do
+            {
+                CharSpan name;
+                ReturnErrorOnFailure(ParseString(name));
+                ReturnErrorOnFailure(ParseElementName(name, elementCtx));
+
+                // Members are encoded as they come, so they must already be sorted the way JsonToTlv sorts them. Members
+                // with the same tag number are rejected too, as their order after sorting is not defined.
+                VerifyOrReturnError(previousTag == TLV::AnonymousTag() || IsTagOrderedBefore(previousTag, elementCtx.tag),
+                                    CHIP_ERROR_INVALID_TLV_TAG);
+                previousTag = elementCtx.tag;
+
+                VerifyOrReturnError(Consume(':'), CHIP_ERROR_INVALID_ARGUMENT);
+                ReturnErrorOnFailure(EncodeValue(elementCtx, depth));
+            } while (Consume(','));
+
+            VerifyOrReturnError(Consume('}'), CHIP_ERROR_INVALID_ARGUMENT);
+        }
+
+        return mWriter.EndContainer(containerType);
+    }
+
+    CHIP_ERROR EncodeArray(TLV::Tag tag, const ElementTypeContext & subType, uint8_t depth)
+    {
+        TLV::TLVType containerType;
+        VerifyOrReturnError(depth < kMaxStreamingContainerDepth, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(Consume('['), CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(mWriter.StartContainer(tag, TLV::kTLVType_Array, containerType));
+
+        if (!Consume(']'))
+        {
+            VerifyOrReturnError(subType.tlvType != TLV::kTLVType_NotSpecified, CHIP_ERROR_INVALID_ARGUMENT);
+
+            ElementContext nestedElementCtx;
+            nestedElementCtx.tag  = TLV::AnonymousTag();
+            nestedElementCtx.type = subType;
+            do
+            {
+                ReturnErrorOnFailure(EncodeValue(nestedElementCtx, depth));
+            } while (Consume(','));
+
+            VerifyOrReturnError(Consume(']'), CHIP_ERROR_INVALID_ARGUMENT);
+        }
+
+        return mWriter.EndContainer(containerType);
+    }
+
+    // Same as EncodeTlvElement, on the next JSON value of the input.
+    CHIP_ERROR EncodeValue(const ElementContext & elementCtx, uint8_t depth)
+    {
+        TLV::Tag tag = elementCtx.tag;
+
+        switch (elementCtx.type.tlvType)
+        {
+        case TLV::kTLVType_UnsignedInteger: {
+            uint64_t v = 0;
+            CharSpan token;
+            if (Peek('"'))
+            {
+                ReturnErrorOnFailure(ParseString(token));
+                ReturnErrorOnFailure(ParseNumericalField(token, v));
+            }
+            else
+            {
+                ReturnErrorOnFailure(ParseNumber(token));
+                ReturnErrorOnFailure(ParseJsonInteger(token, v));
+            }
+            return mWriter.Put(tag, v);
+        }
+
+        case TLV::kTLVType_SignedInteger: {
+            int64_t v = 0;
+            CharSpan token;
+            if (Peek('"'))
+            {
+                ReturnErrorOnFailure(ParseString(token));
+                ReturnErrorOnFailure(ParseNumericalField(token, v));
+            }
+            else
+            {
+                ReturnErrorOnFailure(ParseNumber(token));
+                ReturnErrorOnFailure(ParseJsonInteger(token, v));
+            }
+            return mWriter.Put(tag, v);
+        }
+
+        case TLV::kTLVType_Boolean: {
+            if (Peek('t'))
+            {
+                ReturnErrorOnFailure(ParseLiteral("true"));
+                return mWriter.PutBoolean(tag, true);
+            }
+            ReturnErrorOnFailure(ParseLiteral("false"));
+            return mWriter.PutBoolean(tag, false);
+        }
+
+        case TLV::kTLVType_FloatingPointNumber: {
+            double v = 0;
+            if (Peek('"'))
+            {
+                CharSpan str;
+                ReturnErrorOnFailure(ParseString(str));
+                if (str.data_equal(CharSpan::fromCharString(kFloatingPointPositiveInfinity)))
+                {
+                    v = std::numeric_limits<double>::infinity();
+                }
+                else if (str.data_equal(CharSpan::fromCharString(kFloatingPointNegativeInfinity)))
+                {
+                    v = -std::numeric_limits<double>::infinity();
+                }
+                else
+                {
+                    return CHIP_ERROR_INVALID_ARGUMENT;
+                }
+            }
+            else
+            {
+                CharSpan token;
+                ReturnErrorOnFailure(ParseNumber(token));
+                ReturnErrorOnFailure(ParseJsonDouble(token, v));
+            }
+
+            if (elementCtx.type.isDouble)
+            {
+                return mWriter.Put(tag, v);
+            }
+            return mWriter.Put(tag, static_cast<float>(v));
+        }
+
+        case TLV::kTLVType_ByteString: {
+            CharSpan str;
+            ReturnErrorOnFailure(ParseString(str));
+            VerifyOrReturnError(CanCastTo<uint16_t>(str.size()), CHIP_ERROR_INVALID_ARGUMENT);
+
+            // Check if the length is a multiple of 4 as strict padding is required.
+            VerifyOrReturnError(str.size() % 4 == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+            const uint16_t encodedLen = static_cast<uint16_t>(str.size());
+            ReturnErrorOnFailure(EnsureBufferSize(mBytesBuffer, mBytesBufferSize, BASE64_MAX_DECODED_LEN(encodedLen)));
+
+            auto decodedLen = Base64Decode(str.data(), encodedLen, mBytesBuffer.Get());
+            VerifyOrReturnError(decodedLen < UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+            return mWriter.PutBytes(tag, mBytesBuffer.Get(), decodedLen);
+        }
+
+        case TLV::kTLVType_UTF8String: {
+            CharSpan str;
+            ReturnErrorOnFailure(ParseString(str));
+            VerifyOrReturnError(CanCastTo<uint32_t>(str.size()), CHIP_ERROR_INVALID_ARGUMENT);
+            return mWriter.PutString(tag, str.data(), static_cast<uint32_t>(str.size()));
+        }
+
+        case TLV::kTLVType_Null:
+            ReturnErrorOnFailure(ParseLiteral("null"));
+            return mWriter.PutNull(tag);
+
+        case TLV::kTLVType_Structure:
+            return EncodeStruct(tag, static_cast<uint8_t>(depth + 1));
+
+        case TLV::kTLVType_Array:
+            return EncodeArray(tag, elementCtx.subType, static_cast<uint8_t>(depth + 1));
+
+        default:
+            return CHIP_ERROR_INVALID_TLV_ELEMENT;
+        }
+    }
+
+    const char * mPos;
+    const char * mEnd;
+    TLV::TLVWriter & mWriter;
+
+    Platform::ScopedMemoryBuffer<char> mStringBuffer;
+    size_t mStringBufferSize = 0;
+    Platform::ScopedMemoryBuffer<uint8_t> mBytesBuffer;
+    size_t mBytesBufferSize = 0;
+};
+
 } // namespace
 
 CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv)
@@ -430,6 +979,36 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
     return EncodeTlvElement(json, writer, elementCtx);
 }
 
+CHIP_ERROR JsonToTlvStream(const std::string & jsonString, MutableByteSpan & tlv)
+{
+    TLV::TLVWriter writer;
+    writer.Init(tlv);
+    writer.ImplicitProfileId = kTemporaryImplicitProfileId;
+
+    CHIP_ERROR err = JsonToTlvStream(jsonString, writer);
+    if (err == CHIP_ERROR_INVALID_TLV_TAG)
+    {
+        // Structure members are not in encoding order: sorting them requires the whole JSON object.
+        return JsonToTlv(jsonString, tlv);
+    }
+    ReturnErrorOnFailure(err);
+    ReturnErrorOnFailure(writer.Finalize());
+    tlv.reduce_size(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonToTlvStream(const std::string & jsonString, TLV::TLVWriter & writer)
+{
+    // Same default implicit profile as JsonToTlv
+    if (writer.ImplicitProfileId == TLV::kProfileIdNotSpecified)
+    {
+        writer.ImplicitProfileId = kTemporaryImplicitProfileId;
+    }
+
+    JsonToTlvStreamParser parser(jsonString, writer);
+    return parser.Convert();
+}
+
 CHIP_ERROR ConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag)
 {
     return InternalConvertTlvTag(tagNumber, tag);
@@ -32,6 +32,25 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv);
  */
 CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer);
 
+/*
+ * Streaming variant of JsonToTlv: the JSON text is tokenized and encoded directly into the TLVWriter, without
+ * building an intermediate JSON object. Only the current string or byte string value is ever copied, and only
+ * when it needs unescaping or base64 decoding.
+ *
+ * Structure members MUST be listed in TLV encoding order (as generated by TlvToJsonStream), since they are
+ * encoded as they are parsed. Structures with out of order members, or with members that have the same tag
+ * number, fail with CHIP_ERROR_INVALID_TLV_TAG.
+ */
+CHIP_ERROR JsonToTlvStream(const std::string & jsonString, TLV::TLVWriter & writer);
+
+/*
+ * Given a JSON object that represents TLV, this function writes the corresponding TLV bytes into the provided buffer
+ * using JsonToTlvStream. Inputs with out of order structure members are converted using JsonToTlv instead, so the
+ * result is always the same as the one of JsonToTlv.
+ * The size of tlv will be adjusted to the size of the actual data written to the buffer.
+ */
+CHIP_ERROR JsonToTlvStream(const std::string & jsonString, MutableByteSpan & tlv);
+
 /*
  * Convert a uint32_t tagNumber (from MEI) to a TLV tag.
  * The upper 16 bits of tag_number represent the vendor_id.
@@ -17,6 +17,11 @@
 
 #include "lib/support/CHIPMemString.h"
 #include "lib/support/ScopedBuffer.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <json/json.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/Base64.h>
@@ -329,6 +334,381 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
     return CHIP_NO_ERROR;
 }
 
+/*
+ * Buffers the JSON text generated by the streaming conversion and hands it over to a JsonStreamOutput
+ * in chunks, so that the conversion only ever holds a small, fixed amount of text.
+ */
+class JsonTextWriter
+{
+public:
+    JsonTextWriter(JsonStreamOutput & output) : mOutput(output) {}
+
+    CHIP_ERROR Put(char c)
+    {
+        if (mLength == sizeof(mBuffer))
+        {
+            ReturnErrorOnFailure(Flush());
+        }
+        mBuffer[mLength++] = c;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Put(const char * data, size_t length)
+    {
+        if (length > sizeof(mBuffer) - mLength)
+        {
+            ReturnErrorOnFailure(Flush());
+            if (length > sizeof(mBuffer))
+            {
+                return mOutput.Write(data, length);
+            }
+        }
+        memcpy(mBuffer + mLength, data, length);
+        mLength += length;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Put(const char * str) { return Put(str, strlen(str)); }
+
+    template <typename T>
+    CHIP_ERROR PutInteger(T value)
+    {
+        char buf[24];
+        auto result = std::to_chars(buf, buf + sizeof(buf), value);
+        VerifyOrReturnError(result.ec == std::errc(), CHIP_ERROR_INTERNAL);
+        return Put(buf, static_cast<size_t>(result.ptr - buf));
+    }
+
+    /*
+     * Writes a JSON string: the quoted text, with quotes, backslashes and control characters escaped.
+     */
+    CHIP_ERROR PutQuoted(const char * data, size_t length)
+    {
+        static const char kHexDigits[] = "0123456789abcdef";
+
+        ReturnErrorOnFailure(Put('"'));
+
+        size_t runStart = 0;
+        for (size_t i = 0; i < length; i++)
+        {
+            const unsigned char c = static_cast<unsigned char>(data[i]);
+            if (c >= 0x20 && c != '"' && c != '\\')
+            {
+                continue;
+            }
+
+            ReturnErrorOnFailure(Put(data + runStart, i - runStart));
+            runStart = i + 1;
+
+            switch (c)
+            {
+            case '"':
+                ReturnErrorOnFailure(Put("\\\"", 2));
+                break;
+            case '\\':
+                ReturnErrorOnFailure(Put("\\\\", 2));
+                break;
+            case '\b':
+                ReturnErrorOnFailure(Put("\\b", 2));
+                break;
+            case '\f':
+                ReturnErrorOnFailure(Put("\\f", 2));
+                break;
+            case '\n':
+                ReturnErrorOnFailure(Put("\\n", 2));
+                break;
+            case '\r':
+                ReturnErrorOnFailure(Put("\\r", 2));
+                break;
+            case '\t':
+                ReturnErrorOnFailure(Put("\\t", 2));
+                break;
+            default: {
+                const char escaped[] = { '\\', 'u', '0', '0', kHexDigits[c >> 4], kHexDigits[c & 0xF] };
+                ReturnErrorOnFailure(Put(escaped, sizeof(escaped)));
+                break;
+            }
+            }
+        }
+        ReturnErrorOnFailure(Put(data + runStart, length - runStart));
+
+        return Put('"');
+    }
+
+    CHIP_ERROR Flush()
+    {
+        VerifyOrReturnError(mLength > 0, CHIP_NO_ERROR);
+        size_t length = mLength;
+        mLength       = 0;
+        return mOutput.Write(mBuffer, length);
+    }
+
+private:
+    JsonStreamOutput & mOutput;
+    char mBuffer[128];
+    size_t mLength = 0;
+};
+
+class StringJsonStreamOutput : public JsonStreamOutput
+{
+public:
+    StringJsonStreamOutput(std::string & str) : mString(str) {}
+
+    CHIP_ERROR Write(const char * data, size_t length) override
+    {
+        mString.append(data, length);
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    std::string & mString;
+};
+
+ElementTypeContext GetElementTypeContext(TLV::TLVReader & reader)
+{
+    ElementTypeContext type;
+    type.tlvType = reader.GetType();
+    if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
+    {
+        type.isDouble = reader.IsElementDouble();
+    }
+    return type;
+}
+
+/*
+ * Writes the '"TagNumber:ElementType-SubElementType":' prefix of a JSON object member.
+ *
+ * As the name of an array contains the type of its elements, which is only known once the array is read,
+ * the first element of the array is peeked at with a copy of the reader.
+ */
+CHIP_ERROR WriteJsonElementName(TLV::TLVReader & reader, JsonTextWriter & out)
+{
+    const TLV::Tag tag = reader.GetTag();
+    uint32_t tagNumber = TLV::TagNumFromTag(tag);
+    if (TLV::IsProfileTag(tag) && TLV::ProfileIdFromTag(tag) != reader.ImplicitProfileId)
+    {
+        tagNumber = (static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | tagNumber;
+    }
+
+    const ElementTypeContext type = GetElementTypeContext(reader);
+
+    ReturnErrorOnFailure(out.Put('"'));
+    ReturnErrorOnFailure(out.PutInteger(tagNumber));
+    ReturnErrorOnFailure(out.Put(':'));
+    ReturnErrorOnFailure(out.Put(GetJsonElementStrFromType(type)));
+
+    if (type.tlvType == TLV::kTLVType_Array)
+    {
+        TLV::TLVReader peekReader;
+        TLV::TLVType containerType;
+        ElementTypeContext subType;
+
+        peekReader.Init(reader);
+        ReturnErrorOnFailure(peekReader.EnterContainer(containerType));
+
+        CHIP_ERROR err = peekReader.Next();
+        if (err == CHIP_NO_ERROR)
+        {
+            subType = GetElementTypeContext(peekReader);
+        }
+        else
+        {
+            VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        }
+
+        ReturnErrorOnFailure(out.Put('-'));
+        ReturnErrorOnFailure(out.Put(GetJsonElementStrFromType(subType)));
+    }
+
+    return out.Put("\":", 2);
+}
+
+CHIP_ERROR WriteJsonDouble(double v, JsonTextWriter & out)
+{
+    if (v == std::numeric_limits<double>::infinity())
+    {
+        return out.PutQuoted(kFloatingPointPositiveInfinity, strlen(kFloatingPointPositiveInfinity));
+    }
+    if (v == -std::numeric_limits<double>::infinity())
+    {
+        return out.PutQuoted(kFloatingPointNegativeInfinity, strlen(kFloatingPointNegativeInfinity));
+    }
+    if (std::isnan(v))
+    {
+        // Same as Json::StyledWriter: JSON has no representation for NaN
+        return out.Put("null", 4);
+    }
+
+    // 17 significant digits, like Json::StyledWriter, so that values round trip exactly
+    char buf[32];
+    int length = snprintf(buf, sizeof(buf), "%.17g", v);
+    VerifyOrReturnError(length > 0 && static_cast<size_t>(length) < sizeof(buf), CHIP_ERROR_INTERNAL);
+    ReturnErrorOnFailure(out.Put(buf, static_cast<size_t>(length)));
+
+    // Keep integer-valued doubles recognizable as real numbers
+    if (strpbrk(buf, ".e") == nullptr)
+    {
+        ReturnErrorOnFailure(out.Put(".0", 2));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TlvToJsonStream(TLV::TLVReader & reader, JsonTextWriter & out);
+
+/*
+ * Given a TLVReader positioned at TLV structure this function:
+ *   - enters structure
+ *   - writes all elements of a structure as JSON object members
+ *   - exits structure
+ */
+CHIP_ERROR TlvStructToJsonStream(TLV::TLVReader & reader, JsonTextWriter & out)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+    bool first = true;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(out.Put('{'));
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        TLV::Tag tag = reader.GetTag();
+        VerifyOrReturnError(TLV::IsContextTag(tag) || TLV::IsProfileTag(tag), CHIP_ERROR_INVALID_TLV_TAG);
+
+        if (TLV::IsProfileTag(tag) && TLV::VendorIdFromTag(tag) == 0)
+        {
+            VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
+        }
+
+        if (!first)
+        {
+            ReturnErrorOnFailure(out.Put(','));
+        }
+        first = false;
+
+        ReturnErrorOnFailure(WriteJsonElementName(reader, out));
+        ReturnErrorOnFailure(TlvToJsonStream(reader, out));
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+    return out.Put('}');
+}
+
+/*
+ * Writes the JSON value of the element the reader is positioned at.
+ */
+CHIP_ERROR TlvToJsonStream(TLV::TLVReader & reader, JsonTextWriter & out)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        if (CanCastTo<uint32_t>(v))
+        {
+            return out.PutInteger(v);
+        }
+        ReturnErrorOnFailure(out.Put('"'));
+        ReturnErrorOnFailure(out.PutInteger(v));
+        return out.Put('"');
+    }
+
+    case TLV::kTLVType_SignedInteger: {
+        int64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        if (CanCastTo<int32_t>(v))
+        {
+            return out.PutInteger(v);
+        }
+        ReturnErrorOnFailure(out.Put('"'));
+        ReturnErrorOnFailure(out.PutInteger(v));
+        return out.Put('"');
+    }
+
+    case TLV::kTLVType_Boolean: {
+        bool v;
+        ReturnErrorOnFailure(reader.Get(v));
+        return v ? out.Put("true", 4) : out.Put("false", 5);
+    }
+
+    case TLV::kTLVType_FloatingPointNumber: {
+        double v;
+        ReturnErrorOnFailure(reader.Get(v));
+        return WriteJsonDouble(v, out);
+    }
+
+    case TLV::kTLVType_ByteString: {
+        ByteSpan span;
+        ReturnErrorOnFailure(reader.Get(span));
+
+        // Encode 3-byte groups a chunk at a time, so that the size of the byte string does not matter.
+        constexpr size_t kChunkSize = 48;
+        char encoded[BASE64_ENCODED_LEN(kChunkSize)];
+
+        ReturnErrorOnFailure(out.Put('"'));
+        while (!span.empty())
+        {
+            const size_t chunkSize = std::min(span.size(), kChunkSize);
+            auto encodedLen        = Base64Encode(span.data(), static_cast<uint16_t>(chunkSize), encoded);
+            ReturnErrorOnFailure(out.Put(encoded, encodedLen));
+            span = span.SubSpan(chunkSize);
+        }
+        return out.Put('"');
+    }
+
+    case TLV::kTLVType_UTF8String: {
+        CharSpan span;
+        ReturnErrorOnFailure(reader.Get(span));
+        return out.PutQuoted(span.data(), span.size());
+    }
+
+    case TLV::kTLVType_Null:
+        return out.Put("null", 4);
+
+    case TLV::kTLVType_Structure:
+        return TlvStructToJsonStream(reader, out);
+
+    case TLV::kTLVType_Array: {
+        CHIP_ERROR err;
+        ElementTypeContext firstSubType;
+        TLV::TLVType containerType;
+        bool first = true;
+
+        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+        ReturnErrorOnFailure(out.Put('['));
+
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+            VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+            ElementTypeContext subType = GetElementTypeContext(reader);
+            if (first)
+            {
+                firstSubType = subType;
+            }
+            else
+            {
+                VerifyOrReturnError(firstSubType.tlvType == subType.tlvType && firstSubType.isDouble == subType.isDouble,
+                                    CHIP_ERROR_INVALID_TLV_ELEMENT);
+                ReturnErrorOnFailure(out.Put(','));
+            }
+            first = false;
+
+            ReturnErrorOnFailure(TlvToJsonStream(reader, out));
+        }
+
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+        return out.Put(']');
+    }
+
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+    }
+}
+
 } // namespace
 
 CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString)
@@ -357,4 +737,31 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString)
     jsonString = writer.write(jsonObject);
     return CHIP_NO_ERROR;
 }
+
+CHIP_ERROR TlvToJsonStream(TLV::TLVReader & reader, JsonStreamOutput & output)
+{
+    // The top level element must be a TLV Structure of Anonymous type.
+    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+
+    // During json conversion, a implicit profile ID is required
+    ImplicitProfileIdChange implicitProfileIdChange(reader, kTemporaryImplicitProfileId);
+
+    JsonTextWriter writer(output);
+    ReturnErrorOnFailure(TlvStructToJsonStream(reader, writer));
+    return writer.Flush();
+}
+
+CHIP_ERROR TlvToJsonStream(const ByteSpan & tlv, std::string & jsonString)
+{
+    TLV::TLVReader reader;
+    reader.Init(tlv);
+    reader.ImplicitProfileId = kTemporaryImplicitProfileId;
+
+    ReturnErrorOnFailure(reader.Next());
+
+    StringJsonStreamOutput output(jsonString);
+    jsonString.clear();
+    return TlvToJsonStream(reader, output);
+}
 } // namespace chip
@@ -33,4 +33,30 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString);
  * Given a TLV encoded byte array, this function converts it into JSON object.
  */
 CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString);
+
+/*
+ * Sink for the JSON text generated by TlvToJsonStream. The text is handed over in order, in chunks of
+ * arbitrary size.
+ */
+class JsonStreamOutput
+{
+public:
+    virtual ~JsonStreamOutput() = default;
+
+    virtual CHIP_ERROR Write(const char * data, size_t length) = 0;
+};
+
+/*
+ * Streaming variant of TlvToJson: the JSON text is written to the output while the TLV is read, without
+ * building an intermediate JSON object, so memory use does not depend on the size of the payload.
+ *
+ * The JSON names and values are the same as the ones generated by TlvToJson, however the text is compact
+ * (no whitespace) and structure members appear in TLV order rather than in alphabetical order of their names.
+ */
+CHIP_ERROR TlvToJsonStream(TLV::TLVReader & reader, JsonStreamOutput & output);
+
+/*
+ * Given a TLV encoded byte array, this function converts it into compact JSON text using TlvToJsonStream.
+ */
+CHIP_ERROR TlvToJsonStream(const ByteSpan & tlv, std::string & jsonString);
 } // namespace chip
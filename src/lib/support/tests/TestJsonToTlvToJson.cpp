@@ -93,6 +93,40 @@ void CheckValidConversion(const std::string & jsonOriginal, const ByteSpan & tlv
         PrintSpan("TLV Encoding Provided as Input for Reference:     ", tlvEncoding);
         PrintSpan("TLV Encoding Generated from Json Expected String: ", tlvEncodingLocal);
     }
+
+    // Verify that the streaming converters agree with the ones above
+    tlvEncodingLocal = MutableByteSpan(buf);
+    err              = JsonToTlvStream(jsonOriginal, tlvEncodingLocal);
+    NL_TEST_ASSERT(gSuite, err == CHIP_NO_ERROR);
+
+    match = tlvEncodingLocal.data_equal(tlvEncoding);
+    NL_TEST_ASSERT(gSuite, match);
+    if (!match)
+    {
+        printf("ERROR: Streaming TLV Encoding Doesn't Match!\n");
+        PrintSpan("TLV Encoding Provided as Input for Reference:   ", tlvEncoding);
+        PrintSpan("TLV Encoding Streamed from Json Input String:   ", tlvEncodingLocal);
+    }
+
+    std::string streamedJsonString;
+    err = TlvToJsonStream(tlvEncoding, streamedJsonString);
+    NL_TEST_ASSERT(gSuite, err == CHIP_NO_ERROR);
+
+    auto compactStreamedString = PrettyPrintJsonString(streamedJsonString);
+    match                      = (compactStreamedString == compactExpectedString);
+    NL_TEST_ASSERT(gSuite, match);
+    if (!match)
+    {
+        printf("ERROR: Streamed Json String Doesn't Match!\n");
+        printf("Expected Json String:\n%s\n", compactExpectedString.c_str());
+        printf("Streamed Json String:\n%s\n", streamedJsonString.c_str());
+    }
+
+    // The streamed JSON lists structure members in encoding order, so it converts back to the same TLV
+    tlvEncodingLocal = MutableByteSpan(buf);
+    err              = JsonToTlvStream(streamedJsonString, tlvEncodingLocal);
+    NL_TEST_ASSERT(gSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(gSuite, tlvEncodingLocal.data_equal(tlvEncoding));
 }
 
 // Boolean true
@@ -1754,6 +1788,9 @@ void TestConverter_TlvToJson_ErrorCases(nlTestSuite * inSuite, void * inContext)
         std::string jsonString;
         err = TlvToJson(testCase.nEncodedTlv, jsonString);
         NL_TEST_ASSERT(inSuite, err == testCase.mExpectedResult);
+
+        err = TlvToJsonStream(testCase.nEncodedTlv, jsonString);
+        NL_TEST_ASSERT(inSuite, err == testCase.mExpectedResult);
     }
 }
 
@@ -1882,6 +1919,11 @@ void TestConverter_JsonToTlv_ErrorCases(nlTestSuite * inSuite, void * inContext)
                    errStr.c_str(), expectedErrStr.c_str(), testCase.mJsonString.c_str());
         }
 #endif // CHIP_CONFIG_ERROR_FORMAT_AS_STRING
+
+        // JSON syntax errors are reported differently by the streaming converter
+        tlvSpan = MutableByteSpan(buf);
+        err     = JsonToTlvStream(testCase.mJsonString, tlvSpan);
+        NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
     }
 }
 
@@ -1919,6 +1961,105 @@ void TestConverter_Struct_MEITags(nlTestSuite * inSuite, void * inContext)
     CheckValidConversion(jsonString, tlvSpan, jsonString);
 }
 
+class ChunkedJsonStreamOutput : public JsonStreamOutput
+{
+public:
+    CHIP_ERROR Write(const char * data, size_t length) override
+    {
+        mChunks++;
+        mString.append(data, length);
+        return CHIP_NO_ERROR;
+    }
+
+    size_t mChunks = 0;
+    std::string mString;
+};
+
+void TestConverter_Streaming(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[1024];
+    uint8_t bytes[300];
+    TLV::TLVWriter writer;
+    TLV::TLVType containerType;
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    const char kEscapedString[] = "quote\" backslash\\ tab\t newline\n bell\x07 euro\xE2\x82\xAC";
+
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.PutString(TLV::ContextTag(1), kEscapedString));
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.PutBytes(TLV::ContextTag(2), bytes, sizeof(bytes)));
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.Put(TLV::ContextTag(3), 2.0));
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.EndContainer(containerType));
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.Finalize());
+    ByteSpan tlvSpan(buf, writer.GetLengthWritten());
+
+    // The JSON text is larger than the internal buffer, so it is handed over in several chunks
+    TLV::TLVReader reader;
+    ChunkedJsonStreamOutput output;
+    reader.Init(tlvSpan);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == reader.Next());
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == TlvToJsonStream(reader, output));
+    NL_TEST_ASSERT(inSuite, output.mChunks > 1);
+
+    std::string jsonString;
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == TlvToJson(tlvSpan, jsonString));
+    NL_TEST_ASSERT(inSuite, PrettyPrintJsonString(output.mString) == PrettyPrintJsonString(jsonString));
+    NL_TEST_ASSERT(inSuite, output.mString.find("\"3:DOUBLE\":2.0") != std::string::npos);
+
+    uint8_t streamedBuf[1024];
+    MutableByteSpan streamedSpan(streamedBuf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == JsonToTlvStream(output.mString, streamedSpan));
+    NL_TEST_ASSERT(inSuite, streamedSpan.data_equal(tlvSpan));
+
+    // Escape sequences, including surrogate pairs, and comments
+    std::string escapes = "{ // strings\n"
+                          "   \"na\\u006De:1:STRING\" : \"\\u00e9\\uD83D\\uDE00\\/\",\n"
+                          "   /* bytes */ \"2:BYTES\" : \"AAEC\\/w==\"\n"
+                          "}\n";
+
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.PutString(TLV::ContextTag(1), "\xC3\xA9\xF0\x9F\x98\x80/"));
+    const uint8_t escapedBytes[] = { 0x00, 0x01, 0x02, 0xFF };
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.PutBytes(TLV::ContextTag(2), escapedBytes, sizeof(escapedBytes)));
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.EndContainer(containerType));
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == writer.Finalize());
+
+    streamedSpan = MutableByteSpan(streamedBuf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == JsonToTlvStream(escapes, streamedSpan));
+    NL_TEST_ASSERT(inSuite, streamedSpan.data_equal(ByteSpan(buf, writer.GetLengthWritten())));
+
+    // Out of order members cannot be streamed into a writer, but are sorted when converting into a buffer
+    std::string unsorted = "{ \"2:UINT\" : 2, \"1:UINT\" : 1 }";
+    writer.Init(streamedBuf);
+    NL_TEST_ASSERT(inSuite, CHIP_ERROR_INVALID_TLV_TAG == JsonToTlvStream(unsorted, writer));
+
+    MutableByteSpan domSpan(buf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == JsonToTlv(unsorted, domSpan));
+    streamedSpan = MutableByteSpan(streamedBuf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == JsonToTlvStream(unsorted, streamedSpan));
+    NL_TEST_ASSERT(inSuite, streamedSpan.data_equal(domSpan));
+
+    // Integral real numbers are accepted as integers, as by JsonToTlv
+    streamedSpan = MutableByteSpan(streamedBuf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == JsonToTlvStream("{ \"1:UINT\" : 1e3 }", streamedSpan));
+    streamedSpan = MutableByteSpan(streamedBuf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR != JsonToTlvStream("{ \"1:UINT\" : 1.5 }", streamedSpan));
+
+    // Truncated or trailing text
+    streamedSpan = MutableByteSpan(streamedBuf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR != JsonToTlvStream("{ \"1:STRING\" : \"abc\\", streamedSpan));
+    streamedSpan = MutableByteSpan(streamedBuf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR != JsonToTlvStream("{ \"1:UINT\" : 1 } 2", streamedSpan));
+    streamedSpan = MutableByteSpan(streamedBuf);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR != JsonToTlvStream("{ \"1:UINT\" : 1 } /*", streamedSpan));
+}
+
 int Initialize(void * apSuite)
 {
     VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
@@ -1986,6 +2127,7 @@ const nlTest sTests[] = {
     NL_TEST_DEF("Test Json Tlv Converter - Tlv to Json Error Cases", TestConverter_TlvToJson_ErrorCases),
     NL_TEST_DEF("Test Json Tlv Converter - Json To Tlv Error Cases", TestConverter_JsonToTlv_ErrorCases),
     NL_TEST_DEF("Test Json Tlv Converter - Structure with MEI Elements", TestConverter_Struct_MEITags),
+    NL_TEST_DEF("Test Json Tlv Converter - Streaming Conversions", TestConverter_Streaming),
     NL_TEST_SENTINEL()
 };
 
@@ -55,6 +55,21 @@ ReliableMessageMgr * ReliableMessageContext::GetReliableMessageMgr()
     return static_cast<ExchangeContext *>(this)->GetExchangeMgr()->GetReliableMessageMgr();
 }
 
+void ReliableMessageContext::SetAckPending(bool inAckPending)
+{
+    mFlags.Set(Flags::kFlagAckPending, inAckPending);
+
+    if (inAckPending)
+    {
+        // mNextAckTime must already be up to date, since it determines the position in the ack queue.
+        GetReliableMessageMgr()->ScheduleAck(this);
+    }
+    else
+    {
+        Unlink();
+    }
+}
+
 void ReliableMessageContext::SetWaitingForAck(bool waitingForAck)
 {
     mFlags.Set(Flags::kFlagWaitingForAck, waitingForAck);
@@ -169,9 +184,9 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAckInner(uint32_t messageCounter,
     }
 
     // Replace the Pending ack message counter.
-    SetPendingPeerAckMessageCounter(messageCounter);
     using namespace System::Clock::Literals;
     mNextAckTime = System::SystemClock().GetMonotonicTimestamp() + CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT;
+    SetPendingPeerAckMessageCounter(messageCounter);
     return CHIP_NO_ERROR;
 }
 
@@ -31,6 +31,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveList.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <system/SystemLayer.h>
 #include <transport/raw/MessageHeader.h>
@@ -48,7 +49,8 @@ class ExchangeContext;
 enum class MessageFlagValues : uint32_t;
 class ReliableMessageMgr;
 
-class ReliableMessageContext
+// The list node links exchanges with a pending standalone ack into the ReliableMessageMgr ack queue, in order of mNextAckTime.
+class ReliableMessageContext : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
 {
 public:
     ReliableMessageContext();
@@ -243,11 +245,6 @@ inline void ReliableMessageContext::SetAutoRequestAck(bool autoReqAck)
     mFlags.Set(Flags::kFlagAutoRequestAck, autoReqAck);
 }
 
-inline void ReliableMessageContext::SetAckPending(bool inAckPending)
-{
-    mFlags.Set(Flags::kFlagAckPending, inAckPending);
-}
-
 inline bool ReliableMessageContext::IsEphemeralExchange() const
 {
     return mFlags.Has(Flags::kFlagEphemeralExchange);
@@ -66,7 +66,11 @@ ReliableMessageMgr::ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_M
     mContextPool(contextPool), mSystemLayer(nullptr)
 {}
 
-ReliableMessageMgr::~ReliableMessageMgr() {}
+ReliableMessageMgr::~ReliableMessageMgr()
+{
+    mPendingAcks.Clear();
+    mRetransQueue.Clear();
+}
 
 void ReliableMessageMgr::Init(chip::System::Layer * systemLayer)
 {
@@ -77,6 +81,9 @@ void ReliableMessageMgr::Shutdown()
 {
     StopTimer();
 
+    // Exchanges may outlive the manager; make sure they are no longer linked to it.
+    mPendingAcks.Clear();
+
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         mRetransTable.ReleaseObject(entry);
@@ -110,23 +117,50 @@ void ReliableMessageMgr::ExecuteActions()
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions at 0x" ChipLogFormatX64 "ms", ChipLogValueX64(now.count()));
 #endif
 
-    ExecuteForAllContext([&](ReliableMessageContext * rc) {
-        if (rc->IsAckPending())
-        {
-            if (rc->mNextAckTime <= now)
-            {
+    // Move everything that is due out of the sorted queues first.  Sending may release other exchanges and entries, which then
+    // simply unlink themselves from the local lists, and anything rescheduled while processing goes back to the queues, so
+    // every item is visited at most once per call.
+    IntrusiveList<ReliableMessageContext, IntrusiveMode::AutoUnlink> dueAcks;
+    while (!mPendingAcks.Empty() && mPendingAcks.begin()->mNextAckTime <= now)
+    {
+        ReliableMessageContext * rc = &(*mPendingAcks.begin());
+        mPendingAcks.Remove(rc);
+        dueAcks.PushBack(rc);
+    }
+
+    IntrusiveList<RetransTableEntry, IntrusiveMode::AutoUnlink> dueEntries;
+    while (!mRetransQueue.Empty() && mRetransQueue.begin()->nextRetransTime <= now)
+    {
+        RetransTableEntry * entry = &(*mRetransQueue.begin());
+        mRetransQueue.Remove(entry);
+        dueEntries.PushBack(entry);
+    }
+
+    while (!dueAcks.Empty())
+    {
+        ReliableMessageContext * rc = &(*dueAcks.begin());
+        dueAcks.Remove(rc);
+
+        // Make sure our exchange stays alive until we are done working with it.
+        ExchangeHandle ec(*rc->GetExchangeContext());
+
 #if defined(RMP_TICKLESS_DEBUG)
-                ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK %p", rc);
+        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK %p", rc);
 #endif
-                rc->SendStandaloneAckMessage();
-            }
+        rc->SendStandaloneAckMessage();
+
+        // If the ack could not be sent, it stays pending and is retried on the next tick.
+        if (rc->IsAckPending() && !rc->IsInList())
+        {
+            InsertSorted(mPendingAcks, rc, &ReliableMessageContext::mNextAckTime);
         }
-    });
+    }
 
     // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
+    while (!dueEntries.Empty())
+    {
+        RetransTableEntry * entry = &(*dueEntries.begin());
+        dueEntries.Remove(entry);
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -164,7 +198,7 @@ void ReliableMessageMgr::ExecuteActions()
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
             mRetransTable.ReleaseObject(entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -175,9 +209,7 @@ void ReliableMessageMgr::ExecuteActions()
 
         CalculateNextRetransTime(*entry);
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -377,26 +409,27 @@ void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
     StartTimer();
 }
 
+void ReliableMessageMgr::ScheduleAck(ReliableMessageContext * rc)
+{
+    rc->Unlink();
+    InsertSorted(mPendingAcks, rc, &ReliableMessageContext::mNextAckTime);
+}
+
 void ReliableMessageMgr::StartTimer()
 {
     // When do we need to next wake up to send an ACK?
     System::Clock::Timestamp nextWakeTime = System::Clock::Timestamp::max();
 
-    ExecuteForAllContext([&](ReliableMessageContext * rc) {
-        if (rc->IsAckPending() && rc->mNextAckTime < nextWakeTime)
-        {
-            nextWakeTime = rc->mNextAckTime;
-        }
-    });
+    if (!mPendingAcks.Empty())
+    {
+        nextWakeTime = mPendingAcks.begin()->mNextAckTime;
+    }
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (!mRetransQueue.Empty() && mRetransQueue.begin()->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransQueue.begin()->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -480,6 +513,9 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 
     System::Clock::Timestamp backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime            = System::SystemClock().GetMonotonicTimestamp() + backoff;
+
+    entry.Unlink();
+    InsertSorted(mRetransQueue, &entry, &RetransTableEntry::nextRetransTime);
 }
 
 #if CHIP_CONFIG_TEST
@@ -492,6 +528,39 @@ int ReliableMessageMgr::TestGetCountRetransTable()
     });
     return count;
 }
+
+bool ReliableMessageMgr::TestCheckQueues()
+{
+    int queuedAcks = 0;
+    for (auto it = mPendingAcks.begin(); it != mPendingAcks.end(); ++it)
+    {
+        auto next = it;
+        ++next;
+        VerifyOrReturnValue(it->IsAckPending(), false);
+        VerifyOrReturnValue(next == mPendingAcks.end() || it->mNextAckTime <= next->mNextAckTime, false);
+        queuedAcks++;
+    }
+
+    int pendingAcks = 0;
+    ExecuteForAllContext([&](ReliableMessageContext * rc) {
+        if (rc->IsAckPending())
+        {
+            pendingAcks++;
+        }
+    });
+    VerifyOrReturnValue(queuedAcks == pendingAcks, false);
+
+    int queuedEntries = 0;
+    for (auto it = mRetransQueue.begin(); it != mRetransQueue.end(); ++it)
+    {
+        auto next = it;
+        ++next;
+        VerifyOrReturnValue(next == mRetransQueue.end() || it->nextRetransTime <= next->nextRetransTime, false);
+        queuedEntries++;
+    }
+
+    return queuedEntries == TestGetCountRetransTable();
+}
 #endif // CHIP_CONFIG_TEST
 
 } // namespace Messaging
@@ -29,6 +29,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/Pool.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
@@ -55,8 +56,11 @@ public:
      *    acknowledgment back. If the acknowledgment is not received within a
      *    specific timeout, the message would be retransmitted from this table.
      *
+     *    Once scheduled, entries are linked into the retransmission queue of
+     *    the manager, in order of nextRetransTime.
+     *
      */
-    struct RetransTableEntry
+    struct RetransTableEntry : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
     {
         RetransTableEntry(ReliableMessageContext * rc);
         ~RetransTableEntry();
@@ -75,9 +79,8 @@ public:
     void Shutdown();
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
-     * action needs to be triggered by ReliableMessageProtocol time facilities,
-     * execute that action.
+     * Send the standalone acks and retransmissions that are due.  Pending acks and
+     * retransmissions are kept sorted by deadline, so only the due ones are visited.
      */
     void ExecuteActions();
 
@@ -161,11 +164,13 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
      * Determine how many ReliableMessageProtocol ticks we need to sleep before we
      * need to physically wake the CPU to perform an action.  Set a timer to go off
      * when we next need to wake the system.
      *
+     * This only looks at the earliest pending ack and the earliest retransmission,
+     * so its cost does not depend on the number of exchanges.
+     *
      */
     void StartTimer();
 
@@ -196,6 +201,10 @@ public:
     // Functions for testing
     int TestGetCountRetransTable();
 
+    // Returns true if the ack and retransmission queues are sorted by deadline and
+    // hold every exchange with a pending ack and every retransmission table entry.
+    bool TestCheckQueues();
+
     // Enumerate the retransmission table.  Clearing an entry while enumerating
     // that entry is allowed.  F must take a RetransTableEntry as an argument
     // and return Loop::Continue or Loop::Break.
@@ -227,9 +236,41 @@ public:
 #endif // CHIP_DEVICE_CONFIG_ENABLE_DYNAMIC_MRP_CONFIG
 
 private:
+    friend class ReliableMessageContext;
+
+    /**
+     * Queue a standalone ack for the context, according to its mNextAckTime.
+     * The context is moved if it is already queued.
+     */
+    void ScheduleAck(ReliableMessageContext * rc);
+
+    /**
+     * Link the item into the list, which is sorted by the given timestamp member.
+     * Deadlines are mostly scheduled in increasing order, so the insertion point
+     * is searched from the back of the list.
+     */
+    template <typename T>
+    static void InsertSorted(IntrusiveList<T, IntrusiveMode::AutoUnlink> & list, T * item,
+                             System::Clock::Timestamp T::*deadline)
+    {
+        auto position = list.end();
+        while (position != list.begin())
+        {
+            auto previous = position;
+            --previous;
+            if ((*previous).*deadline <= item->*deadline)
+            {
+                break;
+            }
+            position = previous;
+        }
+        list.InsertBefore(position, item);
+    }
+
     /**
      * Calculates the next retransmission time for the entry
-     * Function sets the nextRetransTime of the entry
+     * Function sets the nextRetransTime of the entry and moves it
+     * to its new position in the retransmission queue.
      *
      * @param[in,out] entry RetransTableEntry for which we need to calculate the nextRetransTime
      */
@@ -253,6 +294,12 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    // Contexts with a pending standalone ack, sorted by mNextAckTime.
+    IntrusiveList<ReliableMessageContext, IntrusiveMode::AutoUnlink> mPendingAcks;
+
+    // Scheduled entries of mRetransTable, sorted by nextRetransTime.
+    IntrusiveList<RetransTableEntry, IntrusiveMode::AutoUnlink> mRetransQueue;
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 
 #if CHIP_DEVICE_CONFIG_ENABLE_DYNAMIC_MRP_CONFIG
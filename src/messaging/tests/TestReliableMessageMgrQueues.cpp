@@ -0,0 +1,306 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements tests for the deadline-sorted ack and
+ *      retransmission queues of the ReliableMessageMgr.
+ */
+
+#include <lib/core/CHIPCore.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/ReliableMessageContext.h>
+#include <messaging/ReliableMessageMgr.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/echo/Echo.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Messaging;
+using namespace chip::Protocols;
+using namespace chip::System::Clock::Literals;
+
+const char PAYLOAD[] = "Hello!";
+
+// Bob's exchanges and the ones Alice opens to receive the messages share the exchange pool.
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+constexpr unsigned kMessageCount = 64;
+#else
+constexpr unsigned kMessageCount = std::min(static_cast<unsigned>(CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE),
+                                            static_cast<unsigned>(CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2));
+#endif
+
+// Number of idle ticks timed by the tick cost benchmark.
+constexpr unsigned kTickIterations = 10000;
+
+System::Clock::Internal::MockClock gMockClock;
+System::Clock::ClockBase * gRealClock;
+
+class TestContext : public chip::Test::LoopbackMessagingContext
+{
+public:
+    CHIP_ERROR SetUpTestSuite() override
+    {
+        ReturnErrorOnFailure(chip::Test::LoopbackMessagingContext::SetUpTestSuite());
+        gRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&gMockClock);
+        return CHIP_NO_ERROR;
+    }
+
+    void TearDownTestSuite() override
+    {
+        System::Clock::Internal::SetSystemClockForTesting(gRealClock);
+        chip::Test::LoopbackMessagingContext::TearDownTestSuite();
+    }
+};
+
+class MockAppDelegate : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        mReceivedCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    unsigned mReceivedCount = 0;
+};
+
+// Number of retransmission table entries that are due at the current time.
+unsigned CountDueEntries(ReliableMessageMgr * rm)
+{
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    unsigned count               = 0;
+    rm->EnumerateRetransTable([&](auto * entry) {
+        if (entry->nextRetransTime <= now)
+        {
+            count++;
+        }
+        return Loop::Continue;
+    });
+    return count;
+}
+
+System::Clock::Timestamp EarliestDeadlineAfter(ReliableMessageMgr * rm, System::Clock::Timestamp time)
+{
+    System::Clock::Timestamp earliest = System::Clock::Timestamp::max();
+    rm->EnumerateRetransTable([&](auto * entry) {
+        if (entry->nextRetransTime > time)
+        {
+            earliest = std::min(earliest, entry->nextRetransTime);
+        }
+        return Loop::Continue;
+    });
+    return earliest;
+}
+
+// Fill the retransmission table with kMessageCount messages that do not reach Alice. The random part of the backoff makes the
+// deadlines arrive out of order, so entries are inserted in the middle of the queue as well as at its end.
+void FillRetransTable(nlTestSuite * inSuite, TestContext & ctx, MockAppDelegate & bobDelegate)
+{
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+
+    ctx.GetLoopback().mNumMessagesToDrop = chip::Test::LoopbackTransport::kUnlimitedMessageCount;
+    for (unsigned i = 0; i < kMessageCount; i++)
+    {
+        ExchangeContext * exchange = ctx.NewExchangeToAlice(&bobDelegate);
+        NL_TEST_ASSERT(inSuite, exchange != nullptr);
+        VerifyOrReturn(exchange != nullptr);
+
+        System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+        CHIP_ERROR err = exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        gMockClock.AdvanceMonotonic(1_ms);
+        NL_TEST_ASSERT(inSuite, rm->TestCheckQueues());
+    }
+}
+
+// Let the next retransmissions through so that Alice acks them and the queue drains. Alice acks every message, but her message
+// counter window treats the ones that arrive too far out of counter order as duplicates and does not deliver them.
+void DrainRetransTable(nlTestSuite * inSuite, TestContext & ctx)
+{
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    auto & loopback         = ctx.GetLoopback();
+
+    uint32_t sentLimit          = loopback.mSentMessageCount + 8 * kMessageCount;
+    loopback.mNumMessagesToDrop = 0;
+    while (rm->TestGetCountRetransTable() > 0 && loopback.mSentMessageCount < sentLimit)
+    {
+        System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        gMockClock.AdvanceMonotonic(EarliestDeadlineAfter(rm, now) - now);
+        rm->ExecuteActions();
+        ctx.DrainAndServiceIO();
+        NL_TEST_ASSERT(inSuite, rm->TestCheckQueues());
+    }
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+}
+
+void CheckRetransmissionsFollowDeadlines(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate aliceDelegate;
+    MockAppDelegate bobDelegate;
+    CHIP_ERROR err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &aliceDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    auto & loopback         = ctx.GetLoopback();
+
+    FillRetransTable(inSuite, ctx, bobDelegate);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == static_cast<int>(kMessageCount));
+    NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == kMessageCount);
+
+    // A tick before any deadline sends nothing.
+    NL_TEST_ASSERT(inSuite, CountDueEntries(rm) == 0);
+    rm->ExecuteActions();
+    NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == kMessageCount);
+
+    // Step from one deadline to the next until every message has been retransmitted once: each tick retransmits exactly
+    // the entries that are due, and the rescheduled entries go back to their place in the queue.
+    System::Clock::Timestamp lastFirstDeadline = System::Clock::kZero;
+    rm->EnumerateRetransTable([&](auto * entry) {
+        lastFirstDeadline = std::max(lastFirstDeadline, entry->nextRetransTime);
+        return Loop::Continue;
+    });
+
+    unsigned ticks = 0;
+    while (System::SystemClock().GetMonotonicTimestamp() < lastFirstDeadline)
+    {
+        System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        gMockClock.AdvanceMonotonic(EarliestDeadlineAfter(rm, now) - now);
+
+        unsigned due  = CountDueEntries(rm);
+        uint32_t sent = loopback.mSentMessageCount;
+        NL_TEST_ASSERT(inSuite, due > 0);
+
+        rm->ExecuteActions();
+        NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == sent + due);
+        NL_TEST_ASSERT(inSuite, CountDueEntries(rm) == 0);
+        NL_TEST_ASSERT(inSuite, rm->TestCheckQueues());
+        ticks++;
+    }
+    NL_TEST_ASSERT(inSuite, ticks > 0);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == static_cast<int>(kMessageCount));
+    rm->EnumerateRetransTable([&](auto * entry) {
+        NL_TEST_ASSERT(inSuite, entry->sendCount >= 1);
+        return Loop::Continue;
+    });
+
+    DrainRetransTable(inSuite, ctx);
+    NL_TEST_ASSERT(inSuite, aliceDelegate.mReceivedCount > 0 && aliceDelegate.mReceivedCount <= kMessageCount);
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+void CompareIdleTickWithPoolScan(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate aliceDelegate;
+    MockAppDelegate bobDelegate;
+    CHIP_ERROR err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &aliceDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    auto & loopback         = ctx.GetLoopback();
+    loopback.Reset();
+
+    FillRetransTable(inSuite, ctx, bobDelegate);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == static_cast<int>(kMessageCount));
+    NL_TEST_ASSERT(inSuite, CountDueEntries(rm) == 0);
+
+    // Time ticks where nothing is due, which is what almost every tick looks like. The sorted queues only look at their
+    // first entry.
+    System::Clock::Microseconds64 start = gRealClock->GetMonotonicMicroseconds64();
+    for (unsigned i = 0; i < kTickIterations; i++)
+    {
+        rm->ExecuteActions();
+    }
+    System::Clock::Microseconds64 queueElapsed = gRealClock->GetMonotonicMicroseconds64() - start;
+    NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == kMessageCount);
+
+    // Time the same ticks the way they were served before the queues: by walking every entry of the retransmission pool
+    // and comparing its deadline with the current time.
+    unsigned dueInScans = 0;
+    start               = gRealClock->GetMonotonicMicroseconds64();
+    for (unsigned i = 0; i < kTickIterations; i++)
+    {
+        dueInScans += CountDueEntries(rm);
+    }
+    System::Clock::Microseconds64 scanElapsed = gRealClock->GetMonotonicMicroseconds64() - start;
+    NL_TEST_ASSERT(inSuite, dueInScans == 0);
+
+    ChipLogProgress(Test, "RMP idle tick with %u pending retransmissions: %" PRIu64 " ns sorted queue, %" PRIu64 " ns pool scan",
+                    kMessageCount, static_cast<uint64_t>(queueElapsed.count()) * 1000 / kTickIterations,
+                    static_cast<uint64_t>(scanElapsed.count()) * 1000 / kTickIterations);
+
+    DrainRetransTable(inSuite, ctx);
+    NL_TEST_ASSERT(inSuite, aliceDelegate.mReceivedCount > 0 && aliceDelegate.mReceivedCount <= kMessageCount);
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test ReliableMessageMgr retransmissions follow the deadline-sorted queue", CheckRetransmissionsFollowDeadlines),
+    NL_TEST_DEF("Test ReliableMessageMgr idle tick cost versus a pool scan", CompareIdleTickWithPoolScan),
+    NL_TEST_SENTINEL(),
+};
+
+// clang-format off
+nlTestSuite sSuite = {
+    "Test-CHIP-ReliableMessageMgrQueues",
+    &sTests[0],
+    TestContext::nlTestSetUpTestSuite,
+    TestContext::nlTestTearDownTestSuite,
+    TestContext::nlTestSetUp,
+    TestContext::nlTestTearDown,
+};
+// clang-format on
+
+} // namespace
+
+int TestReliableMessageMgrQueuesSuite()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestReliableMessageMgrQueuesSuite)
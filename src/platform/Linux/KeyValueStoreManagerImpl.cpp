@@ -84,7 +84,7 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value,
     SuccessOrExit(err);
 
     // Commit the value to the persistent store.
-    err = mStorage.Commit();
+    err = CommitOrDefer();
     SuccessOrExit(err);
 
 exit:
@@ -103,13 +103,32 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
     SuccessOrExit(err);
 
     // Commit the value to the persistent store.
-    err = mStorage.Commit();
+    err = CommitOrDefer();
     SuccessOrExit(err);
 
 exit:
     return err;
 }
 
+CHIP_ERROR KeyValueStoreManagerImpl::EndBatch()
+{
+    VerifyOrReturnError(mBatchDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(--mBatchDepth == 0 && mBatchDirty, CHIP_NO_ERROR);
+
+    mBatchDirty = false;
+    return mStorage.Commit();
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::CommitOrDefer()
+{
+    if (mBatchDepth > 0)
+    {
+        mBatchDirty = true;
+        return CHIP_NO_ERROR;
+    }
+    return mStorage.Commit();
+}
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
@@ -42,8 +42,25 @@ public:
     CHIP_ERROR _Delete(const char * key);
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
+    /**
+     * @brief
+     * Start a batch of updates. Every put and delete normally rewrites the whole storage file; within a batch they are only
+     * applied in memory, and the file is written once by the matching EndBatch(). Batches may be nested.
+     */
+    void BeginBatch() { mBatchDepth++; }
+
+    /**
+     * @brief
+     * End a batch started by BeginBatch(), and commit the updates made during the batch if it was the outermost one.
+     */
+    CHIP_ERROR EndBatch();
+
 private:
+    CHIP_ERROR CommitOrDefer();
+
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+    uint32_t mBatchDepth = 0;
+    bool mBatchDirty     = false;
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
@@ -0,0 +1,327 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/PASEVerifierGenerator.h>
+
+#include <atomic>
+#include <string.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/LockTracker.h>
+#include <platform/PlatformManager.h>
+#include <setup_payload/SetupPayload.h>
+#include <tracing/macros.h>
+
+namespace chip {
+
+using namespace Crypto;
+
+namespace {
+
+#if CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+
+using VerifierCacheKey = uint8_t[kSHA256_Hash_Length];
+
+// Verifiers are looked up by an HMAC of their inputs under a random secret that never leaves this process.
+// A plain digest would not do: passcodes have under 27 bits of entropy, so the passcode behind a digest of
+// known salt and iteration count could be found by trying them all.
+class VerifierCache
+{
+public:
+    CHIP_ERROR ComputeKey(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPIN, VerifierCacheKey & key)
+    {
+        if (!mHasSecret)
+        {
+            ReturnErrorOnFailure(DRBG_get_bytes(mSecret, sizeof(mSecret)));
+            mHasSecret = true;
+        }
+
+        VerifyOrReturnError(salt.size() <= kSpake2p_Max_PBKDF_Salt_Length, CHIP_ERROR_INVALID_ARGUMENT);
+        uint8_t message[2 * sizeof(uint32_t) + kSpake2p_Max_PBKDF_Salt_Length];
+        Encoding::LittleEndian::Put32(&message[0], pbkdf2IterCount);
+        Encoding::LittleEndian::Put32(&message[sizeof(uint32_t)], setupPIN);
+        if (!salt.empty())
+        {
+            memcpy(&message[2 * sizeof(uint32_t)], salt.data(), salt.size());
+        }
+
+        HMAC_sha hmac;
+        CHIP_ERROR err = hmac.HMAC_SHA256(mSecret, sizeof(mSecret), message, 2 * sizeof(uint32_t) + salt.size(), key, sizeof(key));
+        ClearSecretData(message);
+        return err;
+    }
+
+    bool Find(const VerifierCacheKey & key, Spake2pVerifier & verifier)
+    {
+        for (auto & entry : mEntries)
+        {
+            if (entry.valid && memcmp(entry.key, key, sizeof(key)) == 0)
+            {
+                entry.lastUsed = ++mUseCounter;
+                verifier       = entry.verifier;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Add(const VerifierCacheKey & key, const Spake2pVerifier & verifier)
+    {
+        // Reuse a free entry, else the least recently used one
+        Entry * slot = &mEntries[0];
+        for (auto & entry : mEntries)
+        {
+            if (!entry.valid)
+            {
+                slot = &entry;
+                break;
+            }
+            if (entry.lastUsed < slot->lastUsed)
+            {
+                slot = &entry;
+            }
+        }
+
+        slot->Clear();
+        memcpy(slot->key, key, sizeof(key));
+        slot->verifier = verifier;
+        slot->lastUsed = ++mUseCounter;
+        slot->valid    = true;
+    }
+
+    void Clear()
+    {
+        for (auto & entry : mEntries)
+        {
+            entry.Clear();
+        }
+        // A new secret is drawn on next use, so keys computed before the clear never match again.
+        ClearSecretData(mSecret);
+        mHasSecret = false;
+    }
+
+private:
+    struct Entry
+    {
+        void Clear()
+        {
+            ClearSecretData(key);
+            ClearSecretData(verifier.mW0);
+            ClearSecretData(verifier.mL);
+            lastUsed = 0;
+            valid    = false;
+        }
+
+        VerifierCacheKey key;
+        Spake2pVerifier verifier;
+        uint32_t lastUsed = 0;
+        bool valid        = false;
+    };
+
+    Entry mEntries[CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE];
+    uint32_t mUseCounter = 0;
+    uint8_t mSecret[kSHA256_Hash_Length];
+    bool mHasSecret = false;
+};
+
+VerifierCache gVerifierCache;
+
+#endif // CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+
+// How many times the background work tries again to schedule the completion, when the Matter event queue is full.
+constexpr uint8_t kMaxCompletionRetries = 16;
+
+} // namespace
+
+// A verifier generation in progress. It is owned by the scheduled work until CompletionHandler, which
+// always deletes it, runs on the Matter thread.
+struct PASEVerifierGenerator::Job
+{
+    ~Job()
+    {
+        ClearSecretData(reinterpret_cast<uint8_t *>(&setupPIN), sizeof(setupPIN));
+        ClearSecretData(verifier.mW0);
+        ClearSecretData(verifier.mL);
+    }
+
+    uint32_t pbkdf2IterCount = 0;
+    uint8_t salt[kSpake2p_Max_PBKDF_Salt_Length];
+    size_t saltLength = 0;
+    uint32_t setupPIN = 0;
+
+#if CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+    VerifierCacheKey cacheKey;
+    bool cacheable = false;
+#endif // CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+
+    Spake2pVerifier verifier;
+    CHIP_ERROR status = CHIP_NO_ERROR;
+
+    // Only accessed by the background work.
+    bool generated            = false;
+    uint8_t completionRetries = 0;
+
+    // Only accessed on the Matter thread; cleared when the generation is cancelled.
+    PASEVerifierGenerator * generator = nullptr;
+    Delegate * delegate               = nullptr;
+
+    // Lets the background work skip PBKDF2 for cancelled jobs.
+    std::atomic<bool> cancelled{ false };
+
+    // Set by the first of Cancel() and a background work that failed to schedule CompletionHandler;
+    // the second one deletes the job, as nothing else references it anymore.
+    std::atomic<bool> detached{ false };
+};
+
+CHIP_ERROR PASEVerifierGenerator::Generate(uint32_t pbkdf2IterCount, const ByteSpan & salt, bool useRandomPIN,
+                                           uint32_t & setupPIN, Delegate * delegate)
+{
+    MATTER_TRACE_SCOPE("GeneratePASEVerifierAsync", "PASESession");
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(salt.size() <= kSpake2p_Max_PBKDF_Salt_Length, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Cancel();
+
+    if (useRandomPIN)
+    {
+        ReturnErrorOnFailure(DRBG_get_bytes(reinterpret_cast<uint8_t *>(&setupPIN), sizeof(setupPIN)));
+
+        // Passcodes shall be restricted to the values 00000001 to 99999998 in decimal, see 5.1.1.6
+        setupPIN = (setupPIN % kSetupPINCodeMaximumValue) + 1;
+    }
+
+    Job * job = Platform::New<Job>();
+    VerifyOrReturnError(job != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    job->pbkdf2IterCount = pbkdf2IterCount;
+    if (!salt.empty())
+    {
+        memcpy(job->salt, salt.data(), salt.size());
+    }
+    job->saltLength = salt.size();
+    job->setupPIN   = setupPIN;
+    job->generator  = this;
+    job->delegate   = delegate;
+
+    bool cached = false;
+#if CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+    // Random passcodes are never asked for again, so only provided ones are cached.
+    if (!useRandomPIN && gVerifierCache.ComputeKey(pbkdf2IterCount, salt, setupPIN, job->cacheKey) == CHIP_NO_ERROR)
+    {
+        cached         = gVerifierCache.Find(job->cacheKey, job->verifier);
+        job->cacheable = !cached;
+    }
+#endif // CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+
+    // The delegate is always called asynchronously, including for cached verifiers.
+    CHIP_ERROR err = cached ? DeviceLayer::PlatformMgr().ScheduleWork(CompletionHandler, reinterpret_cast<intptr_t>(job))
+                            : DeviceLayer::PlatformMgr().ScheduleBackgroundWork(GenerateHandler, reinterpret_cast<intptr_t>(job));
+    if (err != CHIP_NO_ERROR)
+    {
+        Platform::Delete(job);
+        return err;
+    }
+
+    mJob = job;
+    return CHIP_NO_ERROR;
+}
+
+void PASEVerifierGenerator::Cancel()
+{
+    VerifyOrReturn(mJob != nullptr);
+
+    Job * job = mJob;
+    mJob      = nullptr;
+
+    job->generator = nullptr;
+    job->cancelled.store(true);
+    if (job->detached.exchange(true))
+    {
+        Platform::Delete(job);
+    }
+}
+
+void PASEVerifierGenerator::ClearCache()
+{
+#if CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+    assertChipStackLockedByCurrentThread();
+    gVerifierCache.Clear();
+#endif // CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+}
+
+void PASEVerifierGenerator::GenerateHandler(intptr_t arg)
+{
+    auto * job = reinterpret_cast<Job *>(arg);
+
+    // Runs in the background: only the inputs and outputs of the job may be touched here.
+    if (job->cancelled.load())
+    {
+        job->status = CHIP_ERROR_CANCELLED;
+    }
+    else if (!job->generated)
+    {
+        job->status    = job->verifier.Generate(job->pbkdf2IterCount, ByteSpan(job->salt, job->saltLength), job->setupPIN);
+        job->generated = true;
+    }
+
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(CompletionHandler, arg);
+    if (err != CHIP_NO_ERROR && !job->cancelled.load() && job->completionRetries++ < kMaxCompletionRetries)
+    {
+        // The delegate is still waiting: try again once the Matter thread had a chance to drain its queue.
+        ChipLogError(SecureChannel, "Failed to schedule PASE verifier completion, retrying: %" CHIP_ERROR_FORMAT, err.Format());
+        err = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(GenerateHandler, arg);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to schedule PASE verifier completion: %" CHIP_ERROR_FORMAT, err.Format());
+        if (job->detached.exchange(true))
+        {
+            Platform::Delete(job);
+        }
+    }
+}
+
+void PASEVerifierGenerator::CompletionHandler(intptr_t arg)
+{
+    assertChipStackLockedByCurrentThread();
+
+    auto * job = reinterpret_cast<Job *>(arg);
+
+#if CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+    // Worth keeping even if the generation was cancelled meanwhile
+    if (job->cacheable && job->status == CHIP_NO_ERROR)
+    {
+        gVerifierCache.Add(job->cacheKey, job->verifier);
+    }
+#endif // CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE > 0
+
+    if (job->generator != nullptr)
+    {
+        job->generator->mJob = nullptr;
+        // The delegate may delete the generator or start a new generation, but no longer references the job.
+        job->delegate->OnPASEVerifierGenerated(job->status, job->verifier);
+    }
+
+    Platform::Delete(job);
+}
+
+} // namespace chip
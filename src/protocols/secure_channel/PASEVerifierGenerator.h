@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Generation of PASE verifiers off the Matter thread.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+
+/**
+ * Generates PASE verifiers as background work, delivering them on the Matter thread.
+ *
+ * The PBKDF2 derivation, which runs up to kSpake2p_Max_PBKDF_Iterations iterations, is done through
+ * PlatformManager::ScheduleBackgroundWork. It only leaves the Matter thread on platforms that process
+ * background events on their own task (CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING). Elsewhere it runs
+ * as a separate event of the Matter thread, which it blocks while it runs, but only once the events
+ * queued before it have been processed.
+ *
+ * Verifiers for provided passcodes are kept in a cache shared by all generators (see
+ * CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE), so that generating the same verifier again completes without
+ * running PBKDF2. The cache is keyed by an HMAC of the passcode, salt and iteration count under a random
+ * per-process secret. The verifiers it holds are passcode equivalents, though, so ClearCache() must be
+ * called once they are no longer needed.
+ *
+ * All methods must be called with the Matter stack lock held.
+ */
+class PASEVerifierGenerator
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Called on the Matter thread once the verifier requested through Generate() is available, or
+         * its generation failed.
+         */
+        virtual void OnPASEVerifierGenerated(CHIP_ERROR status, const Crypto::Spake2pVerifier & verifier) = 0;
+    };
+
+    PASEVerifierGenerator() = default;
+    ~PASEVerifierGenerator() { Cancel(); }
+
+    PASEVerifierGenerator(const PASEVerifierGenerator &)             = delete;
+    PASEVerifierGenerator & operator=(const PASEVerifierGenerator &) = delete;
+
+    /**
+     * @brief
+     *   Start generating a PASE verifier. Any generation in progress is cancelled.
+     *
+     * @param pbkdf2IterCount Iteration count for PBKDF2 function
+     * @param salt            Salt to be used for SPAKE2P operation
+     * @param useRandomPIN    Generate a random setup PIN, if true. Else, use the provided PIN
+     * @param setupPIN        Provided setup PIN (if useRandomPIN is false), or the generated PIN, which is
+     *                        available as soon as this method returns
+     * @param delegate        Receives the verifier, unless the generation is cancelled
+     *
+     * @return CHIP_ERROR     The result of scheduling the generation. The delegate is only called on success.
+     */
+    CHIP_ERROR Generate(uint32_t pbkdf2IterCount, const ByteSpan & salt, bool useRandomPIN, uint32_t & setupPIN,
+                        Delegate * delegate);
+
+    /**
+     * Cancel the generation in progress, if any: its delegate will not be called.
+     */
+    void Cancel();
+
+    bool IsGenerating() const { return mJob != nullptr; }
+
+    /**
+     * Drop, and zero out, all the cached verifiers and the secret their keys are derived from.
+     * The controller stack does this when it shuts down.
+     */
+    static void ClearCache();
+
+private:
+    struct Job;
+
+    static void GenerateHandler(intptr_t arg);
+    static void CompletionHandler(intptr_t arg);
+
+    Job * mJob = nullptr;
+};
+
+} // namespace chip
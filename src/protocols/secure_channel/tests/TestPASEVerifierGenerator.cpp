@@ -0,0 +1,245 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the PASEVerifierGenerator implementation.
+ */
+
+#include <string.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/secure_channel/PASEVerifierGenerator.h>
+#include <setup_payload/SetupPayload.h>
+
+using namespace chip;
+using namespace chip::Crypto;
+using namespace chip::DeviceLayer;
+
+namespace {
+
+// Test Set #01 of Spake2p Parameters, as in TestPASESession.cpp
+constexpr uint32_t sTestSpake2p01_PinCode        = 20202021;
+constexpr uint32_t sTestSpake2p01_IterationCount = 1000;
+constexpr uint8_t sTestSpake2p01_Salt[]          = { 0x53, 0x50, 0x41, 0x4B, 0x45, 0x32, 0x50, 0x20,
+                                                     0x4B, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6C, 0x74 };
+constexpr Spake2pVerifierSerialized sTestSpake2p01_SerializedVerifier = {
+    0xB9, 0x61, 0x70, 0xAA, 0xE8, 0x03, 0x34, 0x68, 0x84, 0x72, 0x4F, 0xE9, 0xA3, 0xB2, 0x87, 0xC3, 0x03, 0x30, 0xC2, 0xA6,
+    0x60, 0x37, 0x5D, 0x17, 0xBB, 0x20, 0x5A, 0x8C, 0xF1, 0xAE, 0xCB, 0x35, 0x04, 0x57, 0xF8, 0xAB, 0x79, 0xEE, 0x25, 0x3A,
+    0xB6, 0xA8, 0xE4, 0x6B, 0xB0, 0x9E, 0x54, 0x3A, 0xE4, 0x22, 0x73, 0x6D, 0xE5, 0x01, 0xE3, 0xDB, 0x37, 0xD4, 0x41, 0xFE,
+    0x34, 0x49, 0x20, 0xD0, 0x95, 0x48, 0xE4, 0xC1, 0x82, 0x40, 0x63, 0x0C, 0x4F, 0xF4, 0x91, 0x3C, 0x53, 0x51, 0x38, 0x39,
+    0xB7, 0xC0, 0x7F, 0xCC, 0x06, 0x27, 0xA1, 0xB8, 0x57, 0x3A, 0x14, 0x9F, 0xCD, 0x1F, 0xA4, 0x66, 0xCF
+};
+
+class TestVerifierDelegate : public PASEVerifierGenerator::Delegate
+{
+public:
+    void OnPASEVerifierGenerated(CHIP_ERROR status, const Spake2pVerifier & verifier) override
+    {
+        mNumCalls++;
+        mStatus   = status;
+        mVerifier = verifier;
+    }
+
+    bool HasVerifier(const Spake2pVerifierSerialized & expected)
+    {
+        Spake2pVerifierSerialized serialized;
+        MutableByteSpan serializedSpan(serialized);
+        return mStatus == CHIP_NO_ERROR && mVerifier.Serialize(serializedSpan) == CHIP_NO_ERROR &&
+            serializedSpan.size() == sizeof(expected) && memcmp(serialized, expected, sizeof(expected)) == 0;
+    }
+
+    uint32_t mNumCalls = 0;
+    CHIP_ERROR mStatus = CHIP_ERROR_INTERNAL;
+    Spake2pVerifier mVerifier;
+};
+
+// Takes a couple of rounds of this, as the work scheduled in the background schedules the completion.
+void ServiceEvents()
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        PlatformMgr().ScheduleWork([](intptr_t) -> void { PlatformMgr().StopEventLoopTask(); }, (intptr_t) nullptr);
+        PlatformMgr().RunEventLoop();
+    }
+}
+
+void TestGenerate(nlTestSuite * inSuite, void * inContext)
+{
+    PASEVerifierGenerator::ClearCache();
+
+    PASEVerifierGenerator generator;
+    TestVerifierDelegate delegate;
+    uint32_t setupPIN = sTestSpake2p01_PinCode;
+
+    NL_TEST_ASSERT(inSuite,
+                   generator.Generate(sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), false, setupPIN, &delegate) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, setupPIN == sTestSpake2p01_PinCode);
+    NL_TEST_ASSERT(inSuite, generator.IsGenerating());
+    NL_TEST_ASSERT(inSuite, delegate.mNumCalls == 0);
+
+    ServiceEvents();
+
+    NL_TEST_ASSERT(inSuite, !generator.IsGenerating());
+    NL_TEST_ASSERT(inSuite, delegate.mNumCalls == 1);
+    NL_TEST_ASSERT(inSuite, delegate.HasVerifier(sTestSpake2p01_SerializedVerifier));
+
+    // The same verifier again comes from the cache, but is still delivered asynchronously
+    TestVerifierDelegate cachedDelegate;
+    NL_TEST_ASSERT(inSuite,
+                   generator.Generate(sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), false, setupPIN,
+                                      &cachedDelegate) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cachedDelegate.mNumCalls == 0);
+
+    ServiceEvents();
+
+    NL_TEST_ASSERT(inSuite, cachedDelegate.mNumCalls == 1);
+    NL_TEST_ASSERT(inSuite, cachedDelegate.HasVerifier(sTestSpake2p01_SerializedVerifier));
+
+    // Clearing the cache renews the secret its keys are derived from, and verifiers are generated again
+    PASEVerifierGenerator::ClearCache();
+    TestVerifierDelegate regeneratedDelegate;
+    NL_TEST_ASSERT(inSuite,
+                   generator.Generate(sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), false, setupPIN,
+                                      &regeneratedDelegate) == CHIP_NO_ERROR);
+
+    ServiceEvents();
+
+    NL_TEST_ASSERT(inSuite, regeneratedDelegate.mNumCalls == 1);
+    NL_TEST_ASSERT(inSuite, regeneratedDelegate.HasVerifier(sTestSpake2p01_SerializedVerifier));
+}
+
+void TestGenerateRandomPIN(nlTestSuite * inSuite, void * inContext)
+{
+    PASEVerifierGenerator generator;
+    TestVerifierDelegate delegate;
+    uint32_t setupPIN = 0;
+
+    NL_TEST_ASSERT(inSuite,
+                   generator.Generate(sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), true, setupPIN, &delegate) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, setupPIN >= 1 && setupPIN <= kSetupPINCodeMaximumValue);
+
+    ServiceEvents();
+    NL_TEST_ASSERT(inSuite, delegate.mNumCalls == 1);
+
+    // The verifier matches the reported PIN
+    Spake2pVerifier expected;
+    Spake2pVerifierSerialized expectedSerialized;
+    MutableByteSpan expectedSpan(expectedSerialized);
+    NL_TEST_ASSERT(inSuite,
+                   expected.Generate(sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), setupPIN) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, expected.Serialize(expectedSpan) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, delegate.HasVerifier(expectedSerialized));
+}
+
+void TestCancel(nlTestSuite * inSuite, void * inContext)
+{
+    PASEVerifierGenerator::ClearCache();
+
+    TestVerifierDelegate delegate;
+    uint32_t setupPIN = sTestSpake2p01_PinCode;
+
+    {
+        PASEVerifierGenerator generator;
+        NL_TEST_ASSERT(inSuite,
+                       generator.Generate(sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), false, setupPIN,
+                                          &delegate) == CHIP_NO_ERROR);
+        generator.Cancel();
+        NL_TEST_ASSERT(inSuite, !generator.IsGenerating());
+
+        // A new generation replaces the one in progress
+        NL_TEST_ASSERT(inSuite,
+                       generator.Generate(sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), false, setupPIN,
+                                          &delegate) == CHIP_NO_ERROR);
+        // Destroying the generator cancels its generation
+    }
+
+    ServiceEvents();
+    NL_TEST_ASSERT(inSuite, delegate.mNumCalls == 0);
+}
+
+void TestInvalidArguments(nlTestSuite * inSuite, void * inContext)
+{
+    PASEVerifierGenerator generator;
+    TestVerifierDelegate delegate;
+    uint32_t setupPIN                                    = sTestSpake2p01_PinCode;
+    uint8_t longSalt[kSpake2p_Max_PBKDF_Salt_Length + 1] = {};
+
+    NL_TEST_ASSERT(inSuite,
+                   generator.Generate(sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), false, setupPIN, nullptr) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   generator.Generate(sTestSpake2p01_IterationCount, ByteSpan(longSalt), false, setupPIN, &delegate) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, !generator.IsGenerating());
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Generate", TestGenerate),
+    NL_TEST_DEF("Generate with random PIN", TestGenerateRandomPIN),
+    NL_TEST_DEF("Cancel", TestCancel),
+    NL_TEST_DEF("Invalid arguments", TestInvalidArguments),
+
+    NL_TEST_SENTINEL()
+};
+
+/**
+ *  Set up the test suite.
+ */
+int TestPASEVerifierGenerator_Setup(void * inContext)
+{
+    VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+    VerifyOrReturnError(PlatformMgr().InitChipStack() == CHIP_NO_ERROR, FAILURE);
+    return SUCCESS;
+}
+
+/**
+ *  Tear down the test suite.
+ */
+int TestPASEVerifierGenerator_Teardown(void * inContext)
+{
+    PASEVerifierGenerator::ClearCache();
+    PlatformMgr().Shutdown();
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+/**
+ *  Main
+ */
+int TestPASEVerifierGenerator()
+{
+    nlTestSuite theSuite = { "PASEVerifierGenerator tests", &sTests[0], TestPASEVerifierGenerator_Setup,
+                             TestPASEVerifierGenerator_Teardown };
+
+    // Run test suite against one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPASEVerifierGenerator)
@@ -358,6 +358,56 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE
+ *
+ *  @brief
+ *      When packet buffers are allocated from the heap (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is zero), this selects
+ *      whether freed buffers are kept in per-thread, size-classed free lists for reuse (1) instead of being returned to
+ *      the heap right away (0).
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE, the number of free buffers of each size class a thread keeps
+ *      for itself before handing them over to the other threads.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE 32
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE, the number of free buffers of each size class shared between
+ *      threads, beyond which freed buffers are returned to the heap.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE 256
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LARGE_CAPACITY_MAX
+ *
+ *  @brief
+ *      The maximum size an application can use with a large \c PacketBuffer, i.e. one meant for a message sent over a
+ *      stream transport such as TCP, which is not bound by the network MTU. Zero, or any value not greater than
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX, disables large buffers.
+ *
+ *  @note
+ *      Large buffers are only available when packet buffers are allocated from the heap (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE
+ *      is zero) on socket platforms. The size of the PacketBuffer structure plus this value must fit in 16 bits.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_LARGE_CAPACITY_MAX
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_LARGE_CAPACITY_MAX 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_LARGE_CAPACITY_MAX */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -58,6 +58,10 @@
 #include <lib/support/CHIPMem.h>
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+#include <system/SystemPacketBufferCache.h>
+#endif
+
 namespace chip {
 namespace System {
 
@@ -125,6 +129,33 @@ void PacketBuffer::InternalCheck(const PacketBuffer * buffer)
 // Number of unused bytes below which \c RightSize() won't bother reallocating.
 constexpr uint16_t kRightSizingThreshold = 16;
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+static void * AllocateBlock(size_t blockSize)
+{
+    // Large buffers are not worth caching: they come straight from the heap.
+    if (blockSize > PacketBufferSizeClassCache::kMaxBlockSize)
+    {
+        return chip::Platform::MemoryAlloc(blockSize);
+    }
+    return PacketBufferSizeClassCache::Allocate(blockSize);
+}
+
+static void ReleaseBlock(void * block, size_t blockSize)
+{
+    if (blockSize > PacketBufferSizeClassCache::kMaxBlockSize)
+    {
+        chip::Platform::MemoryFree(block);
+        return;
+    }
+    PacketBufferSizeClassCache::Release(block, blockSize);
+}
+#else
+static void * AllocateBlock(size_t blockSize)
+{
+    return chip::Platform::MemoryAlloc(blockSize);
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+
 void PacketBufferHandle::InternalRightSize()
 {
     // Require a single buffer with no other references.
@@ -142,8 +173,18 @@ void PacketBufferHandle::InternalRightSize()
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
-    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+    const size_t blockSize = usedSize + PacketBuffer::kStructureSize;
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+    // A smaller buffer in the same size class would occupy the same block.
+    if (blockSize <= PacketBufferSizeClassCache::kMaxBlockSize &&
+        PacketBufferSizeClassCache::SizeClassFor(blockSize) ==
+            PacketBufferSizeClassCache::SizeClassFor(mBuffer->alloc_size + PacketBuffer::kStructureSize))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+
+    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(AllocateBlock(blockSize));
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -479,6 +520,10 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     static_assert(PacketBuffer::kStructureSize < UINT16_MAX, "Check for overflow more carefully");
     static_assert(SIZE_MAX >= INT_MAX, "Our additions might not fit in size_t");
     static_assert(PacketBuffer::kMaxSizeWithoutReserve <= UINT16_MAX, "PacketBuffer may have size not fitting uint16_t");
+    static_assert(PacketBuffer::kLargeBufMaxSizeWithoutReserve >= PacketBuffer::kMaxSizeWithoutReserve,
+                  "Large packet buffers cannot be smaller than regular ones");
+    static_assert(PacketBuffer::kStructureSize + static_cast<size_t>(PacketBuffer::kLargeBufMaxSizeWithoutReserve) <= UINT16_MAX,
+                  "Large PacketBuffer blocks must have a size fitting uint16_t");
 
     // When `aAvailableSize` fits in uint16_t (as tested below) and size_t is at least 32 bits (as asserted above),
     // these additions will not overflow.
@@ -488,7 +533,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
     CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_PacketBufferNew, return PacketBufferHandle());
 
-    if (aAvailableSize > UINT16_MAX || lAllocSize > PacketBuffer::kMaxSizeWithoutReserve || lBlockSize > UINT16_MAX)
+    if (aAvailableSize > UINT16_MAX || lAllocSize > PacketBuffer::kLargeBufMaxSizeWithoutReserve || lBlockSize > UINT16_MAX)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: allocation too large.");
         return PacketBufferHandle();
@@ -523,7 +568,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
 
-    lPacket = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+    lPacket = reinterpret_cast<PacketBuffer *>(AllocateBlock(lBlockSize));
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 
 #else
@@ -601,12 +646,15 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
         {
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+            const size_t blockSize = aPacket->alloc_size + kStructureSize;
+            ::chip::Platform::MemoryDebugCheckPointer(aPacket, blockSize);
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+            ReleaseBlock(aPacket, blockSize);
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             chip::Platform::MemoryFree(aPacket);
 #endif
@@ -680,18 +728,18 @@ PacketBufferHandle PacketBufferHandle::CloneData() const
         uint16_t originalDataSize     = original->MaxDataLength();
         uint16_t originalReservedSize = original->ReservedSize();
 
-        if (originalDataSize + originalReservedSize > PacketBuffer::kMaxSizeWithoutReserve)
+        if (originalDataSize + originalReservedSize > PacketBuffer::kLargeBufMaxSizeWithoutReserve)
         {
             // The original memory allocation may have provided a larger block than requested (e.g. when using a shared pool),
             // and in particular may have provided a larger block than we are able to request from PackBufferHandle::New().
             // It is a genuine error if that extra space has been used.
-            if (originalReservedSize + original->DataLength() > PacketBuffer::kMaxSizeWithoutReserve)
+            if (originalReservedSize + original->DataLength() > PacketBuffer::kLargeBufMaxSizeWithoutReserve)
             {
                 return PacketBufferHandle();
             }
             // Otherwise, reduce the requested data size. This subtraction can not underflow because the above test
-            // guarantees originalReservedSize <= PacketBuffer::kMaxSizeWithoutReserve.
-            originalDataSize = static_cast<uint16_t>(PacketBuffer::kMaxSizeWithoutReserve - originalReservedSize);
+            // guarantees originalReservedSize <= PacketBuffer::kLargeBufMaxSizeWithoutReserve.
+            originalDataSize = static_cast<uint16_t>(PacketBuffer::kLargeBufMaxSizeWithoutReserve - originalReservedSize);
         }
 
         PacketBufferHandle clone = PacketBufferHandle::New(originalDataSize, originalReservedSize);
@@ -140,6 +140,23 @@ public:
      */
     static constexpr uint16_t kMaxSize = kMaxSizeWithoutReserve - kDefaultHeaderReserve;
 
+    /**
+     * The maximum size large buffer, meant for messages sent over a stream transport, an application can allocate with no
+     * protocol header reserve. This is kMaxSizeWithoutReserve unless CHIP_SYSTEM_CONFIG_PACKETBUFFER_LARGE_CAPACITY_MAX
+     * enables large buffers.
+     */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP &&                                                                                     \
+    (CHIP_SYSTEM_CONFIG_PACKETBUFFER_LARGE_CAPACITY_MAX > CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX)
+    static constexpr uint16_t kLargeBufMaxSizeWithoutReserve = CHIP_SYSTEM_CONFIG_PACKETBUFFER_LARGE_CAPACITY_MAX;
+#else
+    static constexpr uint16_t kLargeBufMaxSizeWithoutReserve = kMaxSizeWithoutReserve;
+#endif
+
+    /**
+     * The maximum size large buffer an application can allocate with the default protocol header reserve.
+     */
+    static constexpr uint16_t kLargeBufMaxSize = kLargeBufMaxSizeWithoutReserve - kDefaultHeaderReserve;
+
     /**
      * Return the size of the allocation including the reserved and payload data spaces but not including space
      * allocated for the PacketBuffer structure.
@@ -609,7 +626,8 @@ public:
      *
      *  Fails and returns \c nullptr if no memory is available, or if the size requested is too large.
      *  When the sum of \a aAvailableSize and \a aReservedSize is no greater than \c PacketBuffer::kMaxSizeWithoutReserve,
-     *  that is guaranteed not to be too large.
+     *  that is guaranteed not to be too large. Sums up to \c PacketBuffer::kLargeBufMaxSizeWithoutReserve are allowed when
+     *  large buffers are enabled.
      *
      *  On success, it is guaranteed that \c AvailableDataSize() is no less than \a aAvailableSize.
      *
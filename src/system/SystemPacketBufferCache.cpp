@@ -0,0 +1,254 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <system/SystemPacketBufferCache.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <atomic>
+
+namespace chip {
+namespace System {
+
+namespace {
+
+constexpr size_t kBlockSizes[PacketBufferSizeClassCache::kNumSizeClasses] = {
+    256,
+    512,
+    1024,
+    PacketBufferSizeClassCache::kMaxBlockSize,
+};
+
+static_assert(kBlockSizes[PacketBufferSizeClassCache::kNumSizeClasses - 2] < PacketBufferSizeClassCache::kMaxBlockSize,
+              "Size classes must be in increasing order");
+
+// Free blocks are linked through their first bytes.
+struct FreeBlock
+{
+    FreeBlock * next;
+};
+
+struct SizeClass
+{
+    std::atomic<FreeBlock *> sharedList{ nullptr };
+    // Only approximate: a thread taking the shared list may subtract its blocks before the thread that pushed them added
+    // them, so the count can briefly go negative.
+    std::atomic<int32_t> sharedCount{ 0 };
+    std::atomic<uint32_t> inUse{ 0 };
+    std::atomic<uint32_t> highWatermark{ 0 };
+    std::atomic<uint32_t> failedAllocs{ 0 };
+};
+
+SizeClass sSizeClasses[PacketBufferSizeClassCache::kNumSizeClasses];
+
+uint32_t SharedCount(const SizeClass & sizeClass)
+{
+    int32_t count = sizeClass.sharedCount.load(std::memory_order_relaxed);
+    return count > 0 ? static_cast<uint32_t>(count) : 0;
+}
+
+// Pushes a chain of blocks to the shared list of a size class.
+void PushShared(SizeClass & sizeClass, FreeBlock * head, FreeBlock * tail, uint32_t count)
+{
+    FreeBlock * expected = sizeClass.sharedList.load(std::memory_order_relaxed);
+    do
+    {
+        tail->next = expected;
+    } while (!sizeClass.sharedList.compare_exchange_weak(expected, head, std::memory_order_release, std::memory_order_relaxed));
+    sizeClass.sharedCount.fetch_add(static_cast<int32_t>(count), std::memory_order_relaxed);
+}
+
+// Set once the cache of the current thread has been destroyed. Unlike the cache itself, this has no destructor, so it can
+// still be read while the remaining thread_local and static objects of the thread are destroyed.
+thread_local bool tThreadCacheDestroyed = false;
+
+class ThreadCache
+{
+public:
+    ~ThreadCache()
+    {
+        // The heap may already be shut down when threads exit, so everything goes to the shared lists.
+        for (size_t i = 0; i < PacketBufferSizeClassCache::kNumSizeClasses; i++)
+        {
+            Flush(i, /* mayFree = */ false);
+        }
+        tThreadCacheDestroyed = true;
+    }
+
+    void * Pop(size_t sizeClass)
+    {
+        if (mHeads[sizeClass] == nullptr)
+        {
+            Refill(sizeClass);
+        }
+
+        FreeBlock * block = mHeads[sizeClass];
+        if (block != nullptr)
+        {
+            mHeads[sizeClass] = block->next;
+            mCounts[sizeClass]--;
+        }
+        return block;
+    }
+
+    void Push(size_t sizeClass, void * block)
+    {
+        FreeBlock * freeBlock = static_cast<FreeBlock *>(block);
+        freeBlock->next       = mHeads[sizeClass];
+        mHeads[sizeClass]     = freeBlock;
+        if (++mCounts[sizeClass] > CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE)
+        {
+            Flush(sizeClass, /* mayFree = */ true);
+        }
+    }
+
+private:
+    void Refill(size_t sizeClass)
+    {
+        SizeClass & shared = sSizeClasses[sizeClass];
+        VerifyOrReturn(shared.sharedList.load(std::memory_order_relaxed) != nullptr);
+
+        FreeBlock * head = shared.sharedList.exchange(nullptr, std::memory_order_acquire);
+        uint32_t count   = 0;
+        for (FreeBlock * block = head; block != nullptr; block = block->next)
+        {
+            count++;
+        }
+        shared.sharedCount.fetch_sub(static_cast<int32_t>(count), std::memory_order_relaxed);
+
+        mHeads[sizeClass]  = head;
+        mCounts[sizeClass] = count;
+    }
+
+    void Flush(size_t sizeClass, bool mayFree)
+    {
+        FreeBlock * head = mHeads[sizeClass];
+        VerifyOrReturn(head != nullptr);
+
+        SizeClass & shared = sSizeClasses[sizeClass];
+        uint32_t count     = mCounts[sizeClass];
+        mHeads[sizeClass]  = nullptr;
+        mCounts[sizeClass] = 0;
+
+        if (mayFree && SharedCount(shared) + count > CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE)
+        {
+            while (head != nullptr)
+            {
+                FreeBlock * next = head->next;
+                chip::Platform::MemoryFree(head);
+                head = next;
+            }
+            return;
+        }
+
+        FreeBlock * tail = head;
+        while (tail->next != nullptr)
+        {
+            tail = tail->next;
+        }
+        PushShared(shared, head, tail, count);
+    }
+
+    FreeBlock * mHeads[PacketBufferSizeClassCache::kNumSizeClasses] = {};
+    uint32_t mCounts[PacketBufferSizeClassCache::kNumSizeClasses]   = {};
+};
+
+thread_local ThreadCache tThreadCache;
+
+} // namespace
+
+size_t PacketBufferSizeClassCache::SizeClassFor(size_t blockSize)
+{
+    size_t sizeClass = 0;
+    while (sizeClass < kNumSizeClasses && blockSize > kBlockSizes[sizeClass])
+    {
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+size_t PacketBufferSizeClassCache::BlockSizeOf(size_t sizeClass)
+{
+    return kBlockSizes[sizeClass];
+}
+
+void * PacketBufferSizeClassCache::Allocate(size_t blockSize)
+{
+    VerifyOrDie(blockSize <= kMaxBlockSize);
+
+    const size_t sizeClass = SizeClassFor(blockSize);
+    SizeClass & stats      = sSizeClasses[sizeClass];
+
+    // Past the destruction of the thread cache, blocks come straight from the heap.
+    void * block = tThreadCacheDestroyed ? nullptr : tThreadCache.Pop(sizeClass);
+    if (block == nullptr)
+    {
+        block = chip::Platform::MemoryAlloc(kBlockSizes[sizeClass]);
+        if (block == nullptr)
+        {
+            stats.failedAllocs.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+
+    uint32_t inUse         = stats.inUse.fetch_add(1, std::memory_order_relaxed) + 1;
+    uint32_t highWatermark = stats.highWatermark.load(std::memory_order_relaxed);
+    while (inUse > highWatermark &&
+           !stats.highWatermark.compare_exchange_weak(highWatermark, inUse, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+
+    return block;
+}
+
+void PacketBufferSizeClassCache::Release(void * block, size_t blockSize)
+{
+    VerifyOrReturn(block != nullptr);
+    VerifyOrDie(blockSize <= kMaxBlockSize);
+
+    const size_t sizeClass = SizeClassFor(blockSize);
+    sSizeClasses[sizeClass].inUse.fetch_sub(1, std::memory_order_relaxed);
+    if (tThreadCacheDestroyed)
+    {
+        // Blocks freed while objects destroyed after the thread cache go to the shared list.
+        FreeBlock * freeBlock = static_cast<FreeBlock *>(block);
+        PushShared(sSizeClasses[sizeClass], freeBlock, freeBlock, 1);
+        return;
+    }
+    tThreadCache.Push(sizeClass, block);
+}
+
+size_t PacketBufferSizeClassCache::GetStats(Stats::PacketBufferSizeClassStats * stats, size_t maxCount)
+{
+    for (size_t i = 0; i < maxCount && i < kNumSizeClasses; i++)
+    {
+        stats[i].blockSize     = kBlockSizes[i];
+        stats[i].inUse         = sSizeClasses[i].inUse.load(std::memory_order_relaxed);
+        stats[i].highWatermark = sSizeClasses[i].highWatermark.load(std::memory_order_relaxed);
+        stats[i].failedAllocs  = sSizeClasses[i].failedAllocs.load(std::memory_order_relaxed);
+        stats[i].cached        = SharedCount(sSizeClasses[i]);
+    }
+    return kNumSizeClasses;
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
@@ -0,0 +1,87 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Size-classed cache of heap blocks backing packet buffers.
+ *      This is not part of the public PacketBuffer interface.
+ */
+
+#pragma once
+
+#include <system/SystemPacketBuffer.h>
+#include <system/SystemStats.h>
+
+#include <stddef.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+
+namespace chip {
+namespace System {
+
+/**
+ * Recycles the heap blocks of freed packet buffers.
+ *
+ * Blocks are grouped in a few size classes, and a freed block is kept for reuse by the next allocation of the same class
+ * instead of being returned to the heap. Each thread keeps a small free list per class that it uses without any
+ * synchronization. When a thread runs out of blocks of a class, it takes the whole shared free list of that class with a
+ * single atomic exchange; when its own list grows past CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE, it pushes it to the
+ * shared list. Taking whole lists, rather than popping single blocks, keeps the shared lists lock-free without being exposed
+ * to the ABA problem.
+ *
+ * Blocks are only returned to the heap when the shared list of their class already holds
+ * CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE blocks.
+ */
+class PacketBufferSizeClassCache
+{
+public:
+    static constexpr size_t kNumSizeClasses = 4;
+
+    // Size of a block able to hold the largest packet buffer, including the PacketBuffer structure.
+    static constexpr size_t kMaxBlockSize =
+        CHIP_SYSTEM_ALIGN_SIZE(sizeof(pbuf), 4u) + static_cast<size_t>(PacketBuffer::kMaxSizeWithoutReserve);
+
+    /**
+     * Returns a block of at least blockSize bytes, or nullptr if the heap is exhausted.
+     * blockSize must not exceed kMaxBlockSize.
+     */
+    static void * Allocate(size_t blockSize);
+
+    /**
+     * Releases a block returned by Allocate(). blockSize must be the size that was passed to Allocate(), or any size that
+     * falls in the same size class.
+     */
+    static void Release(void * block, size_t blockSize);
+
+    // Index of the size class serving blocks of the given size, or kNumSizeClasses for blocks too large for the cache.
+    static size_t SizeClassFor(size_t blockSize);
+
+    // Actual size of the blocks of a size class.
+    static size_t BlockSizeOf(size_t sizeClass);
+
+    /**
+     * Fill in the statistics of up to maxCount size classes, in increasing block size.
+     *
+     * @return The number of size classes.
+     */
+    static size_t GetStats(Stats::PacketBufferSizeClassStats * stats, size_t maxCount);
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
@@ -42,6 +42,17 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+ *
+ * True if the heap blocks of packet buffers are recycled through the size-classed PacketBufferSizeClassCache.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE
+#define CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE 0
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
  *
@@ -28,6 +28,9 @@
 // Include module header
 #include <system/SystemStats.h>
 
+#include <system/SystemPacketBufferCache.h>
+#include <system/SystemPacketBufferInternal.h>
+
 #include <lib/support/SafeInt.h>
 #include <platform/LockTracker.h>
 
@@ -128,6 +131,17 @@ void UpdateLwipPbufCounts(void)
 }
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE
+size_t GetPacketBufferSizeClassStats(PacketBufferSizeClassStats * stats, size_t maxCount)
+{
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+    return PacketBufferSizeClassCache::GetStats(stats, maxCount);
+#else
+    return 0;
+#endif
+}
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE
+
 } // namespace Stats
 } // namespace System
 } // namespace chip
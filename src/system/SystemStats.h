@@ -39,6 +39,7 @@
 #include <lwip/stats.h>
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace chip {
@@ -92,6 +93,24 @@ void UpdateLwipPbufCounts(void);
 typedef const char * Label;
 const Label * GetStrings();
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE
+struct PacketBufferSizeClassStats
+{
+    size_t blockSize;       // Size of the heap blocks of the class, including the PacketBuffer structure.
+    uint32_t inUse;         // Blocks currently held by packet buffers.
+    uint32_t highWatermark; // Largest value inUse has reached.
+    uint32_t failedAllocs;  // Allocations that failed because the heap was exhausted.
+    uint32_t cached;        // Free blocks available to all threads.
+};
+
+/**
+ * Fill in the statistics of up to maxCount packet buffer size classes, in increasing block size.
+ *
+ * @return The number of size classes, or zero if packet buffers are not allocated through the size class cache.
+ */
+size_t GetPacketBufferSizeClassStats(PacketBufferSizeClassStats * stats, size_t maxCount);
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE
+
 } // namespace Stats
 } // namespace System
 } // namespace chip
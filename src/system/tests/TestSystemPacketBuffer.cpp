@@ -128,6 +128,7 @@ public:
     static void CheckHandleAdvance(nlTestSuite * inSuite, void * inContext);
     static void CheckHandleRightSize(nlTestSuite * inSuite, void * inContext);
     static void CheckHandleCloneData(nlTestSuite * inSuite, void * inContext);
+    static void CheckLargeBuffer(nlTestSuite * inSuite, void * inContext);
     static void CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext);
     static void CheckBuildFreeList(nlTestSuite * inSuite, void * inContext);
 
@@ -377,7 +378,7 @@ void PacketBufferTest::CheckNew(nlTestSuite * inSuite, void * inContext)
     {
         const PacketBufferHandle buffer = PacketBufferHandle::New(0, config.reserved_size);
 
-        if (config.reserved_size > PacketBuffer::kMaxSizeWithoutReserve)
+        if (config.reserved_size > PacketBuffer::kLargeBufMaxSizeWithoutReserve)
         {
             NL_TEST_ASSERT(inSuite, buffer.IsNull());
             continue;
@@ -1474,6 +1475,39 @@ void PacketBufferTest::CheckFree(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+/**
+ *  Test allocating, cloning and right-sizing the largest buffer (a regular buffer when large buffers are disabled).
+ */
+void PacketBufferTest::CheckLargeBuffer(nlTestSuite * inSuite, void * inContext)
+{
+    NL_TEST_ASSERT(inSuite, PacketBuffer::kLargeBufMaxSizeWithoutReserve >= PacketBuffer::kMaxSizeWithoutReserve);
+    NL_TEST_ASSERT(inSuite, PacketBufferHandle::New(PacketBuffer::kLargeBufMaxSize + 1).IsNull());
+    NL_TEST_ASSERT(inSuite, PacketBufferHandle::New(PacketBuffer::kLargeBufMaxSizeWithoutReserve + 1, 0).IsNull());
+
+    PacketBufferHandle buffer = PacketBufferHandle::New(PacketBuffer::kLargeBufMaxSize);
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+    VerifyOrReturn(!buffer.IsNull());
+    NL_TEST_ASSERT(inSuite, buffer->AvailableDataLength() >= PacketBuffer::kLargeBufMaxSize);
+
+    for (uint16_t i = 0; i < PacketBuffer::kLargeBufMaxSize; i++)
+    {
+        buffer->Start()[i] = static_cast<uint8_t>(i);
+    }
+    buffer->SetDataLength(PacketBuffer::kLargeBufMaxSize);
+
+    PacketBufferHandle clone = buffer.CloneData();
+    NL_TEST_ASSERT(inSuite, !clone.IsNull());
+    VerifyOrReturn(!clone.IsNull());
+    NL_TEST_ASSERT(inSuite, clone->DataLength() == PacketBuffer::kLargeBufMaxSize);
+    NL_TEST_ASSERT(inSuite, memcmp(clone->Start(), buffer->Start(), PacketBuffer::kLargeBufMaxSize) == 0);
+
+    // Shrinking a large buffer keeps its data.
+    buffer->SetDataLength(100);
+    buffer.RightSize();
+    NL_TEST_ASSERT(inSuite, buffer->DataLength() == 100);
+    NL_TEST_ASSERT(inSuite, memcmp(clone->Start(), buffer->Start(), 100) == 0);
+}
+
 /**
  *  Test PacketBuffer::FreeHead() function.
  *
@@ -1894,7 +1928,7 @@ void PacketBufferTest::CheckHandleCloneData(nlTestSuite * inSuite, void * inCont
     // This is only testable on heap allocation configurations, where pbuf records the allocation size and we can manually
     // construct an oversize buffer.
 
-    constexpr uint16_t kOversizeDataSize = PacketBuffer::kMaxSizeWithoutReserve + 99;
+    constexpr uint16_t kOversizeDataSize = PacketBuffer::kLargeBufMaxSizeWithoutReserve + 99;
     PacketBuffer * p =
         reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(PacketBuffer::kStructureSize + kOversizeDataSize));
     NL_TEST_ASSERT(inSuite, p != nullptr);
@@ -1910,14 +1944,14 @@ void PacketBufferTest::CheckHandleCloneData(nlTestSuite * inSuite, void * inCont
 
     // Fill the buffer to maximum and verify that it can be cloned.
 
-    memset(handle->Start(), 1, PacketBuffer::kMaxSizeWithoutReserve);
-    handle->SetDataLength(PacketBuffer::kMaxSizeWithoutReserve);
-    NL_TEST_ASSERT(inSuite, handle->DataLength() == PacketBuffer::kMaxSizeWithoutReserve);
+    memset(handle->Start(), 1, PacketBuffer::kLargeBufMaxSizeWithoutReserve);
+    handle->SetDataLength(PacketBuffer::kLargeBufMaxSizeWithoutReserve);
+    NL_TEST_ASSERT(inSuite, handle->DataLength() == PacketBuffer::kLargeBufMaxSizeWithoutReserve);
 
     PacketBufferHandle clone = handle.CloneData();
     NL_TEST_ASSERT(inSuite, !clone.IsNull());
-    NL_TEST_ASSERT(inSuite, clone->DataLength() == PacketBuffer::kMaxSizeWithoutReserve);
-    NL_TEST_ASSERT(inSuite, memcmp(handle->Start(), clone->Start(), PacketBuffer::kMaxSizeWithoutReserve) == 0);
+    NL_TEST_ASSERT(inSuite, clone->DataLength() == PacketBuffer::kLargeBufMaxSizeWithoutReserve);
+    NL_TEST_ASSERT(inSuite, memcmp(handle->Start(), clone->Start(), PacketBuffer::kLargeBufMaxSizeWithoutReserve) == 0);
 
     // Overfill the buffer and verify that it can not be cloned.
     memset(handle->Start(), 2, kOversizeDataSize);
@@ -2001,6 +2035,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("PacketBuffer::HandleAdvance",          PacketBufferTest::CheckHandleAdvance),
     NL_TEST_DEF("PacketBuffer::HandleRightSize",        PacketBufferTest::CheckHandleRightSize),
     NL_TEST_DEF("PacketBuffer::HandleCloneData",        PacketBufferTest::CheckHandleCloneData),
+    NL_TEST_DEF("PacketBuffer::LargeBuffer",            PacketBufferTest::CheckLargeBuffer),
     NL_TEST_DEF("PacketBuffer::PacketBufferWriter",     PacketBufferTest::CheckPacketBufferWriter),
 
     NL_TEST_SENTINEL()
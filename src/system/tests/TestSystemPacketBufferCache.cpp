@@ -0,0 +1,274 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the size-classed cache of heap-allocated packet buffers.
+ */
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/SystemPacketBufferCache.h>
+#include <system/SystemPacketBufferInternal.h>
+#include <system/SystemStats.h>
+
+#include <nlunit-test.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+#include <atomic>
+#include <string.h>
+#include <thread>
+#include <vector>
+#endif
+
+using namespace chip::System;
+
+namespace {
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+
+constexpr size_t kStructureSize = PacketBufferSizeClassCache::kMaxBlockSize - PacketBuffer::kMaxSizeWithoutReserve;
+
+Stats::PacketBufferSizeClassStats GetClassStats(size_t sizeClass)
+{
+    Stats::PacketBufferSizeClassStats stats[PacketBufferSizeClassCache::kNumSizeClasses];
+    Stats::GetPacketBufferSizeClassStats(stats, PacketBufferSizeClassCache::kNumSizeClasses);
+    return stats[sizeClass];
+}
+
+void CheckSizeClasses(nlTestSuite * inSuite, void * inContext)
+{
+    NL_TEST_ASSERT(inSuite, PacketBufferSizeClassCache::SizeClassFor(1) == 0);
+
+    size_t previousBlockSize = 0;
+    for (size_t i = 0; i < PacketBufferSizeClassCache::kNumSizeClasses; i++)
+    {
+        size_t blockSize = PacketBufferSizeClassCache::BlockSizeOf(i);
+        NL_TEST_ASSERT(inSuite, blockSize > previousBlockSize);
+        NL_TEST_ASSERT(inSuite, PacketBufferSizeClassCache::SizeClassFor(blockSize) == i);
+        NL_TEST_ASSERT(inSuite, PacketBufferSizeClassCache::SizeClassFor(previousBlockSize + 1) == i);
+        previousBlockSize = blockSize;
+    }
+
+    NL_TEST_ASSERT(inSuite, previousBlockSize == PacketBufferSizeClassCache::kMaxBlockSize);
+    NL_TEST_ASSERT(inSuite,
+                   PacketBufferSizeClassCache::SizeClassFor(previousBlockSize + 1) == PacketBufferSizeClassCache::kNumSizeClasses);
+
+    Stats::PacketBufferSizeClassStats stats[PacketBufferSizeClassCache::kNumSizeClasses];
+    NL_TEST_ASSERT(inSuite, Stats::GetPacketBufferSizeClassStats(stats, 1) == PacketBufferSizeClassCache::kNumSizeClasses);
+}
+
+void CheckBlockReuse(nlTestSuite * inSuite, void * inContext)
+{
+    PacketBufferHandle handle = PacketBufferHandle::New(64, 0);
+    NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    const void * block = handle->Start();
+    handle             = nullptr;
+
+    // A buffer of a different size in the same size class gets the block that was just freed.
+    handle = PacketBufferHandle::New(96, 0);
+    NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    NL_TEST_ASSERT(inSuite, handle->Start() == block);
+    NL_TEST_ASSERT(inSuite, handle->AvailableDataLength() == 96);
+
+    // A buffer in another size class does not.
+    PacketBufferHandle large = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve, 0);
+    NL_TEST_ASSERT(inSuite, !large.IsNull());
+    NL_TEST_ASSERT(inSuite, large->Start() != block);
+}
+
+void CheckStats(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kCount     = 10;
+    const size_t sizeClass      = PacketBufferSizeClassCache::SizeClassFor(kStructureSize + 300);
+    const uint32_t initialInUse = GetClassStats(sizeClass).inUse;
+
+    PacketBufferHandle handles[kCount];
+    for (auto & handle : handles)
+    {
+        handle = PacketBufferHandle::New(300, 0);
+        NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    }
+
+    Stats::PacketBufferSizeClassStats stats = GetClassStats(sizeClass);
+    NL_TEST_ASSERT(inSuite, stats.blockSize == PacketBufferSizeClassCache::BlockSizeOf(sizeClass));
+    NL_TEST_ASSERT(inSuite, stats.inUse == initialInUse + kCount);
+    NL_TEST_ASSERT(inSuite, stats.highWatermark >= initialInUse + kCount);
+    NL_TEST_ASSERT(inSuite, stats.failedAllocs == 0);
+
+    for (auto & handle : handles)
+    {
+        handle = nullptr;
+    }
+
+    stats = GetClassStats(sizeClass);
+    NL_TEST_ASSERT(inSuite, stats.inUse == initialInUse);
+    NL_TEST_ASSERT(inSuite, stats.highWatermark >= initialInUse + kCount);
+}
+
+void CheckRightSize(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint16_t kDataLength = 100;
+    const size_t sizeClass         = PacketBufferSizeClassCache::SizeClassFor(kStructureSize + kDataLength);
+    const uint32_t initialInUse    = GetClassStats(sizeClass).inUse;
+
+    // A mostly empty buffer of the largest size class moves to the size class of its data.
+    PacketBufferHandle handle = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve, 0);
+    NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    handle->SetDataLength(kDataLength);
+    handle.RightSize();
+    NL_TEST_ASSERT(inSuite, handle->DataLength() == kDataLength);
+    NL_TEST_ASSERT(inSuite, GetClassStats(sizeClass).inUse == initialInUse + 1);
+    handle = nullptr;
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_LARGE_CAPACITY_MAX > CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX
+    // A large buffer, whose block is too large for the cache, moves into the cache even when its data only fits the largest
+    // size class.
+    const uint16_t kLargeDataLength = PacketBuffer::kMaxSizeWithoutReserve;
+    const size_t topSizeClass       = PacketBufferSizeClassCache::kNumSizeClasses - 1;
+    const uint32_t initialTopInUse  = GetClassStats(topSizeClass).inUse;
+
+    handle = PacketBufferHandle::New(PacketBuffer::kLargeBufMaxSizeWithoutReserve, 0);
+    NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    NL_TEST_ASSERT(inSuite, GetClassStats(topSizeClass).inUse == initialTopInUse);
+    handle->SetDataLength(kLargeDataLength);
+    handle.RightSize();
+    NL_TEST_ASSERT(inSuite, handle->DataLength() == kLargeDataLength);
+    NL_TEST_ASSERT(inSuite, GetClassStats(topSizeClass).inUse == initialTopInUse + 1);
+    handle = nullptr;
+    NL_TEST_ASSERT(inSuite, GetClassStats(topSizeClass).inUse == initialTopInUse);
+#endif
+
+    NL_TEST_ASSERT(inSuite, GetClassStats(sizeClass).inUse == initialInUse);
+}
+
+void CheckConcurrentAllocations(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr unsigned kThreads    = 4;
+    constexpr unsigned kIterations = 2000;
+    constexpr size_t kBatch        = 3 * CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE;
+    const uint16_t kSizes[]        = { 16, 400, 900, PacketBuffer::kMaxSizeWithoutReserve };
+
+    uint32_t initialInUse[PacketBufferSizeClassCache::kNumSizeClasses];
+    for (size_t i = 0; i < PacketBufferSizeClassCache::kNumSizeClasses; i++)
+    {
+        initialInUse[i] = GetClassStats(i).inUse;
+    }
+
+    // Each thread frees half of its buffers itself and hands the other half over to the next thread, so that blocks keep
+    // moving between the thread caches through the shared lists.
+    std::vector<PacketBufferHandle> handOver[kThreads];
+    std::atomic<unsigned> failures{ 0 };
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < kThreads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            std::vector<PacketBufferHandle> batch(kBatch);
+            for (unsigned i = 0; i < kIterations / kBatch; i++)
+            {
+                for (size_t j = 0; j < kBatch; j++)
+                {
+                    batch[j] = PacketBufferHandle::New(kSizes[(t + j) % ArraySize(kSizes)], 0);
+                    if (batch[j].IsNull())
+                    {
+                        failures++;
+                        continue;
+                    }
+                    // Scribble over the whole buffer, so that a block handed out twice would show up under sanitizers.
+                    memset(batch[j]->Start(), static_cast<int>(t), batch[j]->AvailableDataLength());
+                }
+                for (size_t j = 0; j < kBatch; j += 2)
+                {
+                    batch[j] = nullptr;
+                }
+            }
+            for (size_t j = 1; j < kBatch; j += 2)
+            {
+                handOver[(t + 1) % kThreads].push_back(std::move(batch[j]));
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    // Free the handed over buffers from other threads than the ones that allocated them.
+    threads.clear();
+    for (unsigned t = 0; t < kThreads; t++)
+    {
+        threads.emplace_back([&handOver, t]() { handOver[t].clear(); });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    NL_TEST_ASSERT(inSuite, failures == 0);
+    for (size_t i = 0; i < PacketBufferSizeClassCache::kNumSizeClasses; i++)
+    {
+        NL_TEST_ASSERT(inSuite, GetClassStats(i).inUse == initialInUse[i]);
+    }
+}
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+
+int TestSetup(void * inContext)
+{
+    return (chip::Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+    NL_TEST_DEF("PacketBufferSizeClassCache::SizeClasses",           CheckSizeClasses),
+    NL_TEST_DEF("PacketBufferSizeClassCache::BlockReuse",            CheckBlockReuse),
+    NL_TEST_DEF("PacketBufferSizeClassCache::Stats",                 CheckStats),
+    NL_TEST_DEF("PacketBufferSizeClassCache::RightSize",             CheckRightSize),
+    NL_TEST_DEF("PacketBufferSizeClassCache::ConcurrentAllocations", CheckConcurrentAllocations),
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASS_CACHE
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSystemPacketBufferCache()
+{
+    nlTestSuite theSuite = {
+        "chip-system-packetbuffer-cache", &sTests[0], TestSetup, TestTeardown
+    };
+
+    // Run test suite against one context.
+    nlTestRunner(&theSuite, nullptr /* context */);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemPacketBufferCache)
@@ -0,0 +1,486 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/metrics/metrics_tracing.h>
+
+#include <tracing/metric_event.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+namespace Tracing {
+namespace Metrics {
+
+namespace {
+
+static_assert((MetricsBackend::kEventCapacity & (MetricsBackend::kEventCapacity - 1)) == 0,
+              "Event capacity must be a power of 2");
+
+constexpr uint8_t kSeriesFree    = 0;
+constexpr uint8_t kSeriesClaimed = 1;
+constexpr uint8_t kSeriesReady   = 2;
+
+constexpr const char * kCounterGroup = "Counter";
+constexpr const char * kMetricGroup  = "Metric";
+
+// Scopes opened on the current thread, by all the backends.
+constexpr size_t kMaxScopeDepth = 64;
+
+struct OpenScope
+{
+    const void * backend;
+    uint64_t startUs;
+};
+
+thread_local OpenScope tOpenScopes[kMaxScopeDepth];
+thread_local size_t tOpenScopeCount = 0;
+thread_local size_t tSkippedScopes  = 0;
+
+std::atomic<uint32_t> sNextThreadId{ 1 };
+
+uint64_t NowUs()
+{
+    using namespace std::chrono;
+    return static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+uint32_t CurrentThreadId()
+{
+    thread_local uint32_t tThreadId = sNextThreadId.fetch_add(1, std::memory_order_relaxed);
+    return tThreadId;
+}
+
+uint32_t Hash(const char * label, const char * group)
+{
+    // FNV-1a: labels are compared by content, as the same literal may have several addresses.
+    uint32_t hash = 2166136261u;
+    for (const char * s : { label, group })
+    {
+        for (; *s != '\0'; s++)
+        {
+            hash = (hash ^ static_cast<uint8_t>(*s)) * 16777619u;
+        }
+        hash = (hash ^ 0xFF) * 16777619u;
+    }
+    return hash;
+}
+
+size_t BucketFor(uint64_t durationUs)
+{
+    size_t bucket = 0;
+    while (bucket < MetricsBackend::kBucketCount - 1 && durationUs >= (uint64_t(1) << bucket))
+    {
+        bucket++;
+    }
+    return bucket;
+}
+
+// Writes a string as the content of a JSON or Prometheus label string.
+void WriteEscaped(std::ostream & out, const char * value)
+{
+    for (; *value != '\0'; value++)
+    {
+        char c = *value;
+        if (c == '"' || c == '\\')
+        {
+            out << '\\' << c;
+        }
+        else if (c == '\n')
+        {
+            out << "\\n";
+        }
+        else if (static_cast<unsigned char>(c) >= 0x20)
+        {
+            out << c;
+        }
+    }
+}
+
+void WriteLabels(std::ostream & out, const char * label, const char * group)
+{
+    out << "group=\"";
+    WriteEscaped(out, group);
+    out << "\",label=\"";
+    WriteEscaped(out, label);
+    out << '"';
+}
+
+void WriteSeconds(std::ostream & out, uint64_t us)
+{
+    out << us / 1000000 << '.';
+    char fraction[7];
+    snprintf(fraction, sizeof(fraction), "%06u", static_cast<unsigned>(us % 1000000));
+    out << fraction;
+}
+
+} // namespace
+
+void MetricsBackend::TraceBegin(const char * label, const char * group)
+{
+    if (tOpenScopeCount == kMaxScopeDepth)
+    {
+        tSkippedScopes++;
+        return;
+    }
+    tOpenScopes[tOpenScopeCount++] = { this, NowUs() };
+}
+
+void MetricsBackend::TraceEnd(const char * label, const char * group)
+{
+    const uint64_t now = NowUs();
+    if (tSkippedScopes > 0)
+    {
+        tSkippedScopes--;
+        return;
+    }
+
+    // Scopes of several backends are interleaved, this backend's innermost one is ending.
+    for (size_t i = tOpenScopeCount; i > 0; i--)
+    {
+        if (tOpenScopes[i - 1].backend != this)
+        {
+            continue;
+        }
+        const uint64_t start = tOpenScopes[i - 1].startUs;
+        memmove(&tOpenScopes[i - 1], &tOpenScopes[i], (tOpenScopeCount - i) * sizeof(OpenScope));
+        tOpenScopeCount--;
+
+        RecordDuration(FindOrAddSeries(label, group, Kind::kDuration), now - start);
+        RecordEvent('X', label, group, start, now - start);
+        return;
+    }
+}
+
+void MetricsBackend::TraceInstant(const char * label, const char * group)
+{
+    Series * series = FindOrAddSeries(label, group, Kind::kCount);
+    if (series != nullptr)
+    {
+        series->mCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    RecordEvent('i', label, group, NowUs(), 0);
+}
+
+void MetricsBackend::TraceCounter(const char * label)
+{
+    Series * series = FindOrAddSeries(label, kCounterGroup, Kind::kCount);
+    uint64_t value  = 0;
+    if (series != nullptr)
+    {
+        value = series->mCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+    RecordEvent('C', label, kCounterGroup, NowUs(), 0, static_cast<int64_t>(value));
+}
+
+void MetricsBackend::LogMetricEvent(const MetricEvent & event)
+{
+    const uint64_t now = NowUs();
+    const bool failed  = event.ValueType() == MetricEvent::Value::Type::kChipErrorCode && event.ValueErrorCode() != 0;
+    int64_t value      = 0;
+    switch (event.ValueType())
+    {
+    case MetricEvent::Value::Type::kInt32:
+        value = event.ValueInt32();
+        break;
+    case MetricEvent::Value::Type::kUInt32:
+        value = event.ValueUInt32();
+        break;
+    case MetricEvent::Value::Type::kChipErrorCode:
+        value = event.ValueErrorCode();
+        break;
+    case MetricEvent::Value::Type::kUndefined:
+        break;
+    }
+
+    switch (event.type())
+    {
+    case MetricEvent::Type::kBeginEvent: {
+        Series * series = FindOrAddSeries(event.key(), kMetricGroup, Kind::kDuration);
+        VerifyOrReturn(series != nullptr);
+        // 0 marks a free slot.
+        const uint64_t start = now > 0 ? now : 1;
+        for (auto & slot : series->mBeginUs)
+        {
+            uint64_t expected = 0;
+            if (slot.compare_exchange_strong(expected, start, std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+        series->mUnpaired.fetch_add(1, std::memory_order_relaxed);
+        break;
+    }
+    case MetricEvent::Type::kEndEvent: {
+        Series * series = FindOrAddSeries(event.key(), kMetricGroup, Kind::kDuration);
+        VerifyOrReturn(series != nullptr);
+        if (failed)
+        {
+            series->mErrors.fetch_add(1, std::memory_order_relaxed);
+        }
+        const uint64_t start = TakeOldestBegin(*series);
+        if (start == 0 || start > now)
+        {
+            series->mUnpaired.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        RecordDuration(series, now - start);
+        RecordEvent('X', event.key(), kMetricGroup, start, now - start, value);
+        break;
+    }
+    case MetricEvent::Type::kInstantEvent: {
+        Series * series = FindOrAddSeries(event.key(), kMetricGroup, Kind::kCount);
+        if (series != nullptr)
+        {
+            series->mCount.fetch_add(1, std::memory_order_relaxed);
+            if (failed)
+            {
+                series->mErrors.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        RecordEvent('i', event.key(), kMetricGroup, now, 0, value);
+        break;
+    }
+    }
+}
+
+MetricsBackend::Series * MetricsBackend::FindOrAddSeries(const char * label, const char * group, Kind kind)
+{
+    const size_t start = Hash(label, group) % kSeriesCapacity;
+    for (size_t i = 0; i < kSeriesCapacity; i++)
+    {
+        Series & series = mSeries[(start + i) % kSeriesCapacity];
+        uint8_t state   = series.mState.load(std::memory_order_acquire);
+        if (state == kSeriesFree)
+        {
+            if (series.mState.compare_exchange_strong(state, kSeriesClaimed, std::memory_order_acquire))
+            {
+                series.mLabel = label;
+                series.mGroup = group;
+                series.mKind  = kind;
+                series.mState.store(kSeriesReady, std::memory_order_release);
+                return &series;
+            }
+        }
+        while (state == kSeriesClaimed)
+        {
+            // Another thread is filling in this series, which only takes a few stores.
+            state = series.mState.load(std::memory_order_acquire);
+        }
+        if (series.mKind == kind && strcmp(series.mLabel, label) == 0 && strcmp(series.mGroup, group) == 0)
+        {
+            return &series;
+        }
+    }
+
+    mDropped.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+uint64_t MetricsBackend::TakeOldestBegin(Series & series)
+{
+    while (true)
+    {
+        std::atomic<uint64_t> * oldest = nullptr;
+        uint64_t oldestUs              = 0;
+        for (auto & slot : series.mBeginUs)
+        {
+            const uint64_t start = slot.load(std::memory_order_relaxed);
+            if (start != 0 && (oldest == nullptr || start < oldestUs))
+            {
+                oldest   = &slot;
+                oldestUs = start;
+            }
+        }
+        if (oldest == nullptr)
+        {
+            return 0;
+        }
+        // Another end event of the same key may have taken this begin in the meantime.
+        if (oldest->compare_exchange_strong(oldestUs, 0, std::memory_order_relaxed))
+        {
+            return oldestUs;
+        }
+    }
+}
+
+void MetricsBackend::RecordDuration(Series * series, uint64_t durationUs)
+{
+    if (series == nullptr)
+    {
+        return;
+    }
+    series->mCount.fetch_add(1, std::memory_order_relaxed);
+    series->mSumUs.fetch_add(durationUs, std::memory_order_relaxed);
+    series->mBuckets[BucketFor(durationUs)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void MetricsBackend::RecordEvent(char phase, const char * label, const char * group, uint64_t timestampUs, uint64_t durationUs,
+                                 int64_t value)
+{
+    const uint64_t index = mNextEvent.fetch_add(1, std::memory_order_relaxed);
+    Event & event        = mEvents[index & (kEventCapacity - 1)];
+
+    event.mSequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.mLabel.store(label, std::memory_order_relaxed);
+    event.mGroup.store(group, std::memory_order_relaxed);
+    event.mTimestampUs.store(timestampUs, std::memory_order_relaxed);
+    event.mDurationUs.store(durationUs, std::memory_order_relaxed);
+    event.mValue.store(value, std::memory_order_relaxed);
+    event.mThreadId.store(CurrentThreadId(), std::memory_order_relaxed);
+    event.mPhase.store(phase, std::memory_order_relaxed);
+    event.mSequence.store(2 * index + 2, std::memory_order_release);
+}
+
+void MetricsBackend::WritePrometheus(std::ostream & out) const
+{
+    out << "# HELP matter_trace_duration_seconds Duration of the traced scopes and metric events.\n";
+    out << "# TYPE matter_trace_duration_seconds histogram\n";
+    for (const Series & series : mSeries)
+    {
+        if (series.mState.load(std::memory_order_acquire) != kSeriesReady || series.mKind != Kind::kDuration)
+        {
+            continue;
+        }
+
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < kBucketCount; i++)
+        {
+            cumulative += series.mBuckets[i].load(std::memory_order_relaxed);
+            out << "matter_trace_duration_seconds_bucket{";
+            WriteLabels(out, series.mLabel, series.mGroup);
+            out << ",le=\"";
+            if (i < kBucketCount - 1)
+            {
+                WriteSeconds(out, uint64_t(1) << i);
+            }
+            else
+            {
+                out << "+Inf";
+            }
+            out << "\"} " << cumulative << '\n';
+        }
+        out << "matter_trace_duration_seconds_sum{";
+        WriteLabels(out, series.mLabel, series.mGroup);
+        out << "} ";
+        WriteSeconds(out, series.mSumUs.load(std::memory_order_relaxed));
+        out << "\nmatter_trace_duration_seconds_count{";
+        WriteLabels(out, series.mLabel, series.mGroup);
+        out << "} " << cumulative << '\n';
+    }
+
+    out << "# HELP matter_trace_events_total Number of traced instants, counters and instant metric events.\n";
+    out << "# TYPE matter_trace_events_total counter\n";
+    for (const Series & series : mSeries)
+    {
+        if (series.mState.load(std::memory_order_acquire) == kSeriesReady && series.mKind == Kind::kCount)
+        {
+            out << "matter_trace_events_total{";
+            WriteLabels(out, series.mLabel, series.mGroup);
+            out << "} " << series.mCount.load(std::memory_order_relaxed) << '\n';
+        }
+    }
+
+    out << "# HELP matter_trace_errors_total Number of metric events that reported an error.\n";
+    out << "# TYPE matter_trace_errors_total counter\n";
+    for (const Series & series : mSeries)
+    {
+        if (series.mState.load(std::memory_order_acquire) == kSeriesReady && series.mGroup == kMetricGroup)
+        {
+            out << "matter_trace_errors_total{";
+            WriteLabels(out, series.mLabel, series.mGroup);
+            out << "} " << series.mErrors.load(std::memory_order_relaxed) << '\n';
+        }
+    }
+
+    out << "# HELP matter_trace_unpaired_total Number of begin and end metric events that could not be paired.\n";
+    out << "# TYPE matter_trace_unpaired_total counter\n";
+    for (const Series & series : mSeries)
+    {
+        if (series.mState.load(std::memory_order_acquire) == kSeriesReady && series.mGroup == kMetricGroup &&
+            series.mKind == Kind::kDuration)
+        {
+            out << "matter_trace_unpaired_total{";
+            WriteLabels(out, series.mLabel, series.mGroup);
+            out << "} " << series.mUnpaired.load(std::memory_order_relaxed) << '\n';
+        }
+    }
+
+    out << "# HELP matter_trace_dropped_total Number of events not aggregated because too many series exist.\n";
+    out << "# TYPE matter_trace_dropped_total counter\n";
+    out << "matter_trace_dropped_total " << GetDroppedCount() << '\n';
+}
+
+void MetricsBackend::WriteChromeTrace(std::ostream & out) const
+{
+    const uint64_t end   = mNextEvent.load(std::memory_order_acquire);
+    const uint64_t begin = (end > kEventCapacity) ? end - kEventCapacity : 0;
+    bool first           = true;
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (uint64_t index = begin; index < end; index++)
+    {
+        const Event & event = mEvents[index & (kEventCapacity - 1)];
+
+        const uint64_t sequence = event.mSequence.load(std::memory_order_acquire);
+        if (sequence != 2 * index + 2)
+        {
+            // Not written yet, or already overwritten by a newer event.
+            continue;
+        }
+        const char * label   = event.mLabel.load(std::memory_order_relaxed);
+        const char * group   = event.mGroup.load(std::memory_order_relaxed);
+        uint64_t timestampUs = event.mTimestampUs.load(std::memory_order_relaxed);
+        uint64_t durationUs  = event.mDurationUs.load(std::memory_order_relaxed);
+        int64_t value        = event.mValue.load(std::memory_order_relaxed);
+        uint32_t threadId    = event.mThreadId.load(std::memory_order_relaxed);
+        char phase           = event.mPhase.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event.mSequence.load(std::memory_order_relaxed) != sequence)
+        {
+            continue;
+        }
+
+        out << (first ? "" : ",") << "\n{\"name\":\"";
+        WriteEscaped(out, label);
+        out << "\",\"cat\":\"";
+        WriteEscaped(out, group);
+        out << "\",\"ph\":\"" << phase << "\",\"ts\":" << timestampUs << ",\"pid\":1,\"tid\":" << threadId;
+        if (phase == 'X')
+        {
+            out << ",\"dur\":" << durationUs;
+        }
+        else if (phase == 'i')
+        {
+            out << ",\"s\":\"t\"";
+        }
+        if (phase == 'C' || value != 0)
+        {
+            out << ",\"args\":{\"value\":" << value << '}';
+        }
+        out << '}';
+        first = false;
+    }
+    out << "\n]}\n";
+}
+
+} // namespace Metrics
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,141 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <tracing/backend.h>
+
+#include <atomic>
+#include <ostream>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Tracing {
+namespace Metrics {
+
+/// A Backend that aggregates traces in memory, to be exported on demand.
+///
+/// - Every scope (TraceBegin/TraceEnd) and every begin/end metric event pair
+///   adds its duration to a latency histogram of its label and group.
+/// - Metric events carry no instance: an end event is paired with the oldest
+///   pending begin event of its key, and up to kPendingBeginCapacity begin
+///   events may be pending per key. Begin events beyond that, and end events
+///   without a pending begin, are counted as unpaired.
+/// - Instants, counters and instant metric events are counted.
+/// - The last kEventCapacity events are kept in a ring buffer.
+///
+/// WritePrometheus() exports the histograms and counts in the Prometheus text
+/// format, and WriteChromeTrace() exports the ring buffer as Chrome trace
+/// event JSON, which can be loaded in chrome://tracing or Perfetto.
+///
+/// THREAD SAFETY:
+///    Recording is lock-free: series are claimed with compare-and-swap and
+///    updated with relaxed atomic operations, and ring buffer slots are
+///    protected by a sequence number. Exports may run concurrently with
+///    recording, and skip the events that are being overwritten.
+///
+/// Scopes are assumed to be nested per thread, as documented in Backend.
+class MetricsBackend : public ::chip::Tracing::Backend
+{
+public:
+    /// Maximum number of distinct label/group pairs. Later pairs are counted as dropped.
+    static constexpr size_t kSeriesCapacity = 256;
+
+    /// Number of events kept for WriteChromeTrace. Must be a power of 2.
+    static constexpr size_t kEventCapacity = 4096;
+
+    /// Maximum number of begin metric events of a key that wait for their end event.
+    static constexpr size_t kPendingBeginCapacity = 4;
+
+    /// Histogram bucket i counts the durations below 2^i microseconds, the last
+    /// bucket counts all the longer ones.
+    static constexpr size_t kBucketCount = 28;
+
+    MetricsBackend() = default;
+
+    MetricsBackend(const MetricsBackend &)             = delete;
+    MetricsBackend & operator=(const MetricsBackend &) = delete;
+
+    void TraceBegin(const char * label, const char * group) override;
+    void TraceEnd(const char * label, const char * group) override;
+    void TraceInstant(const char * label, const char * group) override;
+    void TraceCounter(const char * label) override;
+    void LogMetricEvent(const MetricEvent & event) override;
+
+    /// Write the histograms and counts in the Prometheus text exposition format.
+    void WritePrometheus(std::ostream & out) const;
+
+    /// Write the buffered events in the Chrome trace event JSON format.
+    void WriteChromeTrace(std::ostream & out) const;
+
+    /// Number of events that could not be aggregated because the series table is full.
+    uint64_t GetDroppedCount() const { return mDropped.load(std::memory_order_relaxed); }
+
+private:
+    enum class Kind : uint8_t
+    {
+        kDuration,
+        kCount,
+    };
+
+    struct Series
+    {
+        // kFree, then kClaimed while mLabel/mGroup/mKind are set, then kReady.
+        std::atomic<uint8_t> mState{ 0 };
+        const char * mLabel = nullptr;
+        const char * mGroup = nullptr;
+        Kind mKind          = Kind::kCount;
+
+        std::atomic<uint64_t> mCount{ 0 };
+        std::atomic<uint64_t> mErrors{ 0 };
+        std::atomic<uint64_t> mSumUs{ 0 };
+        std::atomic<uint64_t> mBuckets[kBucketCount] = {};
+
+        // Starts of the begin metric events waiting for their end event, 0 for free slots.
+        std::atomic<uint64_t> mBeginUs[kPendingBeginCapacity] = {};
+        std::atomic<uint64_t> mUnpaired{ 0 };
+    };
+
+    struct Event
+    {
+        // 2 * index + 1 while the slot is written, 2 * index + 2 once written.
+        std::atomic<uint64_t> mSequence{ 0 };
+        std::atomic<const char *> mLabel{ nullptr };
+        std::atomic<const char *> mGroup{ nullptr };
+        std::atomic<uint64_t> mTimestampUs{ 0 };
+        std::atomic<uint64_t> mDurationUs{ 0 };
+        std::atomic<int64_t> mValue{ 0 };
+        std::atomic<uint32_t> mThreadId{ 0 };
+        std::atomic<char> mPhase{ 0 };
+    };
+
+    Series * FindOrAddSeries(const char * label, const char * group, Kind kind);
+    static uint64_t TakeOldestBegin(Series & series);
+    void RecordDuration(Series * series, uint64_t durationUs);
+    void RecordEvent(char phase, const char * label, const char * group, uint64_t timestampUs, uint64_t durationUs,
+                     int64_t value = 0);
+
+    Series mSeries[kSeriesCapacity];
+    Event mEvents[kEventCapacity];
+    std::atomic<uint64_t> mNextEvent{ 0 };
+    std::atomic<uint64_t> mDropped{ 0 };
+};
+
+} // namespace Metrics
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,220 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/support/UnitTestRegistration.h>
+#include <tracing/metric_event.h>
+#include <tracing/metrics/metrics_tracing.h>
+
+#include <nlunit-test.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Metrics;
+
+namespace {
+
+size_t CountOccurrences(const std::string & text, const std::string & pattern)
+{
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+    {
+        count++;
+    }
+    return count;
+}
+
+void TestScopeHistograms(nlTestSuite * inSuite, void * inContext)
+{
+    auto backend = std::make_unique<MetricsBackend>();
+
+    backend->TraceBegin("Establish", "CASESession");
+    backend->TraceBegin("Sigma1", "CASESession");
+    backend->TraceEnd("Sigma1", "CASESession");
+    backend->TraceEnd("Establish", "CASESession");
+    backend->TraceBegin("Sigma1", "CASESession");
+    backend->TraceEnd("Sigma1", "CASESession");
+    backend->TraceInstant("Lookup", "DNSSD");
+
+    std::ostringstream out;
+    backend->WritePrometheus(out);
+    std::string text = out.str();
+
+    NL_TEST_ASSERT(inSuite,
+                   text.find("matter_trace_duration_seconds_count{group=\"CASESession\",label=\"Sigma1\"} 2\n") !=
+                       std::string::npos);
+    NL_TEST_ASSERT(inSuite,
+                   text.find("matter_trace_duration_seconds_count{group=\"CASESession\",label=\"Establish\"} 1\n") !=
+                       std::string::npos);
+    NL_TEST_ASSERT(inSuite,
+                   text.find("matter_trace_duration_seconds_bucket{group=\"CASESession\",label=\"Sigma1\",le=\"+Inf\"} 2\n") !=
+                       std::string::npos);
+    NL_TEST_ASSERT(inSuite, CountOccurrences(text, "label=\"Sigma1\",le=") == MetricsBackend::kBucketCount);
+    NL_TEST_ASSERT(inSuite, text.find("matter_trace_events_total{group=\"DNSSD\",label=\"Lookup\"} 1\n") != std::string::npos);
+    NL_TEST_ASSERT(inSuite, text.find("matter_trace_dropped_total 0\n") != std::string::npos);
+}
+
+void TestMetricEvents(nlTestSuite * inSuite, void * inContext)
+{
+    auto backend = std::make_unique<MetricsBackend>();
+
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, "pase"));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, "pase", CHIP_ERROR_TIMEOUT));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, "pase"));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, "pase", CHIP_NO_ERROR));
+
+    // An end without a begin counts the error, but no duration.
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, "pase", CHIP_ERROR_TIMEOUT));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, "dnssd_retry", uint32_t(3)));
+
+    std::ostringstream out;
+    backend->WritePrometheus(out);
+    std::string text = out.str();
+
+    NL_TEST_ASSERT(inSuite,
+                   text.find("matter_trace_duration_seconds_count{group=\"Metric\",label=\"pase\"} 2\n") != std::string::npos);
+    NL_TEST_ASSERT(inSuite, text.find("matter_trace_errors_total{group=\"Metric\",label=\"pase\"} 2\n") != std::string::npos);
+    NL_TEST_ASSERT(inSuite,
+                   text.find("matter_trace_events_total{group=\"Metric\",label=\"dnssd_retry\"} 1\n") != std::string::npos);
+    NL_TEST_ASSERT(inSuite, text.find("matter_trace_unpaired_total{group=\"Metric\",label=\"pase\"} 1\n") != std::string::npos);
+}
+
+void TestOverlappingMetricEvents(nlTestSuite * inSuite, void * inContext)
+{
+    auto backend = std::make_unique<MetricsBackend>();
+
+    // Two commissioning attempts of the same key overlap: both durations are recorded.
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, "case"));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, "case"));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, "case", CHIP_NO_ERROR));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, "case", CHIP_NO_ERROR));
+
+    // Begin events beyond the pending capacity are dropped and counted.
+    for (size_t i = 0; i < MetricsBackend::kPendingBeginCapacity + 2; i++)
+    {
+        backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, "pase"));
+    }
+    for (size_t i = 0; i < MetricsBackend::kPendingBeginCapacity; i++)
+    {
+        backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, "pase", CHIP_NO_ERROR));
+    }
+
+    std::ostringstream out;
+    backend->WritePrometheus(out);
+    std::string text = out.str();
+
+    NL_TEST_ASSERT(inSuite,
+                   text.find("matter_trace_duration_seconds_count{group=\"Metric\",label=\"case\"} 2\n") != std::string::npos);
+    NL_TEST_ASSERT(inSuite, text.find("matter_trace_unpaired_total{group=\"Metric\",label=\"case\"} 0\n") != std::string::npos);
+    NL_TEST_ASSERT(inSuite,
+                   text.find("matter_trace_duration_seconds_count{group=\"Metric\",label=\"pase\"} 4\n") != std::string::npos);
+    NL_TEST_ASSERT(inSuite, text.find("matter_trace_unpaired_total{group=\"Metric\",label=\"pase\"} 2\n") != std::string::npos);
+}
+
+void TestChromeTrace(nlTestSuite * inSuite, void * inContext)
+{
+    auto backend = std::make_unique<MetricsBackend>();
+
+    backend->TraceBegin("Read", "InteractionModel");
+    backend->TraceEnd("Read", "InteractionModel");
+    backend->TraceInstant("MessageSent", "Messaging");
+    backend->TraceCounter("Retransmit");
+    backend->TraceCounter("Retransmit");
+
+    std::ostringstream out;
+    backend->WriteChromeTrace(out);
+    std::string text = out.str();
+
+    NL_TEST_ASSERT(inSuite, text.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0);
+    NL_TEST_ASSERT(inSuite, text.find("{\"name\":\"Read\",\"cat\":\"InteractionModel\",\"ph\":\"X\"") != std::string::npos);
+    NL_TEST_ASSERT(inSuite, text.find("{\"name\":\"MessageSent\",\"cat\":\"Messaging\",\"ph\":\"i\"") != std::string::npos);
+    NL_TEST_ASSERT(inSuite, text.find("\"args\":{\"value\":2}") != std::string::npos);
+    NL_TEST_ASSERT(inSuite, CountOccurrences(text, "\n{\"name\"") == 4);
+
+    // Only the most recent events are kept.
+    for (size_t i = 0; i < MetricsBackend::kEventCapacity + 10; i++)
+    {
+        backend->TraceInstant("Tick", "Test");
+    }
+    out.str("");
+    backend->WriteChromeTrace(out);
+    text = out.str();
+    NL_TEST_ASSERT(inSuite, CountOccurrences(text, "\n{\"name\"") == MetricsBackend::kEventCapacity);
+    NL_TEST_ASSERT(inSuite, text.find("\"name\":\"Read\"") == std::string::npos);
+}
+
+void TestConcurrentRecording(nlTestSuite * inSuite, void * inContext)
+{
+    auto backend = std::make_unique<MetricsBackend>();
+
+    constexpr size_t kThreadCount = 4;
+    constexpr size_t kScopeCount  = 1000;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreadCount; t++)
+    {
+        threads.emplace_back([&backend]() {
+            for (size_t i = 0; i < kScopeCount; i++)
+            {
+                backend->TraceBegin("Invoke", "InteractionModel");
+                backend->TraceEnd("Invoke", "InteractionModel");
+            }
+        });
+    }
+
+    // Exporting while recording is allowed.
+    std::ostringstream ignored;
+    backend->WriteChromeTrace(ignored);
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    std::ostringstream out;
+    backend->WritePrometheus(out);
+    NL_TEST_ASSERT(inSuite,
+                   out.str().find("matter_trace_duration_seconds_count{group=\"InteractionModel\",label=\"Invoke\"} 4000\n") !=
+                       std::string::npos);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("ScopeHistograms", TestScopeHistograms),                 //
+    NL_TEST_DEF("MetricEvents", TestMetricEvents),                       //
+    NL_TEST_DEF("OverlappingMetricEvents", TestOverlappingMetricEvents), //
+    NL_TEST_DEF("ChromeTrace", TestChromeTrace),                         //
+    NL_TEST_DEF("ConcurrentRecording", TestConcurrentRecording),         //
+    NL_TEST_SENTINEL()                                                   //
+};
+
+} // namespace
+
+int TestMetricsTracing()
+{
+    nlTestSuite theSuite = { "Metrics tracing backend tests", &sTests[0], nullptr, nullptr };
+
+    // Run test suite against one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMetricsTracing)
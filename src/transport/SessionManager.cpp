@@ -184,6 +184,7 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
         auto groupSession = sessionHandle->AsOutgoingGroupSession();
         auto * groups     = Credentials::GetGroupDataProvider();
         VerifyOrReturnError(nullptr != groups, CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(message->TotalLength() <= kMaxAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
 
         const FabricInfo * fabric = mFabricTable->FindFabricWithIndex(groupSession->GetFabricIndex());
         VerifyOrReturnError(fabric != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -232,6 +233,10 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
             return CHIP_ERROR_NOT_CONNECTED;
         }
 
+        // Messages larger than a network packet can only be sent over a stream transport.
+        const size_t maxAppMessageLen = session->AllowsLargePayload() ? kMaxLargeAppMessageLen : kMaxAppMessageLen;
+        VerifyOrReturnError(message->TotalLength() <= maxAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
+
         MessageCounter & counter = session->GetSessionMessageCounter().GetLocalMessageCounter();
         uint32_t messageCounter;
         ReturnErrorOnFailure(counter.AdvanceAndConsume(messageCounter));
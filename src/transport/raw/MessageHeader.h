@@ -61,6 +61,10 @@ static constexpr size_t kMaxPacketBufferApplicationPayloadAndMICSizeBytes = Syst
 static constexpr size_t kMaxApplicationPayloadAndMICSizeBytes =
     min(kMaxPerSpecApplicationPayloadAndMICSizeBytes, kMaxPacketBufferApplicationPayloadAndMICSizeBytes);
 
+// Max space we have for our Application Payload and MIC over a stream transport (TCP), which is not bound by the IP MTU.
+static constexpr size_t kMaxLargeApplicationPayloadAndMICSizeBytes =
+    max(kMaxApplicationPayloadAndMICSizeBytes, static_cast<size_t>(System::PacketBuffer::kLargeBufMaxSize));
+
 } // namespace detail
 
 static constexpr size_t kMaxTagLen = 16;
@@ -72,6 +76,10 @@ static_assert(detail::kMaxApplicationPayloadAndMICSizeBytes > kMaxTagLen, "Need
 // those in the header sizes.
 static constexpr size_t kMaxAppMessageLen = detail::kMaxApplicationPayloadAndMICSizeBytes - kMaxTagLen;
 
+// Max application message length on sessions that allow large payloads (see Session::AllowsLargePayload). This is the same as
+// kMaxAppMessageLen unless large packet buffers are enabled.
+static constexpr size_t kMaxLargeAppMessageLen = detail::kMaxLargeApplicationPayloadAndMICSizeBytes - kMaxTagLen;
+
 static constexpr uint16_t kMsgUnicastSessionIdUnsecured = 0x0000;
 
 typedef int PacketHeaderFlags;
@@ -43,7 +43,9 @@ using namespace chip::Encoding;
 constexpr size_t kPacketSizeBytes = 2;
 
 // TODO: Actual limit may be lower (spec issue #2119)
-constexpr uint16_t kMaxMessageSize = static_cast<uint16_t>(System::PacketBuffer::kMaxSizeWithoutReserve - kPacketSizeBytes);
+// Messages received over TCP are not bound by the network MTU, so they may use large packet buffers when those are enabled.
+constexpr uint16_t kMaxMessageSize =
+    static_cast<uint16_t>(System::PacketBuffer::kLargeBufMaxSizeWithoutReserve - kPacketSizeBytes);
 
 constexpr int kListenBacklogSize = 2;
 